@@ -0,0 +1,34 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+namespace Benchmarks {
+
+	/// <summary>
+	/// Time a callable over a number of iterations and print the average cost of one iteration
+	/// </summary>
+	/// <param name="label">Name to report the result under</param>
+	/// <param name="iterations">Number of times to call the callable</param>
+	/// <param name="func">Callable to time</param>
+	/// <returns>Average nanoseconds per iteration</returns>
+	template<typename TFunc>
+	double TimeAndReport(const std::string& label, int iterations, TFunc&& func) {
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i) {
+			func();
+		}
+		auto end = std::chrono::steady_clock::now();
+
+		double nsPerIteration = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+		std::cout << "  " << label << ": " << nsPerIteration << " ns/iteration over " << iterations << " iterations" << std::endl;
+		return nsPerIteration;
+	}
+
+	void RunContextSwitchBenchmark();
+	void RunTextureDecodeBenchmark();
+	void RunCullBenchmark();
+	void RunSpatialIndexBenchmark();
+
+} // Benchmarks
@@ -0,0 +1,40 @@
+#include "Benchmarks.h"
+
+#include <glad/glad.h>
+
+#include <OORenderer/Window.h>
+
+namespace Benchmarks {
+
+	void RunContextSwitchBenchmark() {
+		std::cout << "Context switch benchmark (two windows, alternating)" << std::endl;
+
+		using namespace OORenderer;
+
+		Window window1{ 320, 240, "Context switch A" };
+		Window window2{ 320, 240, "Context switch B" };
+
+		constexpr int iterations = 5000;
+
+		// Current path, a context switch and a function table swap
+		double tableSwapNs = TimeAndReport("Function table swap", iterations, [&]() {
+			window1.ActivateWindow();
+			window2.ActivateWindow();
+		});
+
+		// What every activation used to do, reload GLAD and reset the viewport
+		GLFWwindow* windows[] = { window1.GetGLFWWindow(), window2.GetGLFWWindow() };
+		double reloadNs = TimeAndReport("GLAD reload per switch", iterations, [&]() {
+			for (GLFWwindow* window : windows) {
+				glfwMakeContextCurrent(window);
+				gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+				int width, height;
+				glfwGetFramebufferSize(window, &width, &height);
+				glViewport(0, 0, width, height);
+			}
+		});
+
+		std::cout << "  Speedup: " << reloadNs / tableSwapNs << "x" << std::endl;
+	}
+
+} // Benchmarks
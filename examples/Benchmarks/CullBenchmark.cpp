@@ -0,0 +1,59 @@
+#include "Benchmarks.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <OORenderer/Frustum.h>
+
+namespace Benchmarks {
+
+	void RunCullBenchmark() {
+		std::cout << "Cull benchmark (bounding spheres tested against a view frustum)" << std::endl;
+
+		using namespace OORenderer;
+
+		// A camera in the middle of a field of objects, roughly a tenth of them in view
+		glm::mat4 pvMatrix = glm::perspective(1.0f, 16.0f / 9.0f, 0.1f, 200.0f) * glm::lookAt(glm::vec3{ 0.0f }, glm::vec3{ 1.0f, 0.0f, -1.0f }, glm::vec3{ 0.0f, 1.0f, 0.0f });
+		Frustum frustum{ pvMatrix };
+
+		std::mt19937 generator{ 42 };
+		std::uniform_real_distribution<float> position{ -200.0f, 200.0f };
+		std::uniform_real_distribution<float> radius{ 0.1f, 5.0f };
+
+		for (std::size_t objectCount : { 1'000, 100'000, 1'000'000 }) {
+			std::vector<BoundingSphere> spheres(objectCount);
+			for (BoundingSphere& sphere : spheres) {
+				sphere = { { position(generator), position(generator), position(generator) }, radius(generator) };
+			}
+
+			std::vector<std::uint32_t> visibleIndices;
+			visibleIndices.reserve(objectCount);
+			int iterations = static_cast<int>(std::max<std::size_t>(100'000'000 / objectCount, 10) / 10);
+
+			double scalarNs = TimeAndReport(std::to_string(objectCount) + " objects, one at a time", iterations, [&]() {
+				visibleIndices.clear();
+				for (std::uint32_t i = 0; i < spheres.size(); ++i) {
+					if (frustum.Intersects(spheres[i])) {
+						visibleIndices.push_back(i);
+					}
+				}
+			});
+
+			double batchedNs = TimeAndReport(std::to_string(objectCount) + " objects, batched", iterations, [&]() {
+				visibleIndices.clear();
+				frustum.Cull(spheres, visibleIndices);
+			});
+
+			std::cout << "  " << visibleIndices.size() << " visible. "
+				<< objectCount / (scalarNs / 1e6) << " objects/ms one at a time, "
+				<< objectCount / (batchedNs / 1e6) << " objects/ms batched" << std::endl;
+		}
+	}
+
+} // Benchmarks
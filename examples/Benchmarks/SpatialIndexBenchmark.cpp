@@ -0,0 +1,93 @@
+#include "Benchmarks.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <OORenderer/Frustum.h>
+#include <OORenderer/SpatialIndex.h>
+
+namespace Benchmarks {
+
+	void RunSpatialIndexBenchmark() {
+		std::cout << "Spatial index benchmark (a few percent of objects moving each frame, then a frustum query)" << std::endl;
+
+		using namespace OORenderer;
+
+		// Same field of objects as the cull benchmark, roughly a tenth of them in view
+		glm::mat4 pvMatrix = glm::perspective(1.0f, 16.0f / 9.0f, 0.1f, 200.0f) * glm::lookAt(glm::vec3{ 0.0f }, glm::vec3{ 1.0f, 0.0f, -1.0f }, glm::vec3{ 0.0f, 1.0f, 0.0f });
+		Frustum frustum{ pvMatrix };
+
+		std::mt19937 generator{ 42 };
+		std::uniform_real_distribution<float> position{ -200.0f, 200.0f };
+		std::uniform_real_distribution<float> radius{ 0.1f, 5.0f };
+		std::uniform_real_distribution<float> step{ -0.5f, 0.5f };
+
+		for (std::size_t objectCount : { 50'000, 200'000 }) {
+			// Objects are a unit model placed by their model matrix, as RenderObjects are
+			BoundingSphere modelSphere{ glm::vec3{ 0.0f }, 1.0f };
+			std::vector<glm::mat4> modelMatrices(objectCount);
+			std::vector<BoundingSphere> spheres(objectCount);
+			for (std::size_t i = 0; i < objectCount; ++i) {
+				glm::vec3 translation{ position(generator), position(generator), position(generator) };
+				modelMatrices[i] = glm::scale(glm::translate(glm::mat4{ 1.0f }, translation), glm::vec3{ radius(generator) });
+				spheres[i] = modelSphere.Transformed(modelMatrices[i]);
+			}
+
+			auto boxOf = [](const BoundingSphere& sphere) {
+				return AABB{ sphere.Center - glm::vec3{ sphere.Radius }, sphere.Center + glm::vec3{ sphere.Radius } };
+			};
+
+			// No RenderObjects here, the queries only count what they find
+			SpatialIndex spatialIndex;
+			std::vector<SpatialIndex::ProxyID> proxies(objectCount);
+			TimeAndReport(std::to_string(objectCount) + " objects, build", 1, [&]() {
+				for (std::size_t i = 0; i < objectCount; ++i) {
+					proxies[i] = spatialIndex.Insert(boxOf(spheres[i]), nullptr);
+				}
+			});
+
+			std::size_t movingCount = objectCount * 3 / 100;
+			std::uniform_int_distribution<std::size_t> pick{ 0, objectCount - 1 };
+			std::size_t reinsertCount = 0;
+			int frames = 100;
+			TimeAndReport(std::to_string(movingCount) + " objects moving", frames, [&]() {
+				for (std::size_t i = 0; i < movingCount; ++i) {
+					std::size_t index = pick(generator);
+					modelMatrices[index] = glm::translate(glm::mat4{ 1.0f }, glm::vec3{ step(generator), step(generator), step(generator) }) * modelMatrices[index];
+					spheres[index] = modelSphere.Transformed(modelMatrices[index]);
+					reinsertCount += spatialIndex.Update(proxies[index], boxOf(spheres[index])) ? 1 : 0;
+				}
+			});
+
+			std::vector<RenderObject*> found;
+			found.reserve(objectCount);
+			double treeNs = TimeAndReport(std::to_string(objectCount) + " objects, tree query", frames, [&]() {
+				found.clear();
+				spatialIndex.Query(frustum, found);
+			});
+
+			// Without an index every object's bounds are moved to world space each frame before culling
+			std::vector<BoundingSphere> worldSpheres(objectCount);
+			std::vector<std::uint32_t> visibleIndices;
+			visibleIndices.reserve(objectCount);
+			double linearNs = TimeAndReport(std::to_string(objectCount) + " objects, batched linear cull", frames, [&]() {
+				for (std::size_t i = 0; i < objectCount; ++i) {
+					worldSpheres[i] = modelSphere.Transformed(modelMatrices[i]);
+				}
+				visibleIndices.clear();
+				frustum.Cull(worldSpheres, visibleIndices);
+			});
+
+			std::cout << "  " << found.size() << " found by the tree, " << visibleIndices.size() << " by the linear cull. Height "
+				<< spatialIndex.GetHeight() << ", " << 100.0 * reinsertCount / (movingCount * frames) << "% of moves reinserted. "
+				<< "Tree query takes " << treeNs / linearNs << "x the time of the linear cull" << std::endl;
+		}
+	}
+
+} // Benchmarks
@@ -0,0 +1,71 @@
+#include "Benchmarks.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <OORenderer/Window.h>
+#include <OORenderer/Texture.h>
+
+namespace Benchmarks {
+
+	void RunTextureDecodeBenchmark() {
+		std::cout << "Texture decode benchmark (load time against decode thread count)" << std::endl;
+
+		using namespace OORenderer;
+
+		// Every image we ship, the backpack textures are the interesting ones
+		std::vector<std::filesystem::path> texturePaths;
+		for (const char* directory : { "./resources/models/backpack", "./resources/textures" }) {
+			if (!std::filesystem::exists(directory)) {
+				continue;
+			}
+			for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+				std::string extension = entry.path().extension().string();
+				if (extension == ".jpg" || extension == ".jpeg" || extension == ".png") {
+					texturePaths.push_back(entry.path());
+				}
+			}
+		}
+
+		if (texturePaths.empty()) {
+			std::cout << "  No textures found, skipping" << std::endl;
+			return;
+		}
+		std::cout << "  " << texturePaths.size() << " textures" << std::endl;
+
+		Window window{ 320, 240, "Texture decode" };
+		constexpr int iterations = 3;
+
+		// Decode and upload one after another on this thread
+		double serialNs = TimeAndReport("Serial", iterations, [&]() {
+			std::vector<std::unique_ptr<Texture>> textures;
+			for (const auto& texturePath : texturePaths) {
+				textures.push_back(std::make_unique<Texture>(window, texturePath));
+			}
+		});
+
+		// Decode on the pool, upload here as each finishes
+		unsigned int maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+		for (unsigned int threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+			Texture::SetDecodeThreadCount(threadCount);
+
+			double parallelNs = TimeAndReport(std::to_string(threadCount) + " decode threads", iterations, [&]() {
+				std::vector<std::unique_ptr<Texture>> textures;
+				for (const auto& texturePath : texturePaths) {
+					textures.push_back(std::make_unique<Texture>(window));
+					textures.back()->LoadTextureAsync(texturePath);
+				}
+				for (auto& texture : textures) {
+					texture->WaitForDecode();
+					texture->UploadDecodedTexture();
+				}
+			});
+
+			std::cout << "    Speedup over serial: " << serialNs / parallelNs << "x" << std::endl;
+		}
+	}
+
+} // Benchmarks
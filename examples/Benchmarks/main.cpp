@@ -0,0 +1,33 @@
+
+#include <functional>
+#include <map>
+#include <string>
+
+#include "Benchmarks.h"
+
+int main(int argc, char** argv) {
+
+	const std::map<std::string, std::function<void()>> benchmarks = {
+		{ "ContextSwitch", Benchmarks::RunContextSwitchBenchmark },
+		{ "TextureDecode", Benchmarks::RunTextureDecodeBenchmark },
+		{ "Cull", Benchmarks::RunCullBenchmark },
+		{ "SpatialIndex", Benchmarks::RunSpatialIndexBenchmark },
+	};
+
+	// No arguments runs everything, otherwise run the named benchmarks
+	if (argc < 2) {
+		for (const auto& [name, benchmark] : benchmarks) {
+			benchmark();
+		}
+		return 0;
+	}
+
+	for (int i = 1; i < argc; ++i) {
+		auto benchmarkIt = benchmarks.find(argv[i]);
+		if (benchmarkIt == benchmarks.end()) {
+			std::cout << "Unknown benchmark: " << argv[i] << std::endl;
+			continue;
+		}
+		benchmarkIt->second();
+	}
+}
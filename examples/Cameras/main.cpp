@@ -110,6 +110,7 @@ int main()
 
 	// Setup camera - we use the same camera for both windows because that's an option
 	Camera camera1;
+	camera1.BindToWindow(window1);
 
 	glm::mat4 modelMatrix{ 1.0f }; // Identity
 	std::cout << modelMatrix[0][0] << ' ' << modelMatrix[0][1] << ' ' << modelMatrix[0][2] << ' ' << modelMatrix[0][3] << std::endl;
@@ -8,6 +8,7 @@
 #include <OORenderer/ShaderProgram.h>
 #include <OORenderer/Camera.h>
 #include <OORenderer/Model.h>
+#include <OORenderer/Profiler.h>
 
 void InputCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
 	std::cout << "Window " << window << " pressed key " << key;
@@ -26,11 +27,14 @@ int main()
 	using namespace OORenderer;
 
 	Window window1{ 800, 600 };
-	Window window2{ 800, 600 };
+	Window window2{ 800, 600, "", NULL, window1.GetGLFWWindow() }; // Shares buffers, textures, and programs with window1
 
 	window1.RegisterKeyCallback(InputCallback);
 	window2.RegisterKeyCallback(InputCallback);
 
+	// Later runs load linked programs from here rather than compiling them again
+	ShaderProgram::EnableBinaryCache("./shaderCache");
+
 	// Advanced construction arbitrary shader stages as supported by OpenGL
 	ShaderProgram shaderProgram1{ window1 };
 
@@ -46,45 +50,62 @@ int main()
 
 	// Setup camera - we use the same camera for both windows because that's an option
 	Camera camera1;
+	camera1.BindToWindow(window1);
+
+	// Block compress textures, later runs upload the compressed mips cached here
+	Texture::EnableCompression(Texture::Compression::Fast, "./textureCache");
 
-	// Load model
+	// Load model, later runs map the imported meshes from here rather than importing them again
+	Model::EnableMeshCache("./meshCache");
+	Model::EnableMeshOptimization();
 	Model backpackModel{ modelPath };
 
+	// Both windows share a group so nothing needs the CPU side copies after the first upload
+	backpackModel.SetResidencyPolicy(ResidencyPolicy::DropAfterUpload);
+
 	// Register the model for use on both windows
 	backpackModel.RegisterOnWindow(window1);
 	backpackModel.RegisterOnWindow(window2);
+	Residency::LogStats();
 
 	glm::mat4 modelMatrix{ 1.0f }; // Identity
 
-	while (!window1.ShouldClose() && !window2.ShouldClose()) {
-
-		window1.ActivateWindow();
-		glEnable(GL_DEPTH_TEST);
-		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	// Both render threads draw the model, so upload its textures before they start rather than from whichever frame gets there first
+	backpackModel.WaitForTextures();
 
-		shaderProgram1.SetUniformMatrix4fv("pvMatrix", camera1.GetPVMatrix());
-		shaderProgram1.SetUniformMatrix4fv("modelMatrix", modelMatrix);
-		shaderProgram1.UseProgram();
+	// Each window draws and swaps on a thread of its own, so neither waits on the other's vsync
+	window1.StartRenderThread();
+	window2.StartRenderThread();
 
-		backpackModel.Render(shaderProgram1);
+	while (!window1.ShouldClose() && !window2.ShouldClose()) {
 
-		window1.UpdateDisplay();
+		// Frames are drawn after the loop moves on, so they take a copy of what it changes.
+		// Each window sets uniforms on a program of its own, so neither thread writes state the other reads
+		glm::mat4 pvMatrix = camera1.GetPVMatrix();
 
+		window1.SubmitFrame([&, pvMatrix] {
+			glEnable(GL_DEPTH_TEST);
+			glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+			shaderProgram1.SetUniformMatrix4fv("pvMatrix", pvMatrix);
+			shaderProgram1.SetUniformMatrix4fv("modelMatrix", modelMatrix);
+			shaderProgram1.UseProgram();
 
-		window2.ActivateWindow();
-		glEnable(GL_DEPTH_TEST);
-		glClearColor(1.0, 0.0f, 0.0f, 1.0f);
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			backpackModel.Render(shaderProgram1);
+		});
 
-		shaderProgram2.SetUniformMatrix4fv("pvMatrix", camera1.GetPVMatrix());
-		shaderProgram2.SetUniformMatrix4fv("modelMatrix", modelMatrix);
-		shaderProgram2.UseProgram();
+		window2.SubmitFrame([&, pvMatrix] {
+			glEnable(GL_DEPTH_TEST);
+			glClearColor(1.0, 0.0f, 0.0f, 1.0f);
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-		backpackModel.Render(shaderProgram2);
+			shaderProgram2.SetUniformMatrix4fv("pvMatrix", pvMatrix);
+			shaderProgram2.SetUniformMatrix4fv("modelMatrix", modelMatrix);
+			shaderProgram2.UseProgram();
 
-		window2.UpdateDisplay();
+			backpackModel.Render(shaderProgram2);
+		});
 
 		float timeValue = glfwGetTime();
 		camera1.MoveTo(glm::vec3{ 10*sin(timeValue), 10*cos(timeValue), 10 });
@@ -93,5 +114,13 @@ int main()
 
 		glfwPollEvents();
 	}
-}
 
+	// Objects are deleted on the main thread, so the render threads must let go of the contexts first
+	window1.StopRenderThread();
+	window2.StopRenderThread();
+
+	// Timings of the last frames, open in Perfetto. Without profiling built in there are none to write
+#ifdef OORENDERER_ENABLE_PROFILING
+	Profiler::WriteChromeTrace("./trace.json");
+#endif
+}
\ No newline at end of file
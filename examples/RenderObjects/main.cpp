@@ -2,17 +2,25 @@
 #include <iostream>
 #include <random>
 #include <ctime>
+#include <array>
+#include <latch>
+#include <span>
 
 #include <LoggingAD/LoggingAD.h>
 #include <LoggingAD/ScopedTimer.h>
 
 #include "OORenderer/Camera.h"
 #include "OORenderer/RenderObject.h"
+#include "OORenderer/RenderQueue.h"
+#include "OORenderer/CommandList.h"
+#include "OORenderer/FrameUniforms.h"
+#include "OORenderer/GLStateCache.h"
+#include "OORenderer/ThreadPool.h"
 
 class Application {
 public: // Public methods
 	Application()
-		: m_Window1(800, 600), m_Window2(800, 600)
+		: m_Window1(800, 600), m_Window2(800, 600), m_FrameUniforms1(m_Window1), m_FrameUniforms2(m_Window2)
 	{ }
 
 	void Run() {
@@ -41,8 +49,8 @@ private: // Private methods
 		LoggingAD::SetConfig(config);
 
 		std::filesystem::path modelPath{ "./resources/models/backpack/backpack.obj" };
-		std::filesystem::path shadersPath{ "./resources/shaders/models" };
-		std::string vertexShader = "vertShader.vs";
+		std::filesystem::path shadersPath{ "./resources/shaders/RenderObjects" };
+		std::string vertexShader = "instancedVertShader.vs"; // Copies of the model are drawn with one call per mesh
 		std::string fragShader = "fragShader.fs";
 
 		using namespace OORenderer;
@@ -50,9 +58,18 @@ private: // Private methods
 		m_Window1.RegisterKeyCallback(InputCallback);
 		m_Window2.RegisterKeyCallback(InputCallback);
 
+		m_Camera.BindToWindow(m_Window1);
 		m_Camera.MoveTo(glm::vec3{ 0, 0, 0 });
 		m_Camera.LookAt(glm::vec3{ 0, 0, -1 });
 
+		// Objects far from the camera draw simplified levels of the model
+		Model::EnableLODGeneration(4);
+
+		// Meshes share a few large buffers, so the render queue can draw many at once
+		Mesh::EnableGeometryPooling();
+
+		// Textures of a size share array textures, so meshes with different textures need no binds between them
+		Texture::EnableArrayPooling();
 		std::shared_ptr<Model> backpackModel = std::make_shared<Model>(modelPath); // We can use the same instance of the model
 
 		// Build our shader programs
@@ -79,25 +96,46 @@ private: // Private methods
 
 	void PerFrame() {
 
+		// Through the context's state cache, so enabling what is already enabled costs nothing
 		m_Window1.ActivateWindow();
-		glEnable(GL_DEPTH_TEST);
+		OORenderer::GLStateCache::Current().SetEnabled(GL_DEPTH_TEST, true);
 		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 		m_Window2.ActivateWindow();
-		glEnable(GL_DEPTH_TEST);
+		OORenderer::GLStateCache::Current().SetEnabled(GL_DEPTH_TEST, true);
 		glClearColor(1.0, 0.0f, 0.0f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 		
-		for (auto& object : m_RenderObjects) {
-			object.SetPVMatrix(m_Camera.GetPVMatrix());
-			object.Render();
+		// Camera matrices are uploaded once per window, every program on that window reads them from the same block
+		float timeValue = glfwGetTime();
+		m_FrameUniforms1.Update(m_Camera, timeValue);
+		m_FrameUniforms2.Update(m_Camera, timeValue);
+
+		// A worker culls and records half the objects while we do the other half, no GL calls are made while recording.
+		// It's the same thread every frame, so its culling scratch is reused rather than allocated again
+		std::span<OORenderer::RenderObject> objects{ m_RenderObjects };
+		for (OORenderer::CommandList& commandList : m_CommandLists) {
+			commandList.Clear();
 		}
+		std::latch recorded{ 1 };
+		m_RecordPool.Submit([&]() {
+			OORenderer::RenderObject::RecordAll(objects.first(objects.size() / 2), m_Camera, m_CommandLists[0]);
+			recorded.count_down();
+		});
+		OORenderer::RenderObject::RecordAll(objects.subspan(objects.size() / 2), m_Camera, m_CommandLists[1]);
+		recorded.wait();
+
+		// The recorded draws are queued and drawn sorted by state
+		OORenderer::CommandList::ReplayAll(m_CommandLists, &m_RenderQueue);
+		m_RenderQueue.Flush();
 
 		m_Window1.UpdateDisplay();
 		m_Window2.UpdateDisplay();
 
-		float timeValue = glfwGetTime();
+		const OORenderer::GLStateCache::Stats& stateStats = m_Window1.GetStateCache().GetFrameStats();
+		LoggingAD::Trace("Window 1 state changes: {} issued, {} skipped", stateStats.GetIssued(), stateStats.GetSkipped());
+
 		m_Camera.MoveTo(glm::vec3{ 10 * sin(timeValue), 10 * cos(timeValue), 10 });
 		m_Camera.LookAt(glm::vec3{ 0, 0, 0 });
 		m_Camera.RecalculateMatrices();
@@ -123,13 +161,21 @@ private: // Private methods
 private: // Private members
 	OORenderer::Window m_Window1;
 	OORenderer::Window m_Window2;
+	OORenderer::FrameUniforms m_FrameUniforms1;
+	OORenderer::FrameUniforms m_FrameUniforms2;
 
 	bool m_ShouldQuit = false;
 	OORenderer::Camera m_Camera;
 	std::vector<OORenderer::RenderObject> m_RenderObjects;
+	OORenderer::RenderQueue m_RenderQueue;
+	std::array<OORenderer::CommandList, 2> m_CommandLists;
+	OORenderer::ThreadPool m_RecordPool{ 1 };
 };
 
 int main() {
+	// Newer contexts stream per frame data through persistently mapped buffers
+	OORenderer::Window::SetContextVersion(4, 6);
+
 	Application app;
 	app.Run();
 }
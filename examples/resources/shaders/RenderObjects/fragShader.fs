@@ -0,0 +1,12 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec2 TexCoord;
+flat in uint DiffuseLayer;
+
+uniform sampler2DArray DiffuseTexture1;
+
+void main()
+{    
+    FragColor = texture(DiffuseTexture1, vec3(TexCoord, DiffuseLayer));
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 2) in vec2 aTexCoord;
+layout (location = 11) in uvec4 instanceTextureLayers;
+layout (location = 12) in mat4 instanceModelMatrix;
+
+out vec2 TexCoord;
+flat out uint DiffuseLayer;
+
+layout(std140) uniform FrameUniforms {
+	mat4 pvMatrix;
+	mat4 viewMatrix;
+	mat4 projectionMatrix;
+	vec4 cameraPosition;
+	float time;
+};
+
+void main()
+{
+	gl_Position = pvMatrix * instanceModelMatrix * vec4(aPos, 1.0f);
+	TexCoord = aTexCoord;
+	DiffuseLayer = instanceTextureLayers.x;
+}
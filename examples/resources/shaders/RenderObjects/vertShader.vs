@@ -0,0 +1,24 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 2) in vec2 aTexCoord;
+
+out vec2 TexCoord;
+flat out uint DiffuseLayer;
+
+layout(std140) uniform FrameUniforms {
+	mat4 pvMatrix;
+	mat4 viewMatrix;
+	mat4 projectionMatrix;
+	vec4 cameraPosition;
+	float time;
+};
+
+uniform mat4 modelMatrix;
+uniform int DiffuseTexture1Layer;
+
+void main()
+{
+	gl_Position = pvMatrix * modelMatrix * vec4(aPos, 1.0f);
+	TexCoord = aTexCoord;
+	DiffuseLayer = uint(DiffuseTexture1Layer);
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <span>
+
+#include <glm/glm.hpp>
+
+#include "OORenderer/VertexLayout.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// Axis aligned bounding box
+	/// </summary>
+	struct AABB {
+		glm::vec3 Min{ 0.0f };
+		glm::vec3 Max{ 0.0f };
+
+		glm::vec3 GetCenter() const;
+		glm::vec3 GetExtents() const;
+
+		/// <summary>
+		/// Get the box bounding this one after a transform, looser than the transformed geometry's own box
+		/// </summary>
+		AABB Transformed(const glm::mat4& transform) const;
+
+		/// <summary>
+		/// Get the box bounding both boxes
+		/// </summary>
+		static AABB Merge(const AABB& a, const AABB& b);
+	};
+
+	/// <summary>
+	/// Bounding sphere, laid out as four floats so batches of them may be loaded straight into SIMD registers
+	/// </summary>
+	struct BoundingSphere {
+		glm::vec3 Center{ 0.0f };
+		float Radius = 0.0f;
+
+		/// <summary>
+		/// Get the sphere bounding this one after a transform, non-uniform scales grow it by their largest axis
+		/// </summary>
+		BoundingSphere Transformed(const glm::mat4& transform) const;
+
+		/// <summary>
+		/// Get the smallest sphere bounding both spheres
+		/// </summary>
+		static BoundingSphere Merge(const BoundingSphere& a, const BoundingSphere& b);
+	};
+	static_assert(sizeof(BoundingSphere) == 4 * sizeof(float));
+
+	/// <summary>
+	/// Box and sphere bounds of some geometry, each is tighter for different shapes
+	/// </summary>
+	struct Bounds {
+		AABB Box;
+		BoundingSphere Sphere;
+
+		/// <summary>
+		/// Compute bounds of vertex positions, the sphere is Ritter's, within a few percent of the smallest
+		/// </summary>
+		static Bounds Of(std::span<const StandardVertex> vertices);
+
+		Bounds Transformed(const glm::mat4& transform) const;
+		static Bounds Merge(const Bounds& a, const Bounds& b);
+	};
+
+} // OORenderer
@@ -2,6 +2,7 @@
 
 #include "OORenderer/Window.h"
 
+#include <cstdint>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -19,11 +20,32 @@ namespace OORenderer {
 		// Call before using any matrices from this camera after any changes
 
 		/// <summary>
-		/// Recalculate the view and PV matrices.
+		/// Recalculate whichever matrices are out of date, nothing if the camera, its projection and its window are unchanged.
 		/// Do this between changes to the camera e.g. after calling Move()
 		/// and using the camera matrices e.g. passing to a shaderprogram.
+		/// Getters only read, so threads may read the matrices between recalculations.
 		/// </summary>
-		void RecalculateMatrices();
+		/// <returns>True if the matrices changed</returns>
+		bool RecalculateMatrices();
+
+		/// <summary>
+		/// Take the perspective aspect ratio from a window's framebuffer from now on, following it as the window is resized.
+		/// The window must outlive the camera
+		/// </summary>
+		/// <param name="window">Window this camera is displayed on</param>
+		void BindToWindow(const Window& window);
+
+		/// <summary>
+		/// Set the aspect ratio of the perspective projection, until the bound window is next resized
+		/// </summary>
+		/// <param name="aspectRatio">Width over height</param>
+		void SetAspectRatio(float aspectRatio);
+
+		/// <summary>
+		/// Get a number that changes whenever the matrices do, unique across cameras, to tell if matrices already published are current
+		/// </summary>
+		/// <returns>Version of the matrices</returns>
+		std::uint64_t GetVersion() const;
 
 		/// <summary>
 		/// Retrieve this cameras projection matrix
@@ -43,6 +65,12 @@ namespace OORenderer {
 		/// <returns>PV matrix</returns>
 		glm::mat4 GetPVMatrix() const;
 
+		/// <summary>
+		/// Retrieve this cameras position in world space
+		/// </summary>
+		/// <returns>Camera position</returns>
+		glm::vec3 GetPosition() const;
+
 		/// <summary>
 		/// Turn camera to look at a point in world space
 		/// </summary>
@@ -91,7 +119,8 @@ namespace OORenderer {
 		void SetProjectionOrthographic(float left, float right, float bottom, float top, float near, float far);
 
 		/// <summary>
-		/// Set the cameras projection matrix to perspective with standard glm perspective inputs
+		/// Set the cameras projection matrix to perspective with standard glm perspective inputs.
+		/// The aspect ratio is replaced by the bound window's when it is next resized
 		/// </summary>
 		/// <param name="fovRads">Field of view in radians</param>
 		/// <param name="aspectRatio">Aspect ratio of display</param>
@@ -113,6 +142,21 @@ namespace OORenderer {
 
 		// True if otherographic, false if perspective
 		bool m_OrthographicProjectionFlag = false;
+
+		// Perspective parameters, orthographic projections are built straight away
+		float m_FovRads = 1.0f;
+		float m_AspectRatio = 1.0f;
+		float m_Near = 0.1f;
+		float m_Far = 100.0f;
+
+		// What needs recalculating, PV following either
+		bool m_ViewDirty = true;
+		bool m_ProjectionDirty = true;
+		std::uint64_t m_Version = 0;
+
+		// Window whose framebuffer the aspect ratio follows, and its resize count when last followed
+		const Window* m_Window = nullptr;
+		std::uint64_t m_WindowResizeCount = 0;
 	};
 
 } // OORenderer
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "OORenderer/Window.h"
+#include "OORenderer/Camera.h"
+#include "OORenderer/ShaderProgram.h"
+#include "OORenderer/UniformBuffer.h"
+#include "OORenderer/Std140.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// Matrices and positions of several cameras in one uniform buffer, e.g. for split screen, shadow casting lights or mirrors.
+	/// Only cameras whose matrices changed since they were last published are written, in a single upload.
+	/// Any program declaring the block below, with N no more than the cameras held, has it bound to BlockBinding automatically when linked.
+	///
+	/// struct CameraData {
+	///     mat4 pvMatrix;
+	///     mat4 viewMatrix;
+	///     mat4 projectionMatrix;
+	///     vec4 cameraPosition;
+	/// };
+	/// layout(std140) uniform Cameras {
+	///     CameraData cameras[N];
+	/// };
+	/// </summary>
+	class CameraUniforms {
+	public: // Public static members
+		static constexpr GLuint BlockBinding = 1;
+		static constexpr ShaderProgram::UniformID BlockID = ShaderProgram::HashUniformName("Cameras");
+
+	public: // Public methods
+
+		/// <summary>
+		/// Create the camera uniform buffer for a window and bind it to BlockBinding
+		/// </summary>
+		/// <param name="window">Window whose programs will read these uniforms</param>
+		/// <param name="maxCameras">Number of cameras the buffer holds</param>
+		CameraUniforms(const Window& window, std::size_t maxCameras);
+
+		/// <summary>
+		/// Recalculate each camera's matrices and publish those that changed, camera i going to cameras[i]
+		/// </summary>
+		/// <param name="cameras">Cameras to publish, in slot order. Cameras beyond GetMaxCameras are left out</param>
+		/// <returns>Number of cameras written</returns>
+		std::size_t Update(std::span<Camera* const> cameras);
+
+		/// <summary>
+		/// Rebind the buffer to BlockBinding, only needed if something else has been bound there since
+		/// </summary>
+		void Bind();
+
+		/// <summary>
+		/// Get the number of cameras the buffer holds
+		/// </summary>
+		/// <returns>N in the block</returns>
+		std::size_t GetMaxCameras() const;
+
+	private: // Private objects
+		struct Offsets {
+			std::size_t PVMatrix;
+			std::size_t ViewMatrix;
+			std::size_t ProjectionMatrix;
+			std::size_t CameraPosition;
+			std::size_t Stride;
+		};
+
+		// Within one element of the array
+		static constexpr Offsets sm_Offsets = []() {
+			Std140::Layout layout;
+			Offsets offsets{};
+			offsets.PVMatrix = layout.Add<glm::mat4>();
+			offsets.ViewMatrix = layout.Add<glm::mat4>();
+			offsets.ProjectionMatrix = layout.Add<glm::mat4>();
+			offsets.CameraPosition = layout.Add<glm::vec4>();
+			offsets.Stride = layout.GetSize();
+			return offsets;
+		}();
+
+	private: // Private members
+		UniformBuffer m_Buffer;
+		std::vector<std::byte> m_Staging;
+
+		// Version of the camera each slot was last written from, 0 for never
+		std::vector<std::uint64_t> m_SlotVersions;
+	};
+
+} // OORenderer
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "OORenderer/Mesh.h"
+#include "OORenderer/ShaderProgram.h"
+#include "OORenderer/RenderQueue.h"
+
+namespace OORenderer {
+
+	class Model;
+
+	/// <summary>
+	/// Draws, uniform updates and uniform buffer binds recorded to be replayed later. Recording touches no OpenGL state, so any thread may
+	/// build a list while the thread owning the contexts replays lists built earlier. Give each worker its own list. Commands are POD
+	/// records packed into the list's own arena, which keeps its memory across Clear so lists reused every frame stop allocating.
+	/// Meshes, shader programs and buffers recorded must outlive the replay
+	/// </summary>
+	class CommandList {
+	public: // Public objects
+		enum class CommandType : std::uint8_t {
+			Draw,
+			SetView,
+			SetUniform,
+			BindUniformBuffer,
+			UploadTextures
+		};
+
+		/// <summary>
+		/// Types a recorded uniform may have
+		/// </summary>
+		enum class UniformType : std::uint8_t {
+			Int,
+			UInt,
+			Float,
+			Vec2,
+			Vec3,
+			Vec4,
+			Mat3,
+			Mat4
+		};
+
+	public: // Public methods
+		CommandList() = default;
+
+		/// <summary>
+		/// Record a draw of a mesh, queued on the render queue replayed into or drawn straight away without one
+		/// </summary>
+		/// <param name="mesh">Mesh to draw</param>
+		/// <param name="shader">Shader program to draw with</param>
+		/// <param name="modelMatrix">Set as the modelMatrix uniform for this draw</param>
+		/// <param name="lodLevel">Level of detail to draw</param>
+		/// <param name="pass">Pass to draw in</param>
+		void Draw(const Mesh& mesh, ShaderProgram& shader, const glm::mat4& modelMatrix, std::size_t lodLevel = 0, RenderPass pass = RenderPass::Opaque);
+
+		/// <summary>
+		/// Record the view draws after this are depth ordered by, see RenderQueue::SetView. Ignored without a render queue
+		/// </summary>
+		void SetView(const glm::mat4& viewMatrix);
+
+		/// <summary>
+		/// Record setting a uniform. Set when replayed, so draws replayed into a render queue see the last value set before it is flushed
+		/// </summary>
+		/// <param name="shader">Shader program owning the uniform</param>
+		/// <param name="uniformID">Hashed name of the uniform</param>
+		/// <param name="value">Value, one of int, unsigned int, float, glm::vec2, glm::vec3, glm::vec4, glm::mat3 or glm::mat4</param>
+		template<typename T>
+		void SetUniform(ShaderProgram& shader, ShaderProgram::UniformID uniformID, const T& value) {
+			UniformRecord record{ &shader, uniformID, GetUniformType<T>() };
+			std::byte* payload = AppendRecord(CommandType::SetUniform, sizeof(UniformRecord) + sizeof(T));
+			std::memcpy(payload, &record, sizeof(UniformRecord));
+			std::memcpy(payload + sizeof(UniformRecord), &value, sizeof(T));
+		}
+
+		/// <summary>
+		/// Record binding a range of a buffer to a uniform buffer binding point, e.g. uniforms written to a RingBuffer allocation
+		/// </summary>
+		/// <param name="window">Window whose context to bind on</param>
+		/// <param name="binding">Binding point</param>
+		/// <param name="bufferID">OpenGL buffer ID</param>
+		/// <param name="offset">Offset in bytes of the range, aligned to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT</param>
+		/// <param name="size">Size in bytes of the range</param>
+		void BindUniformBuffer(GLFWwindow* window, GLuint binding, unsigned int bufferID, std::size_t offset, std::size_t size);
+
+		/// <summary>
+		/// Record uploading a model's textures that have finished decoding, see Model::UploadDecodedTextures
+		/// </summary>
+		void UploadTextures(Model& model);
+
+		/// <summary>
+		/// Carry out every command in the order recorded, call from the thread owning the contexts. The previously active context is restored after
+		/// </summary>
+		/// <param name="queue">Queue to submit draws to, they are drawn straight away if null</param>
+		/// <returns>Number of commands replayed</returns>
+		std::size_t Replay(RenderQueue* queue = nullptr) const;
+
+		/// <summary>
+		/// Drop every command, keeping the arena's memory for the next recording
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Get the number of commands recorded
+		/// </summary>
+		std::size_t GetCommandCount() const;
+
+		/// <summary>
+		/// Get the bytes the recorded commands take up
+		/// </summary>
+		std::size_t GetSize() const;
+
+	public: // Public static methods
+
+		/// <summary>
+		/// Replay lists one after another, e.g. those built by each worker this frame
+		/// </summary>
+		/// <param name="lists">Lists to replay, in order</param>
+		/// <param name="queue">Queue to submit draws to, they are drawn straight away if null</param>
+		/// <returns>Number of commands replayed</returns>
+		static std::size_t ReplayAll(std::span<const CommandList> lists, RenderQueue* queue = nullptr);
+
+	private: // Private objects
+		// Precedes every record, Size being that of the payload following it
+		struct RecordHeader {
+			CommandType Type;
+			std::uint32_t Size;
+		};
+
+		struct DrawRecord {
+			const Mesh* DrawnMesh;
+			ShaderProgram* Shader;
+			glm::mat4 ModelMatrix;
+			std::uint32_t LODLevel;
+			RenderPass Pass;
+		};
+
+		// Followed by the value
+		struct UniformRecord {
+			ShaderProgram* Shader;
+			ShaderProgram::UniformID ID;
+			UniformType Type;
+		};
+
+		struct BindUniformBufferRecord {
+			GLFWwindow* Window;
+			GLuint Binding;
+			unsigned int BufferID;
+			std::size_t Offset;
+			std::size_t Size;
+		};
+
+	private: // Private methods
+		// Room for a record with the given payload size, returning where to write the payload
+		std::byte* AppendRecord(CommandType type, std::size_t payloadSize);
+
+	private: // Private static methods
+		static void ReplayUniform(const std::byte* payload);
+
+		template<typename T>
+		static constexpr UniformType GetUniformType() {
+			if constexpr (std::is_same_v<T, int>) { return UniformType::Int; }
+			else if constexpr (std::is_same_v<T, unsigned int>) { return UniformType::UInt; }
+			else if constexpr (std::is_same_v<T, float>) { return UniformType::Float; }
+			else if constexpr (std::is_same_v<T, glm::vec2>) { return UniformType::Vec2; }
+			else if constexpr (std::is_same_v<T, glm::vec3>) { return UniformType::Vec3; }
+			else if constexpr (std::is_same_v<T, glm::vec4>) { return UniformType::Vec4; }
+			else if constexpr (std::is_same_v<T, glm::mat3>) { return UniformType::Mat3; }
+			else if constexpr (std::is_same_v<T, glm::mat4>) { return UniformType::Mat4; }
+			else { static_assert(sizeof(T) == 0, "Unsupported uniform type"); }
+		}
+
+	private: // Private members
+		std::vector<std::byte> m_Arena;
+		std::size_t m_CommandCount = 0;
+	};
+
+} // OORenderer
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "OORenderer/Window.h"
+#include "OORenderer/Camera.h"
+#include "OORenderer/ShaderProgram.h"
+#include "OORenderer/UniformBuffer.h"
+#include "OORenderer/RingBuffer.h"
+#include "OORenderer/Std140.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// Per frame camera and global values, written once per frame into a uniform buffer shared by every program on a window.
+	/// Any program declaring the block below has it bound to BlockBinding automatically when linked.
+	///
+	/// layout(std140) uniform FrameUniforms {
+	///     mat4 pvMatrix;
+	///     mat4 viewMatrix;
+	///     mat4 projectionMatrix;
+	///     vec4 cameraPosition;
+	///     float time;
+	/// };
+	/// </summary>
+	class FrameUniforms {
+	public: // Public static members
+		static constexpr GLuint BlockBinding = 0;
+		static constexpr ShaderProgram::UniformID BlockID = ShaderProgram::HashUniformName("FrameUniforms");
+
+	public: // Public methods
+
+		/// <summary>
+		/// Create the frame uniform buffer for a window and bind it to BlockBinding
+		/// </summary>
+		/// <param name="window">Window whose programs will read these uniforms</param>
+		FrameUniforms(const Window& window);
+
+		/// <summary>
+		/// Write this frame's values, call once per frame before rendering
+		/// </summary>
+		/// <param name="camera">Camera to take the matrices and position from, RecalculateMatrices first</param>
+		/// <param name="time">Time value to expose to shaders, e.g. glfwGetTime()</param>
+		void Update(const Camera& camera, float time = 0.0f);
+
+		/// <summary>
+		/// Write this frame's values to a ring buffer on the same window and bind them to BlockBinding in place of our own buffer,
+		/// so the write needn't wait on frames still reading the last values. Falls back to our own buffer if the ring's frame is full
+		/// </summary>
+		/// <param name="camera">Camera to take the matrices and position from, RecalculateMatrices first</param>
+		/// <param name="time">Time value to expose to shaders, e.g. glfwGetTime()</param>
+		/// <param name="ring">Ring buffer to write to, it must not move to its next frame before this frame's draws</param>
+		void Update(const Camera& camera, float time, RingBuffer& ring);
+
+		/// <summary>
+		/// Rebind the buffer to BlockBinding, only needed if something else has been bound there since
+		/// </summary>
+		void Bind();
+
+	private: // Private objects
+		struct Offsets {
+			std::size_t PVMatrix;
+			std::size_t ViewMatrix;
+			std::size_t ProjectionMatrix;
+			std::size_t CameraPosition;
+			std::size_t Time;
+			std::size_t Size;
+		};
+
+		static constexpr Offsets sm_Offsets = []() {
+			Std140::Layout layout;
+			Offsets offsets{};
+			offsets.PVMatrix = layout.Add<glm::mat4>();
+			offsets.ViewMatrix = layout.Add<glm::mat4>();
+			offsets.ProjectionMatrix = layout.Add<glm::mat4>();
+			offsets.CameraPosition = layout.Add<glm::vec4>();
+			offsets.Time = layout.Add<float>();
+			offsets.Size = layout.GetSize();
+			return offsets;
+		}();
+
+	private: // Private methods
+		void WriteStaging(const Camera& camera, float time);
+
+	private: // Private members
+		UniformBuffer m_Buffer;
+		std::array<std::byte, sm_Offsets.Size> m_Staging{};
+	};
+
+} // OORenderer
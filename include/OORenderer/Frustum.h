@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "OORenderer/Bounds.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// View frustum as six planes facing inwards, for culling bounds that can't be seen.
+	/// Batched tests use AVX when built with OORENDERER_ENABLE_AVX, else SSE where available
+	/// </summary>
+	class Frustum {
+	public: // Public methods
+
+		/// <summary>
+		/// Extract the frustum of a projection, e.g. Camera::GetPVMatrix() for a world space frustum,
+		/// or that times a model matrix for one in the model's space
+		/// </summary>
+		/// <param name="pvMatrix">Matrix taking points into clip space</param>
+		Frustum(const glm::mat4& pvMatrix);
+
+		/// <summary>
+		/// Might anything in the sphere be visible
+		/// </summary>
+		bool Intersects(const BoundingSphere& sphere) const;
+
+		/// <summary>
+		/// Might anything in the box be visible
+		/// </summary>
+		bool Intersects(const AABB& box) const;
+
+		/// <summary>
+		/// Test many spheres at once
+		/// </summary>
+		/// <param name="spheres">Spheres to test</param>
+		/// <param name="visibleIndices">Indices into spheres of those that might be visible are appended here, in order</param>
+		void Cull(std::span<const BoundingSphere> spheres, std::vector<std::uint32_t>& visibleIndices) const;
+
+		/// <summary>
+		/// Get the planes, left, right, bottom, top, near, far. xyz is the inward unit normal, w the distance along it from the origin
+		/// </summary>
+		const std::array<glm::vec4, 6>& GetPlanes() const;
+
+	private: // Private members
+		std::array<glm::vec4, 6> m_Planes;
+	};
+
+} // OORenderer
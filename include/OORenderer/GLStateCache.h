@@ -0,0 +1,167 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+namespace OORenderer {
+
+	/// <summary>
+	/// Shadow of what a context has bound: program, VAO, buffers, texture units, samplers and capabilities.
+	/// OORenderer binds through the cache of the current context, so binds that would change nothing never reach the driver and nothing
+	/// is unbound afterwards. Each Window owns the cache of its context, made current along with it by Window::ActivateGLFWWindow.
+	/// OpenGL calls made by the application that change what is tracked here must go through the cache, or be followed by Invalidate
+	/// </summary>
+	class GLStateCache {
+	public: // Public objects
+
+		/// <summary>
+		/// Calls that reached the driver and calls dropped as they would change nothing
+		/// </summary>
+		struct Counter {
+			std::size_t Issued = 0;
+			std::size_t Skipped = 0;
+		};
+
+		struct Stats {
+			Counter Programs;
+			Counter VertexArrays;
+			Counter Buffers;
+			Counter Textures; // Including active texture unit changes
+			Counter Samplers;
+			Counter Capabilities;
+
+			std::size_t GetIssued() const;
+			std::size_t GetSkipped() const;
+		};
+
+	public: // Public static methods
+
+		/// <summary>
+		/// Get the cache of the context current on the calling thread. Contexts not created by a Window share one cache per thread,
+		/// invalidated whenever one is made current
+		/// </summary>
+		static GLStateCache& Current();
+
+		/// <summary>
+		/// Forget a buffer about to be deleted on every context of a window's share group, its name may be handed out again
+		/// while contexts other than the current one still have the old buffer bound.
+		/// Caches of other contexts, which may be in use on render threads, forget it when next made current or before their next frame
+		/// </summary>
+		/// <param name="window">Window the buffer was created on</param>
+		/// <param name="buffer">OpenGL buffer ID</param>
+		static void ForgetBuffer(GLFWwindow* window, GLuint buffer);
+
+		/// <summary>
+		/// Forget a texture about to be deleted on every context of a window's share group, as ForgetBuffer
+		/// </summary>
+		/// <param name="window">Window of the share group the texture was created on</param>
+		/// <param name="texture">OpenGL texture ID</param>
+		static void ForgetTexture(GLFWwindow* window, GLuint texture);
+
+	public: // Public methods
+		GLStateCache();
+
+		void UseProgram(GLuint program);
+		void BindVertexArray(GLuint vertexArray);
+
+		/// <summary>
+		/// Bind a buffer to a target. GL_ELEMENT_ARRAY_BUFFER belongs to the bound VAO so is always issued
+		/// </summary>
+		void BindBuffer(GLenum target, GLuint buffer);
+		void BindBufferBase(GLenum target, GLuint index, GLuint buffer);
+		void BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+
+		/// <summary>
+		/// Bind a texture to a texture unit, making it the active unit if need be
+		/// </summary>
+		/// <param name="unit">Texture unit, 0 for GL_TEXTURE0</param>
+		/// <param name="target">Texture target, e.g. GL_TEXTURE_2D</param>
+		/// <param name="texture">OpenGL texture ID</param>
+		void BindTexture(GLuint unit, GLenum target, GLuint texture);
+
+		/// <summary>
+		/// Bind a texture to whichever unit is active, for editing it rather than sampling it
+		/// </summary>
+		void BindTexture(GLenum target, GLuint texture);
+
+		void BindSampler(GLuint unit, GLuint sampler);
+
+		/// <summary>
+		/// glEnable or glDisable a capability, e.g. GL_BLEND
+		/// </summary>
+		void SetEnabled(GLenum capability, bool enabled);
+
+		/// <summary>
+		/// Forget everything tracked, so the next bind of each is issued. Call after changing bindings without the cache
+		/// </summary>
+		void Invalidate();
+
+		/// <summary>
+		/// Get the counters of the frame in progress
+		/// </summary>
+		const Stats& GetStats() const;
+
+		/// <summary>
+		/// Get the counters of the last frame finished, frames ending at each Window::UpdateDisplay
+		/// </summary>
+		const Stats& GetFrameStats() const;
+
+	private: // Private objects
+		// Bound to a unit, by s_TextureTargets
+		struct TextureUnit {
+			std::array<GLuint, 3> Textures;
+			GLuint Sampler;
+		};
+
+		struct IndexedBuffer {
+			GLuint Buffer;
+			GLintptr Offset;
+			GLsizeiptr Size;
+		};
+
+	private: // Private methods
+		friend class Window;
+
+		void EndFrame();
+		void ForgetBufferName(GLuint buffer);
+		void ForgetTextureName(GLuint texture);
+
+		// Forget a name from another thread, applied by ApplyForgottenNames on the thread using this cache
+		void QueueForgetName(GLuint name, bool texture);
+		void ApplyForgottenNames();
+		void SetActiveUnit(GLuint unit);
+		TextureUnit& GetUnit(GLuint unit);
+
+	private: // Private static methods
+		// Forget a buffer or texture name on every cache of a window's share group
+		static void ForgetOnShareGroup(GLFWwindow* window, GLuint name, bool texture);
+
+		// Make a cache current on the calling thread, nullptr for a context not created by a Window
+		static void SetCurrent(GLStateCache* cache);
+
+	private: // Private members
+		GLuint m_Program;
+		GLuint m_VertexArray;
+		std::array<GLuint, 8> m_Buffers;
+		std::vector<IndexedBuffer> m_UniformBuffers;
+		GLuint m_ActiveUnit;
+		std::vector<TextureUnit> m_Units;
+		std::array<std::int8_t, 8> m_Capabilities; // -1 unknown, else enabled or not
+
+		Stats m_Stats;
+		Stats m_FrameStats;
+
+		// Buffers and textures deleted by other threads since this cache was last used
+		std::mutex m_ForgottenMutex;
+		std::vector<GLuint> m_ForgottenBuffers;
+		std::vector<GLuint> m_ForgottenTextures;
+		std::atomic<bool> m_HasForgottenNames = false;
+	};
+
+} // OORenderer
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "OORenderer/ShareGroup.h"
+#include "OORenderer/VertexLayout.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// Large vertex and index buffers shared by many static meshes, so drawing them needs no buffer or VAO changes between meshes.
+	/// Each share group has blocks per vertex layout and index type, each block one VAO per window. Meshes are addressed by
+	/// base vertex and first index. Space is never reclaimed, the pool is for geometry that stays loaded. See Mesh::EnableGeometryPooling
+	/// </summary>
+	class GeometryPool {
+	public: // Public objects
+		struct Block {
+			const VertexLayoutDescription* Layout = nullptr;
+			GLenum IndexType = GL_UNSIGNED_INT;
+
+			unsigned int VBO = 0;
+			unsigned int EBO = 0;
+			std::size_t VertexCapacity = 0;
+			std::size_t IndexCapacity = 0;
+			std::size_t VertexCount = 0;
+			std::size_t IndexCount = 0;
+
+			std::map<GLFWwindow*, unsigned int> WindowVAOIDs;
+
+			// Accounts for the buffers' memory
+			std::shared_ptr<void> Tracking;
+		};
+
+		/// <summary>
+		/// Where a mesh lives in the pool
+		/// </summary>
+		struct Range {
+			Block* PoolBlock = nullptr;
+			std::uint32_t BaseVertex = 0;
+			std::uint32_t FirstIndex = 0;
+		};
+
+	public: // Public static methods
+
+		/// <summary>
+		/// Find room for a mesh in a block of the window's share group, creating a block if none has room.
+		/// Expects the window's context to be active
+		/// </summary>
+		/// <param name="window">Window the mesh is being registered on</param>
+		/// <param name="layout">Layout the vertices are uploaded in</param>
+		/// <param name="indexType">GL_UNSIGNED_SHORT or GL_UNSIGNED_INT</param>
+		/// <param name="vertexCount">Number of vertices to make room for</param>
+		/// <param name="indexCount">Number of indices to make room for</param>
+		/// <returns>The room found, for the caller to upload into</returns>
+		static Range Allocate(GLFWwindow* window, const VertexLayoutDescription& layout, GLenum indexType, std::size_t vertexCount, std::size_t indexCount);
+
+		/// <summary>
+		/// Get a block's VAO on a window, created the first time it's asked for. Expects the window's context to be active
+		/// </summary>
+		static unsigned int GetVAOID(Block& block, GLFWwindow* window);
+
+		/// <summary>
+		/// Forget a window's VAOs, called as the window closes since they go with its context
+		/// </summary>
+		/// <param name="shareGroupID">ID of the window's share group</param>
+		/// <param name="window">Window closing</param>
+		static void ForgetWindow(ShareGroup::ID shareGroupID, GLFWwindow* window);
+
+		/// <summary>
+		/// Free a share group's blocks, called as the group is destroyed since its buffers went with its last context
+		/// </summary>
+		/// <param name="shareGroupID">ID of the share group destroyed</param>
+		static void ReleaseShareGroup(ShareGroup::ID shareGroupID);
+
+		/// <summary>
+		/// Set the size in bytes of the vertex and of the index buffer of blocks created from now on. Default: 32 MiB.
+		/// Meshes too big for a block get one of their own
+		/// </summary>
+		static void SetBlockSize(std::size_t bytes);
+
+		/// <summary>
+		/// Get the number of blocks across every share group
+		/// </summary>
+		static std::size_t GetBlockCount();
+
+	private: // Private static members
+		inline static std::map<ShareGroup::ID, std::vector<std::unique_ptr<Block>>> sm_Blocks{};
+		inline static std::size_t sm_BlockSize = 32 * 1024 * 1024;
+	};
+
+} // OORenderer
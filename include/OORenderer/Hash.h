@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace OORenderer {
+
+	// FNV-1a, small and constexpr so names may be hashed at compile time. Not for anything adversarial.
+
+	inline constexpr std::uint32_t FNV1a32OffsetBasis = 2166136261u;
+	inline constexpr std::uint64_t FNV1a64OffsetBasis = 14695981039346656037ull;
+
+	/// <summary>
+	/// 32 bit FNV-1a hash of a string
+	/// </summary>
+	/// <param name="data">String to hash</param>
+	/// <param name="hash">Hash to continue from, allows hashing in pieces</param>
+	/// <returns>Hash of the string</returns>
+	constexpr std::uint32_t HashFNV1a32(std::string_view data, std::uint32_t hash = FNV1a32OffsetBasis) {
+		for (char c : data) {
+			hash ^= static_cast<std::uint8_t>(c);
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	/// <summary>
+	/// 64 bit FNV-1a hash of a string
+	/// </summary>
+	/// <param name="data">String to hash</param>
+	/// <param name="hash">Hash to continue from, allows hashing in pieces</param>
+	/// <returns>Hash of the string</returns>
+	constexpr std::uint64_t HashFNV1a64(std::string_view data, std::uint64_t hash = FNV1a64OffsetBasis) {
+		for (char c : data) {
+			hash ^= static_cast<std::uint8_t>(c);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	/// <summary>
+	/// 64 bit FNV-1a hash of a block of memory
+	/// </summary>
+	/// <param name="data">Start of the memory to hash</param>
+	/// <param name="size">Size in bytes of the memory to hash</param>
+	/// <param name="hash">Hash to continue from, allows hashing in pieces</param>
+	/// <returns>Hash of the memory</returns>
+	inline std::uint64_t HashFNV1a64(const void* data, std::size_t size, std::uint64_t hash = FNV1a64OffsetBasis) {
+		return HashFNV1a64(std::string_view{ static_cast<const char*>(data), size }, hash);
+	}
+
+} // OORenderer
@@ -3,11 +3,21 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <memory>
+#include <span>
+#include <optional>
+#include <cstdint>
 
 #include <glm/glm.hpp>
 
+#include "OORenderer/Hash.h"
 #include "OORenderer/ShaderProgram.h"
 #include "OORenderer/Texture.h"
+#include "OORenderer/ShareGroup.h"
+#include "OORenderer/Residency.h"
+#include "OORenderer/VertexLayout.h"
+#include "OORenderer/Bounds.h"
+#include "OORenderer/GeometryPool.h"
 
 namespace OORenderer {
 
@@ -16,29 +26,233 @@ namespace OORenderer {
 	public: // Public objects
 
 		/// <summary>
-		/// Vertex data, this is the layout we pass to shaders
+		/// Vertex data, full precision. What reaches shaders depends on the mesh's vertex layout
 		/// </summary>
-		struct Vertex {
-			glm::vec3 Position;
-			glm::vec3 Normal;
-			glm::vec2 TexCoords;
+		using Vertex = StandardVertex;
+
+		/// <summary>
+		/// A level of detail, a range of the index data drawn over the same vertices as every other level
+		/// </summary>
+		struct LODLevel {
+			std::uint32_t FirstIndex;
+			std::uint32_t IndexCount;
+			float Error; // Roughly how far this level strays from the full detail surface, in model space
 		};
 
+	public: // Public static methods
+
+		/// <summary>
+		/// Place meshes in the shared buffers of a GeometryPool, rather than buffers of their own, when first registered on a share group.
+		/// Meshes of a pool block share one VAO, so the render queue draws runs of them with one multi draw indirect call where GL 4.3 is available.
+		/// For static geometry, pooled space isn't reclaimed
+		/// </summary>
+		static void EnableGeometryPooling();
+
+		static void DisableGeometryPooling();
+
 	public: // Public methods
 
-		Mesh(std::vector<Vertex> vertexData, std::vector<unsigned int> indices, std::map<std::string, std::shared_ptr<Texture>> textureBindingMap);
+		/// <param name="lodLevels">Levels of detail, most detailed first. Empty for a single level drawing every index</param>
+		Mesh(std::vector<Vertex> vertexData, std::vector<unsigned int> indices, std::map<std::string, std::shared_ptr<Texture>> textureBindingMap, std::vector<LODLevel> lodLevels = {});
 		Mesh(const Window& window, std::vector<Vertex> vertexData, std::vector<unsigned int> indices, std::map<std::string, std::shared_ptr<Texture>> textureBindingMap);
-		void Render(ShaderProgram& shader) const;
+
+		/// <summary>
+		/// Construct a mesh over vertex and index data owned by something else, e.g. a memory mapped cache file.
+		/// The data is uploaded as is, no copy is made.
+		/// </summary>
+		/// <param name="dataBacking">Owner of the data, kept alive for as long as this mesh needs the data</param>
+		/// <param name="vertexData">Vertex data</param>
+		/// <param name="indices">Index data</param>
+		/// <param name="textureBindingMap">Map from sampler name to texture</param>
+		/// <param name="lodLevels">Levels of detail, most detailed first. Empty for a single level drawing every index</param>
+		Mesh(std::shared_ptr<const void> dataBacking, std::span<const Vertex> vertexData, std::span<const unsigned int> indices, std::map<std::string, std::shared_ptr<Texture>> textureBindingMap, std::vector<LODLevel> lodLevels = {});
+
+		/// <summary>
+		/// Render this mesh using the provided shader, with whatever modelMatrix uniform it has set.
+		/// Instanced programs have no such uniform so aren't drawn, use the overload taking a model matrix
+		/// </summary>
+		/// <param name="lodLevel">Level of detail to draw, clamped to the least detailed level this mesh has</param>
+		void Render(ShaderProgram& shader, std::size_t lodLevel = 0) const;
+
+		/// <summary>
+		/// Render this mesh using the provided shader and model matrix.
+		/// Instanced programs read the matrix, and our texture layers, from their instance attributes held constant for the draw
+		/// </summary>
+		/// <param name="modelMatrix">Set as the modelMatrix uniform, or the instanceModelMatrix attribute of instanced programs</param>
+		/// <param name="lodLevel">Level of detail to draw, clamped to the least detailed level this mesh has</param>
+		void Render(ShaderProgram& shader, const glm::mat4& modelMatrix, std::size_t lodLevel = 0) const;
 		void RegisterOnGLFWWindow(GLFWwindow* window);
 		void RegisterOnWindow(const Window& window);
 
+		/// <summary>
+		/// Get this mesh's vertex data
+		/// </summary>
+		/// <returns>View of the vertex data</returns>
+		std::span<const Vertex> GetVertexData() const;
+
+		/// <summary>
+		/// Get this mesh's index data
+		/// </summary>
+		/// <returns>View of the index data</returns>
+		std::span<const unsigned int> GetIndices() const;
+
+		/// <summary>
+		/// Get the textures this mesh binds when rendered. A texture in a TextureArrayPool array binds the array to its sampler instead,
+		/// and its layer is set as the uniform of the sampler's name followed by Layer, e.g. DiffuseTexture1Layer
+		/// </summary>
+		/// <returns>Map from sampler name to texture</returns>
+		const std::map<std::string, std::shared_ptr<Texture>>& GetTextureBindingMap() const;
+
+		/// <summary>
+		/// Get this mesh's levels of detail, most detailed first. There is always at least one
+		/// </summary>
+		const std::vector<LODLevel>& GetLODLevels() const;
+
+		/// <summary>
+		/// Set what to do with this mesh's vertex and index data once uploaded, overriding the default policy.
+		/// A mesh can't reload its own data, ReloadOnDemand relies on its owner calling RestoreData, as Model does
+		/// </summary>
+		void SetResidencyPolicy(ResidencyPolicy policy);
+
+		/// <summary>
+		/// Get the policy this mesh follows, its own or the default
+		/// </summary>
+		ResidencyPolicy GetResidencyPolicy() const;
+
+		/// <summary>
+		/// Is the vertex and index data held CPU side
+		/// </summary>
+		bool IsDataResident() const;
+
+		/// <summary>
+		/// Would registering on this window need the vertex and index data, i.e. nothing has been uploaded to its share group yet
+		/// </summary>
+		bool NeedsDataFor(GLFWwindow* window) const;
+
+		/// <summary>
+		/// Choose the layout vertices are uploaded in, before registering on any window. Default: StandardVertexLayout
+		/// </summary>
+		template<typename TLayout>
+		void SetVertexLayout() {
+			SetVertexLayout(TLayout::Describe());
+		}
+
+		/// <summary>
+		/// Choose the layout vertices are uploaded in, before registering on any window
+		/// </summary>
+		void SetVertexLayout(const VertexLayoutDescription& layout);
+
+		/// <summary>
+		/// Get the box and sphere bounding this mesh, in model space
+		/// </summary>
+		const Bounds& GetBounds() const;
+
+		/// <summary>
+		/// Get the bounds of this mesh's vertex positions, as quantized positions are stored relative to
+		/// </summary>
+		const PositionBounds& GetPositionBounds() const;
+
+		/// <summary>
+		/// Get the matrix taking quantized positions back to model space, identity unless the vertex layout quantizes positions.
+		/// Rendering sets it as the positionDequantization uniform when the shader has one
+		/// </summary>
+		glm::mat4 GetPositionDequantization() const;
+
+		/// <summary>
+		/// Give back vertex and index data dropped after upload, it must match what was dropped
+		/// </summary>
+		/// <param name="dataBacking">Owner of the data</param>
+		/// <param name="vertexData">Vertex data</param>
+		/// <param name="indices">Index data</param>
+		void RestoreData(std::shared_ptr<const void> dataBacking, std::span<const Vertex> vertexData, std::span<const unsigned int> indices);
+
+	private: // Private objects
+		// Backing for meshes that own their data
+		struct OwnedData;
+
+		struct GroupBuffers {
+			unsigned int VBO = 0;
+			unsigned int EBO = 0;
+
+			// Accounts for the buffers' memory
+			std::shared_ptr<void> Tracking;
+
+			// Where in the pool, for pooled meshes, which have no buffers of their own
+			GeometryPool::Range Pooled;
+		};
+
+		// Arguments of an indexed draw of one level of detail
+		struct DrawRange {
+			GLsizei IndexCount;
+			std::uint32_t FirstIndex; // Into the element buffer, pooled or not
+			GLint BaseVertex;
+		};
+
+	private: // Private methods
+		Mesh(std::shared_ptr<const OwnedData> ownedData, std::map<std::string, std::shared_ptr<Texture>> textureBindingMap, std::vector<LODLevel> lodLevels);
+
+		void SetData(std::shared_ptr<const void> dataBacking, std::span<const Vertex> vertexData, std::span<const unsigned int> indices);
+		void DropData();
+
+		// Write our vertices and indices into buffers at the given element offsets, in our layout and index type
+		void UploadData(unsigned int VBO, std::size_t baseVertex, unsigned int EBO, std::size_t firstIndex) const;
+
+		// Shared by both Render overloads, modelMatrix null if the caller has set the uniform
+		void RenderWithModelMatrix(ShaderProgram& shader, const glm::mat4* modelMatrix, std::size_t lodLevel) const;
+
+		// The steps of Render, for RenderQueue to skip those it has already done. Expect the shader's context to be active
+		unsigned int GetVAOID(GLFWwindow* window) const; // 0 if not registered on the window
+		void BindTextures(ShaderProgram& shader) const;
+		void SetMeshUniforms(ShaderProgram& shader) const;
+		DrawRange GetDrawRange(GLFWwindow* window, std::size_t lodLevel) const;
+		bool IsPooledOn(GLFWwindow* window) const;
+
+		// Identifies the textures bound and where, meshes with equal keys needn't rebind textures between draws.
+		// Textures pooled in the same array count as equal, so meshes differing only in layers share a key
+		std::uint64_t GetMaterialKey(GLFWwindow* window) const;
+
+		// Layers of the first four textures by sampler name, 0 for those not pooled
+		glm::uvec4 GetTextureLayers(GLFWwindow* window) const;
+		void Draw(GLFWwindow* window, std::size_t lodLevel, GLsizei instanceCount = 1) const; // With our VAO bound
+
 	private:
 		// For each window this mesh is registered on, return the VAO ID associated with this mesh
 		std::map<GLFWwindow*, unsigned int> m_WindowVAOIDMap{};
 
-		std::vector<Vertex> m_VertexData;
-		std::vector<unsigned int> m_Indices;
+		// Vertex and index buffers, uploaded once per share group and referenced by each window's VAO
+		std::map<ShareGroup::ID, GroupBuffers> m_GroupBuffers{};
+
+		// Where we are in the pool for each window we're registered on, empty unless pooled
+		std::map<GLFWwindow*, GeometryPool::Range> m_WindowPoolRanges{};
+
+		// Whatever owns the memory our vertex and index views point into
+		std::shared_ptr<const void> m_DataBacking;
+		std::span<const Vertex> m_VertexData;
+		std::span<const unsigned int> m_Indices;
+		std::shared_ptr<void> m_DataTracking;
+
+		// Kept separately as the data itself may be dropped
+		std::size_t m_VertexCount = 0;
+		std::size_t m_IndexCount = 0;
+		Bounds m_Bounds;
+		PositionBounds m_PositionBounds;
+		std::vector<LODLevel> m_LODLevels;
+
+		// How vertices and indices are laid out on the GPU, indices are 16 bit whenever the vertex count allows
+		const VertexLayoutDescription* m_VertexLayout = &StandardVertexLayout::Describe();
+		GLenum m_IndexType = GL_UNSIGNED_INT;
+
+		std::optional<ResidencyPolicy> m_ResidencyPolicy;
 		std::map<std::string, std::shared_ptr<Texture>> m_TextureBindingMap;
+
+		// Hashed sampler names of m_TextureBindingMap and of their layer uniforms, in the same order, so rendering needn't hash strings
+		std::vector<ShaderProgram::UniformID> m_TextureBindingIDs;
+		std::vector<ShaderProgram::UniformID> m_TextureLayerIDs;
+
+		friend class RenderQueue;
+
+	private: // Private static members
+		inline static bool sm_PoolGeometry = false;
 	};
 
 } // OORenderer
\ No newline at end of file
@@ -10,6 +10,9 @@
 #include "OORenderer/ShaderProgram.h"
 #include "OORenderer/Mesh.h"
 #include "OORenderer/Texture.h"
+#include "OORenderer/Frustum.h"
+#include "OORenderer/RenderQueue.h"
+#include "OORenderer/CommandList.h"
 
 namespace OORenderer {
 
@@ -23,10 +26,57 @@ namespace OORenderer {
 		Model(std::filesystem::path path);
 
 		/// <summary>
-		/// Render this model using the provided shader
+		/// Render this model using the provided shader. Uploads any textures that have finished decoding since the last render,
+		/// so call WaitForTextures first when rendering from more than one thread at once
 		/// </summary>
 		/// <param name="shader">Shader program to render this model with</param>
-		void Render(ShaderProgram& shader);
+		/// <param name="lodLevel">Level of detail to draw, meshes with fewer levels draw their least detailed</param>
+		/// <param name="frustum">Frustum in this model's space, meshes outside it aren't drawn. Null draws every mesh</param>
+		void Render(ShaderProgram& shader, std::size_t lodLevel = 0, const Frustum* frustum = nullptr);
+
+		/// <summary>
+		/// Render this model using the provided shader and model matrix, which instanced programs may be drawn with, see Mesh::Render
+		/// </summary>
+		/// <param name="shader">Shader program to render this model with</param>
+		/// <param name="modelMatrix">Set as the modelMatrix uniform, or the instanceModelMatrix attribute of instanced programs</param>
+		/// <param name="lodLevel">Level of detail to draw, meshes with fewer levels draw their least detailed</param>
+		/// <param name="frustum">Frustum in this model's space, meshes outside it aren't drawn. Null draws every mesh</param>
+		void Render(ShaderProgram& shader, const glm::mat4& modelMatrix, std::size_t lodLevel = 0, const Frustum* frustum = nullptr);
+
+		/// <summary>
+		/// Add this model's meshes to a render queue, drawn when it is flushed. Uploads any textures that have finished decoding since the last render
+		/// </summary>
+		/// <param name="queue">Queue to add the draws to</param>
+		/// <param name="shader">Shader program to render this model with</param>
+		/// <param name="modelMatrix">Set as the modelMatrix uniform for each draw</param>
+		/// <param name="lodLevel">Level of detail to draw, meshes with fewer levels draw their least detailed</param>
+		/// <param name="frustum">Frustum in this model's space, meshes outside it aren't queued. Null queues every mesh</param>
+		/// <param name="pass">Pass to draw in</param>
+		void Submit(RenderQueue& queue, ShaderProgram& shader, const glm::mat4& modelMatrix, std::size_t lodLevel = 0, const Frustum* frustum = nullptr, RenderPass pass = RenderPass::Opaque);
+
+		/// <summary>
+		/// Record draws of this model's meshes to a command list, as Submit would queue them. Touches no OpenGL state so may run on any thread,
+		/// while textures are still decoding the upload of those finished is recorded too
+		/// </summary>
+		/// <param name="commands">List to record the draws to</param>
+		/// <param name="shader">Shader program to render this model with</param>
+		/// <param name="modelMatrix">Set as the modelMatrix uniform for each draw</param>
+		/// <param name="lodLevel">Level of detail to draw, meshes with fewer levels draw their least detailed</param>
+		/// <param name="frustum">Frustum in this model's space, meshes outside it aren't recorded. Null records every mesh</param>
+		/// <param name="pass">Pass to draw in</param>
+		void Record(CommandList& commands, ShaderProgram& shader, const glm::mat4& modelMatrix, std::size_t lodLevel = 0, const Frustum* frustum = nullptr, RenderPass pass = RenderPass::Opaque);
+
+		/// <summary>
+		/// Upload any textures that have finished decoding, textures are decoded in the background after construction.
+		/// Does nothing once every texture is uploaded
+		/// </summary>
+		/// <returns>True once every texture is uploaded</returns>
+		bool UploadDecodedTextures();
+
+		/// <summary>
+		/// Block until every texture has decoded, then upload them all
+		/// </summary>
+		void WaitForTextures();
 
 		/// <summary>
 		/// Register this model for renderering on a given window - this allows us to only load a model once for use on multiple windows
@@ -40,30 +90,130 @@ namespace OORenderer {
 		/// <param name="window">Window to register to</param>
 		void RegisterOnWindow(const Window& window);
 
+		/// <summary>
+		/// Set the residency policy of this model's meshes and textures. Textures may be shared with other models,
+		/// which then follow the policy too. With ReloadOnDemand meshes are reloaded from the mesh cache if enabled, else imported again
+		/// </summary>
+		void SetResidencyPolicy(ResidencyPolicy policy);
+
+		/// <summary>
+		/// Choose the layout this model's vertices are uploaded in, before registering on any window. Default: StandardVertexLayout
+		/// </summary>
+		template<typename TLayout>
+		void SetVertexLayout() {
+			for (auto& mesh : m_Meshes) {
+				mesh.SetVertexLayout<TLayout>();
+			}
+		}
+
+		/// <summary>
+		/// Get the number of levels of detail of this model's most detailed mesh, 1 unless generated on import
+		/// </summary>
+		std::size_t GetLODCount() const;
+
+		/// <summary>
+		/// Get roughly how far a level of detail strays from the full detail model, in model space. Never less than any more detailed level
+		/// </summary>
+		float GetLODError(std::size_t lodLevel) const;
+
+		/// <summary>
+		/// Get the box and sphere bounding every mesh, in model space
+		/// </summary>
+		const Bounds& GetBounds() const;
+
+	public: // Public Static Methods
+
+		/// <summary>
+		/// Cache imported models in the given directory. Later loads of an unchanged model map the cached vertex and index data
+		/// straight from disk rather than going through Assimp again
+		/// </summary>
+		/// <param name="directory">Directory to keep cache files in</param>
+		static void EnableMeshCache(std::filesystem::path directory);
+
+		/// <summary>
+		/// Stop using the mesh cache, models are always imported
+		/// </summary>
+		static void DisableMeshCache();
+
+		/// <summary>
+		/// Reorder the triangles and vertices of models imported from now on for vertex cache locality, less overdraw and vertex fetch locality.
+		/// Vertex cache efficiency before and after is traced for each mesh
+		/// </summary>
+		static void EnableMeshOptimization();
+
+		/// <summary>
+		/// Keep triangles and vertices of models imported from now on in the order Assimp gives them
+		/// </summary>
+		static void DisableMeshOptimization();
+
+		/// <summary>
+		/// Generate levels of detail for models imported from now on, by simplifying each mesh. Levels are cached with the meshes
+		/// </summary>
+		/// <param name="levelCount">Number of levels including full detail</param>
+		/// <param name="reduction">Fraction of the previous level's triangles each level aims to keep</param>
+		static void EnableLODGeneration(std::size_t levelCount = 4, float reduction = 0.5f);
+
+		/// <summary>
+		/// Import models with full detail only
+		/// </summary>
+		static void DisableLODGeneration();
+
+	private: // Private Objects
+		struct ASSIMPGeometry {
+			std::vector<Mesh::Vertex> Vertices;
+			std::vector<unsigned int> Indices;
+			std::vector<Mesh::LODLevel> LODLevels;
+		};
+
+		// Options changing what an import produces, fixed per model when it loads
+		struct ImportOptions {
+			bool Optimize = false;
+			std::size_t LODCount = 1;
+			float LODReduction = 0.5f;
+
+			// Identifies the options to the mesh cache
+			std::uint64_t GetCacheKey() const;
+		};
+
 	private: // Private Methods
 		void LoadFromPath(std::filesystem::path path);
-		void ProcessASSIMPNode(aiNode* node, const aiScene* scene);
+		bool LoadFromMeshCache(const std::filesystem::path& path);
+		void ReloadMeshData();
+		void AddMesh(Mesh mesh);
 		void ProcessASSIMPMesh(aiMesh* mesh, const aiScene* scene);
 		std::vector<std::shared_ptr<Texture>> LoadMaterialTextures(aiMaterial* material, aiTextureType type) const;
 		void BuildTextureBindingMapFromMaterial(std::map<std::string, std::shared_ptr<Texture>>& textureBindingMap, aiMaterial* material, const aiTextureType& type, const std::string& label) const;
 
 	private: // Private Static Methods
-		static bool TextureAlreadyLoaded(std::filesystem::path path);
-
-	private: // Private Static Members
-		inline static std::vector<std::shared_ptr<Texture>> sm_LoadedTextures = {}; // Prevent duplicate loading of textures
+		static const aiScene* ImportASSIMPScene(Assimp::Importer& import, const std::filesystem::path& path);
+		static void CollectASSIMPMeshes(aiNode* node, const aiScene* scene, std::vector<aiMesh*>& meshes);
+		static ASSIMPGeometry ExtractASSIMPGeometry(aiMesh* mesh, const ImportOptions& options);
+		static void PostProcessASSIMPGeometry(ASSIMPGeometry& geometry, const ImportOptions& options, const std::string& meshName);
 
 	private: // Private Members
 		std::vector<Mesh> m_Meshes;
+		std::filesystem::path m_ModelPath;
+		ImportOptions m_ImportOptions;
+		Bounds m_Bounds;
+
+		// Largest error of any mesh at each level of detail
+		std::vector<float> m_LODErrors;
 		std::filesystem::path m_ModelDirectory;
 		std::vector<GLFWwindow*> m_RegisteredWindows;
 
+		// Every texture used by this model's meshes, once each
+		std::vector<std::shared_ptr<Texture>> m_Textures;
+		bool m_TexturesPending = false;
+
 		std::vector<std::shared_ptr<Texture>> m_DiffuseMaps;
 		std::vector<std::shared_ptr<Texture>> m_SpecularMaps;
 		std::vector<std::shared_ptr<Texture>> m_AmbientMaps;
 		std::vector<std::shared_ptr<Texture>> m_NormalMaps;
 		std::vector<std::shared_ptr<Texture>> m_HeightMaps;
 
+	private: // Private Static Members
+		static ImportOptions sm_ImportOptions; // Defined out of line, the nested type isn't complete here
+
 	};
 
 } // OORenderer
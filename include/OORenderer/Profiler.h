@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// Instrumentation, expanding to nothing unless OORENDERER_ENABLE_PROFILING is defined. Names must be string literals
+#ifdef OORENDERER_ENABLE_PROFILING
+#define OORENDERER_PROFILE_CONCAT_INNER(a, b) a##b
+#define OORENDERER_PROFILE_CONCAT(a, b) OORENDERER_PROFILE_CONCAT_INNER(a, b)
+#define OORENDERER_PROFILE_SCOPE(name) ::OORenderer::Profiler::CPUScope OORENDERER_PROFILE_CONCAT(oorendererProfileScope, __LINE__){ name }
+#define OORENDERER_PROFILE_GPU_SCOPE(window, name) ::OORenderer::Profiler::GPUScope OORENDERER_PROFILE_CONCAT(oorendererProfileGPUScope, __LINE__){ window, name }
+#define OORENDERER_PROFILE_GPU_BEGIN(window, name) ::OORenderer::Profiler::BeginGPUTimer(window, name)
+#define OORENDERER_PROFILE_GPU_END(window) ::OORenderer::Profiler::EndGPUTimer(window)
+#define OORENDERER_PROFILE_RELEASE_CONTEXT(window) ::OORenderer::Profiler::ReleaseContext(window)
+#define OORENDERER_PROFILE_THREAD_NAME(name) ::OORenderer::Profiler::SetThreadName(name)
+#else
+#define OORENDERER_PROFILE_SCOPE(name)
+#define OORENDERER_PROFILE_GPU_SCOPE(window, name)
+#define OORENDERER_PROFILE_GPU_BEGIN(window, name)
+#define OORENDERER_PROFILE_GPU_END(window)
+#define OORENDERER_PROFILE_RELEASE_CONTEXT(window)
+#define OORENDERER_PROFILE_THREAD_NAME(name)
+#endif
+
+namespace OORenderer {
+
+	/// <summary>
+	/// CPU and GPU timings of frames, exported as a Chrome trace to open in Perfetto or chrome://tracing.
+	/// Each thread writes its CPU timings to a ring of its own without locking, the newest timings overwriting the oldest once full.
+	/// GPU timings are GL_TIME_ELAPSED queries, read back once available frames later without stalling, and placed on a track per window.
+	/// Use through the OORENDERER_PROFILE_ macros so builds without OORENDERER_ENABLE_PROFILING pay nothing
+	/// </summary>
+	class Profiler {
+	public: // Public objects
+
+		/// <summary>
+		/// Times the scope it lives in on the calling thread
+		/// </summary>
+		class CPUScope {
+		public:
+			explicit CPUScope(const char* name);
+			~CPUScope();
+
+			CPUScope(const CPUScope&) = delete;
+			CPUScope& operator=(const CPUScope&) = delete;
+
+		private:
+			const char* m_Name;
+			std::uint64_t m_Start;
+		};
+
+		/// <summary>
+		/// Times the OpenGL commands issued in the scope it lives in, see BeginGPUTimer
+		/// </summary>
+		class GPUScope {
+		public:
+			GPUScope(GLFWwindow* window, const char* name);
+			~GPUScope();
+
+			GPUScope(const GPUScope&) = delete;
+			GPUScope& operator=(const GPUScope&) = delete;
+
+		private:
+			GLFWwindow* m_Window;
+			bool m_Started;
+		};
+
+	public: // Public static methods
+
+		/// <summary>
+		/// Name the calling thread's track in exported traces. Default: Thread followed by the order it first recorded in
+		/// </summary>
+		static void SetThreadName(const std::string& name);
+
+		/// <summary>
+		/// Start timing OpenGL commands on a window's context, which must be current. Timings on one context can't nest, so a timer
+		/// begun while another is running is ignored. Also reads back any earlier timings now available on the context
+		/// </summary>
+		/// <param name="window">Window whose context is current</param>
+		/// <param name="name">Name of the timing, a string literal</param>
+		/// <returns>True if timing, false if a timer is already running on the context</returns>
+		static bool BeginGPUTimer(GLFWwindow* window, const char* name);
+
+		/// <summary>
+		/// Stop the running timer on a window's context, which must be current
+		/// </summary>
+		static void EndGPUTimer(GLFWwindow* window);
+
+		/// <summary>
+		/// Forget the timers of a context about to be destroyed, along with any timings not yet read back
+		/// </summary>
+		static void ReleaseContext(GLFWwindow* window);
+
+		/// <summary>
+		/// Write every timing still held to a Chrome trace JSON file. GPU timings not yet read back are left out
+		/// </summary>
+		/// <param name="path">File to write</param>
+		/// <returns>True if written, false if the file couldn't be opened</returns>
+		static bool WriteChromeTrace(const std::filesystem::path& path);
+
+		/// <summary>
+		/// Get nanoseconds since the profiler's epoch, the clock every timing is taken on
+		/// </summary>
+		static std::uint64_t GetTime();
+
+	private: // Private static methods
+		static void RecordEvent(const char* name, std::uint64_t start, std::uint64_t duration, GLFWwindow* gpuContext);
+	};
+
+} // OORenderer
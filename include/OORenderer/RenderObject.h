@@ -1,9 +1,15 @@
 #pragma once
 
 #include <memory>
+#include <span>
 
 #include "OORenderer/ShaderProgram.h"
 #include "OORenderer/Model.h"
+#include "OORenderer/Camera.h"
+#include "OORenderer/Bounds.h"
+#include "OORenderer/SpatialIndex.h"
+#include "OORenderer/RenderQueue.h"
+#include "OORenderer/CommandList.h"
 
 namespace OORenderer {
 
@@ -15,11 +21,53 @@ namespace OORenderer {
 		RenderObject(std::shared_ptr<Model> model = nullptr, std::shared_ptr<ShaderProgram> shaderProgram = nullptr);
 		RenderObject(std::filesystem::path filePath, std::shared_ptr<ShaderProgram> shaderProgram = nullptr);
 
+		// Copies join the spatial index of what they copy, moves take over its place there
+		RenderObject(const RenderObject& other);
+		RenderObject(RenderObject&& other) noexcept;
+		RenderObject& operator=(RenderObject other) noexcept;
+		~RenderObject();
+
 		/// <summary>
-		/// Render this object
+		/// Render this object at its last selected level of detail, full detail until rendered with a camera. Nothing is culled
 		/// </summary>
 		void Render() const;
 
+		/// <summary>
+		/// Render this object if its bounds are in the camera's view frustum, as are those of each mesh drawn.
+		/// Drawn at the coarsest level of detail whose error, projected with the camera's matrices, stays under the LOD threshold.
+		/// Levels only change once past the hysteresis margin either side, so objects near a boundary don't pop back and forth
+		/// </summary>
+		/// <param name="camera">Camera the object is seen through, RecalculateMatrices first</param>
+		/// <param name="queue">Queue to add the draws to rather than drawing now, Flush it once everything is queued. Null draws straight away</param>
+		void Render(const Camera& camera, RenderQueue* queue = nullptr);
+
+		/// <summary>
+		/// Set the pass this object is drawn in when rendered through a RenderQueue. Default: RenderPass::Opaque
+		/// </summary>
+		void SetRenderPass(RenderPass pass);
+
+		RenderPass GetRenderPass() const;
+
+		/// <summary>
+		/// Get the bounds of this object's model, moved into world space by the object's model matrix
+		/// </summary>
+		Bounds GetWorldBounds() const;
+
+		/// <summary>
+		/// Add this object to a spatial index, leaving any it was in. It is kept up to date as the object moves, rotates, scales or changes model
+		/// </summary>
+		void AddToSpatialIndex(std::shared_ptr<SpatialIndex> spatialIndex);
+
+		/// <summary>
+		/// Remove this object from its spatial index, if any
+		/// </summary>
+		void RemoveFromSpatialIndex();
+
+		/// <summary>
+		/// Get the level of detail last selected for this object
+		/// </summary>
+		std::size_t GetLODLevel() const;
+
 		/// <summary>
 		/// Load the model at the given path
 		/// </summary>
@@ -33,7 +81,8 @@ namespace OORenderer {
 		void AssignShaderProgram(std::shared_ptr<ShaderProgram> shaderProgram);
 
 		/// <summary>
-		/// Provide a PV (Perspective * View) matrix to pass to this models shader
+		/// Provide a PV (Perspective * View) matrix to pass to this models shader.
+		/// Unnecessary for shaders reading the matrix from the FrameUniforms block, prefer that where many objects share a camera.
 		/// </summary>
 		/// <param name="pvMatrix">Matrix to set</param>
 		/// <param name="transpose">Does it need to be transposed?</param>
@@ -76,14 +125,65 @@ namespace OORenderer {
 		/// <param name="scaleFactors">Scale factor(s) to scale the object by in each dimension</param>
 		void Scale(glm::vec3 scaleFactors);
 
+	public: // Public static methods
+
+		/// <summary>
+		/// Render many objects as Render(camera) would, culling them against the view frustum as one batch
+		/// </summary>
+		/// <param name="objects">Objects to render</param>
+		/// <param name="camera">Camera the objects are seen through, RecalculateMatrices first</param>
+		/// <param name="queue">Queue to add the draws to rather than drawing now, Flush it once everything is queued. Null draws straight away</param>
+		/// <returns>Number of objects not culled</returns>
+		static std::size_t RenderAll(std::span<RenderObject> objects, const Camera& camera, RenderQueue* queue = nullptr);
+
+		/// <summary>
+		/// Render the objects of a spatial index that might be in the camera's view, as Render(camera) would,
+		/// with the tree doing the culling so objects well out of view are never visited
+		/// </summary>
+		/// <returns>Number of objects not culled</returns>
+		static std::size_t RenderAll(const SpatialIndex& spatialIndex, const Camera& camera, RenderQueue* queue = nullptr);
+
+		/// <summary>
+		/// Cull many objects and record draws of those in view to a command list, as RenderAll would queue them. Touches no OpenGL state,
+		/// so worker threads may each record a share of the objects to their own list, no object in more than one share
+		/// </summary>
+		/// <param name="objects">Objects to record</param>
+		/// <param name="camera">Camera the objects are seen through, RecalculateMatrices first and don't change it while recording</param>
+		/// <param name="commands">List to record to, starting with the camera's view for render queues to order draws by</param>
+		/// <returns>Number of objects not culled</returns>
+		static std::size_t RecordAll(std::span<RenderObject> objects, const Camera& camera, CommandList& commands);
+
+		/// <summary>
+		/// Set the largest error level of detail selection allows, as a fraction of viewport height. Default: 0.001, about a pixel at 1080p
+		/// </summary>
+		static void SetLODThreshold(float screenError);
+
+		/// <summary>
+		/// Set how far past the LOD threshold, as a fraction of it, an object must go before its level changes. Default: 0.25
+		/// </summary>
+		static void SetLODHysteresis(float margin);
+
+	private: // Private methods
+		void RenderVisible(const Camera& camera, const BoundingSphere& worldSphere, RenderQueue* queue);
+		void RecordVisible(const Camera& camera, const BoundingSphere& worldSphere, CommandList& commands);
+		void SelectLODLevel(const Camera& camera, const BoundingSphere& worldSphere);
+		void UpdateSpatialIndex();
+
 	private: // Private members
 		std::shared_ptr<ShaderProgram> m_ShaderProgram;
 		std::shared_ptr<Model> m_Model;
 
 		glm::mat4 m_ModelMatrix = 1.0f; // Identity
+		std::size_t m_LODLevel = 0;
+		RenderPass m_RenderPass = RenderPass::Opaque;
+
+		std::shared_ptr<SpatialIndex> m_SpatialIndex;
+		SpatialIndex::ProxyID m_SpatialProxy = SpatialIndex::NullProxy;
 
 	private: // Private static members
 		inline static std::map<std::filesystem::path, std::shared_ptr<Model>> sm_LoadedModels{};
+		inline static float sm_LODThreshold = 0.001f;
+		inline static float sm_LODHysteresis = 0.25f;
 	};
 
 } // OORenderer
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "OORenderer/Mesh.h"
+#include "OORenderer/ShaderProgram.h"
+#include "OORenderer/Camera.h"
+#include "OORenderer/RingBuffer.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// Passes are drawn in order within each window. Opaques draw front to back so depth testing rejects
+	/// hidden fragments early, transparents draw back to front with blending on and depth writes off
+	/// </summary>
+	enum class RenderPass : std::uint8_t {
+		Opaque,
+		Transparent
+	};
+
+	/// <summary>
+	/// Collects a frame's draws and submits them in an order that changes as little GL state as possible.
+	/// Each draw gets a 64 bit key packing window, pass, program, textures, VAO, level of detail and depth, the keys are
+	/// radix sorted and binds matching what is already bound are skipped.
+	/// Draws of one mesh at one level with an instanced program, see ShaderProgram::IsInstanced, become a single instanced draw.
+	/// Where GL 4.3 is available, instanced draws of meshes in the same GeometryPool block with the same program and textures
+	/// become a single multi draw indirect call, each draw finding its model matrices by base instance.
+	/// Textures pooled in the same TextureArrayPool arrays count as the same textures, instances read their layers per instance.
+	/// Instance data and commands stream through a RingBuffer per window where GL 4.4 is available, each Flush one frame of it
+	/// </summary>
+	class RenderQueue {
+	public: // Public objects
+
+		/// <summary>
+		/// What the last Flush did
+		/// </summary>
+		struct Stats {
+			std::size_t Draws = 0; // Draw calls made, each instanced or multi draw counts once
+			std::size_t MultiDraws = 0; // Of those, multi draw indirect calls
+			std::size_t Instances = 0; // Meshes drawn
+			std::size_t ContextSwitches = 0;
+			std::size_t ProgramBinds = 0;
+			std::size_t TextureBinds = 0; // Whole texture sets, one per change of material
+			std::size_t VAOBinds = 0;
+		};
+
+	public: // Public methods
+		RenderQueue() = default;
+		~RenderQueue();
+
+		RenderQueue(const RenderQueue&) = delete;
+		RenderQueue& operator=(const RenderQueue&) = delete;
+
+		/// <summary>
+		/// Set the camera depths are measured from, for draws submitted after this. Depth ordering is off until set
+		/// </summary>
+		void SetView(const Camera& camera);
+		void SetView(const glm::mat4& viewMatrix);
+
+		/// <summary>
+		/// Queue a mesh to be drawn on the shader's window
+		/// </summary>
+		/// <param name="mesh">Mesh to draw, must outlive the next Flush</param>
+		/// <param name="shader">Shader program to draw with, must outlive the next Flush</param>
+		/// <param name="modelMatrix">Set as the modelMatrix uniform for this draw</param>
+		/// <param name="lodLevel">Level of detail to draw</param>
+		/// <param name="pass">Pass to draw in</param>
+		void Submit(const Mesh& mesh, ShaderProgram& shader, const glm::mat4& modelMatrix, std::size_t lodLevel = 0, RenderPass pass = RenderPass::Opaque);
+
+		/// <summary>
+		/// Sort and draw everything queued, then empty the queue. The previously active context is restored after
+		/// </summary>
+		/// <returns>Number of draw calls made</returns>
+		std::size_t Flush();
+
+		/// <summary>
+		/// Drop everything queued without drawing it
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Get the number of draws queued
+		/// </summary>
+		std::size_t GetSize() const;
+
+		/// <summary>
+		/// Get what the last Flush did, e.g. to see how many binds sorting saved against Draws
+		/// </summary>
+		const Stats& GetStats() const;
+
+	private: // Private objects
+		struct DrawPacket {
+			const Mesh* DrawnMesh;
+			ShaderProgram* Shader;
+			glm::mat4 ModelMatrix;
+			std::size_t LODLevel;
+			unsigned int VAOID;
+			RenderPass Pass;
+			std::uint64_t MaterialKey;
+		};
+
+		// Per instance attributes, as instanced programs read them
+		struct InstanceData {
+			glm::mat4 ModelMatrix;
+			glm::uvec4 TextureLayers;
+		};
+
+		struct SortEntry {
+			std::uint64_t Key;
+			std::uint32_t Packet;
+		};
+
+		// Sorted draws made as one call, instances read their model matrices from FirstInstance on.
+		// The first batch of a multi draw carries the count of batches in it, the rest are skipped
+		struct Batch {
+			std::uint32_t FirstEntry;
+			std::uint32_t EntryCount;
+			std::uint32_t FirstInstance;
+			std::uint32_t FirstCommand;
+			std::uint32_t MultiDrawCount = 1;
+		};
+
+		// As glMultiDrawElementsIndirect reads them
+		struct DrawElementsIndirectCommand {
+			std::uint32_t Count;
+			std::uint32_t InstanceCount;
+			std::uint32_t FirstIndex;
+			std::int32_t BaseVertex;
+			std::uint32_t BaseInstance;
+		};
+
+		struct StreamBuffer {
+			unsigned int BufferID = 0;
+			std::size_t Size = 0;
+		};
+
+		struct WindowBuffers {
+			StreamBuffer Instances;
+			StreamBuffer Commands;
+
+			// In place of the stream buffers with GL 4.4
+			std::unique_ptr<RingBuffer> Ring;
+		};
+
+		// Where a window's streamed data landed this Flush
+		struct BufferRange {
+			unsigned int BufferID = 0;
+			std::size_t Offset = 0;
+		};
+
+	private: // Private methods
+		std::uint64_t MakeKey(const DrawPacket& packet, float depth);
+		void BuildBatches();
+		void BuildMultiDraws();
+		void UploadWindowData(GLFWwindow* window, std::size_t firstBatch);
+		void BindInstances(std::size_t firstInstance);
+		void UnbindInstances();
+
+		// Small IDs, stable across frames so equal state sorts together every frame, for the fields of the key
+		std::uint32_t GetDenseID(std::unordered_map<std::uint64_t, std::uint32_t>& ids, std::uint64_t value, unsigned int bits);
+
+	private: // Private static methods
+		static void RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch);
+		static void Upload(StreamBuffer& buffer, GLenum target, const void* data, std::size_t size);
+
+	private: // Private members
+		std::vector<DrawPacket> m_Packets;
+		std::vector<SortEntry> m_SortEntries;
+		std::vector<SortEntry> m_SortScratch;
+		std::vector<Batch> m_Batches;
+
+		// Instance data of instanced batches and commands of multi draws in draw order, each window's uploaded to its own buffers
+		std::vector<InstanceData> m_Instances;
+		std::vector<DrawElementsIndirectCommand> m_IndirectCommands;
+		std::unordered_map<GLFWwindow*, WindowBuffers> m_WindowBuffers;
+		std::size_t m_WindowFirstInstance = 0;
+		std::size_t m_WindowFirstCommand = 0;
+		BufferRange m_WindowInstances;
+		BufferRange m_WindowCommands;
+
+		std::unordered_map<std::uint64_t, std::uint32_t> m_WindowIDs;
+		std::unordered_map<std::uint64_t, std::uint32_t> m_ShaderIDs;
+		std::unordered_map<std::uint64_t, std::uint32_t> m_MaterialIDs;
+		std::unordered_map<std::uint64_t, std::uint32_t> m_OpaqueVAOIDs;
+		std::unordered_map<std::uint64_t, std::uint32_t> m_TransparentVAOIDs;
+		bool m_DenseIDsExhausted = false;
+
+		glm::mat4 m_ViewMatrix{ 0.0f };
+		Stats m_Stats;
+	};
+
+} // OORenderer
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "OORenderer/ShareGroup.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// What an asset does with its CPU side copy once uploaded
+	/// </summary>
+	enum class ResidencyPolicy {
+		Keep,            // Keep it, any window may register later at no cost
+		DropAfterUpload, // Free it once uploaded, windows of new share groups can't register afterwards
+		ReloadOnDemand   // Free it once uploaded, reloading from source or cache when a new share group needs it
+	};
+
+	/// <summary>
+	/// Memory held by assets, in bytes and number of allocations
+	/// </summary>
+	struct ResidencyStats {
+		struct Usage {
+			std::size_t Bytes = 0;
+			std::size_t Count = 0;
+		};
+
+		Usage MeshCPU;
+		Usage TextureCPU;
+		std::map<const ShareGroup*, Usage> MeshGPU;
+		std::map<const ShareGroup*, Usage> TextureGPU;
+
+		std::size_t GetCPUBytes() const;
+		std::size_t GetGPUBytes() const;
+	};
+
+	/// <summary>
+	/// Default residency policy, and accounting of what is resident where
+	/// </summary>
+	class Residency {
+	public: // Public static methods
+
+		/// <summary>
+		/// Set the policy used by assets without their own. Default: ResidencyPolicy::Keep
+		/// </summary>
+		static void SetDefaultPolicy(ResidencyPolicy policy);
+
+		static ResidencyPolicy GetDefaultPolicy();
+
+		/// <summary>
+		/// Get the memory currently held by meshes and textures, CPU side and per share group
+		/// </summary>
+		static ResidencyStats GetStats();
+
+		/// <summary>
+		/// Log a summary of GetStats
+		/// </summary>
+		static void LogStats();
+
+	private: // Private objects
+		enum class Asset {
+			Mesh,
+			Texture
+		};
+
+	private: // Private static methods
+		friend class Mesh;
+		friend class Texture;
+		friend class GeometryPool;
+		friend class TextureArrayPool;
+
+		/// <summary>
+		/// Account for memory until the returned token is destroyed
+		/// </summary>
+		/// <param name="asset">Kind of asset holding the memory</param>
+		/// <param name="shareGroup">Share group holding the memory, nullptr for CPU memory</param>
+		/// <param name="bytes">Size of the memory</param>
+		/// <returns>Token, share it between copies of an asset holding the same memory</returns>
+		static std::shared_ptr<void> Track(Asset asset, const ShareGroup* shareGroup, std::size_t bytes);
+
+		// Expects sm_Mutex held
+		static ResidencyStats::Usage& GetUsage(Asset asset, const ShareGroup* shareGroup);
+
+	private: // Private static members
+		inline static std::mutex sm_Mutex{};
+		inline static ResidencyStats sm_Stats{};
+		// Atomic rather than under sm_Mutex, it's read by every texture and mesh upload whichever thread makes it
+		inline static std::atomic<ResidencyPolicy> sm_DefaultPolicy = ResidencyPolicy::Keep;
+	};
+
+} // OORenderer
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <glad/glad.h>
+
+#include "OORenderer/Window.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// A buffer for data written every frame, e.g. instance data, uniforms or dynamic vertices, split into one region per frame in flight.
+	/// Each frame writes its own region while the GPU reads those of earlier frames, a fence per region stops a frame reusing one still being read.
+	/// With GL 4.4 the buffer is mapped once, persistently and coherently, so writes go straight to memory the GPU reads.
+	/// Otherwise writes go to a CPU side copy and Commit uploads them
+	/// </summary>
+	class RingBuffer {
+	public: // Public objects
+
+		/// <summary>
+		/// Space in the current frame's region, to be written through Data and read by the GPU from Offset of the buffer
+		/// </summary>
+		struct Allocation {
+			void* Data = nullptr;
+			unsigned int BufferID = 0;
+			std::size_t Offset = 0;
+			std::size_t Size = 0;
+
+			bool IsValid() const { return Data != nullptr; }
+		};
+
+	public: // Public methods
+
+		/// <summary>
+		/// Create a ring buffer on the given window's context
+		/// </summary>
+		/// <param name="window">Window to create the buffer on</param>
+		/// <param name="frameSize">Bytes available to each frame</param>
+		/// <param name="framesInFlight">Frames the CPU may run ahead of the GPU before waiting. Default: 3</param>
+		RingBuffer(const Window& window, std::size_t frameSize, unsigned int framesInFlight = 3);
+		RingBuffer(GLFWwindow* window, std::size_t frameSize, unsigned int framesInFlight = 3);
+		~RingBuffer();
+
+		RingBuffer(const RingBuffer&) = delete;
+		RingBuffer& operator=(const RingBuffer&) = delete;
+
+		/// <summary>
+		/// Take space in the current frame's region. Touches no OpenGL state
+		/// </summary>
+		/// <param name="size">Bytes wanted</param>
+		/// <param name="alignment">Alignment of the offset in the buffer, a power of two. For uniform blocks use GetUniformAlignment</param>
+		/// <returns>The space, invalid if the region has no room left</returns>
+		Allocation Allocate(std::size_t size, std::size_t alignment = 16);
+
+		/// <summary>
+		/// Make everything written since the last commit visible to the GPU, call before drawing with it. Does nothing when persistently mapped
+		/// </summary>
+		void Commit();
+
+		/// <summary>
+		/// End the current frame, fencing its region, and move to the next region, waiting for the GPU to finish reading it if need be.
+		/// Call once per frame, after the frame's draws are issued
+		/// </summary>
+		void NextFrame();
+
+		/// <summary>
+		/// Is the buffer persistently mapped, i.e. GL 4.4 is available on its context
+		/// </summary>
+		bool IsPersistent() const;
+
+		/// <summary>
+		/// Get the alignment uniform buffer ranges need on this buffer's context
+		/// </summary>
+		std::size_t GetUniformAlignment() const;
+
+		/// <summary>
+		/// Get the bytes available to each frame
+		/// </summary>
+		std::size_t GetFrameSize() const;
+
+		/// <summary>
+		/// Get how many times NextFrame has had to wait for the GPU, if often the CPU is further ahead than the frames in flight allow
+		/// </summary>
+		std::size_t GetWaitCount() const;
+
+		/// <summary>
+		/// Return the OpenGL buffer ID for this buffer
+		/// </summary>
+		unsigned int GetBufferID() const;
+
+		/// <summary>
+		/// Get the GLFW context this buffer was created on
+		/// </summary>
+		GLFWwindow* GetGLFWWindow() const;
+
+	private: // Private members
+		GLFWwindow* m_Window;
+		unsigned int m_BufferID = 0;
+		std::size_t m_FrameSize;
+		std::size_t m_UniformAlignment = 256;
+
+		// Fence of each region's last frame, null once waited on
+		std::vector<GLsync> m_Fences;
+		std::size_t m_Frame = 0;
+		std::size_t m_Offset = 0;
+		std::size_t m_WaitCount = 0;
+
+		// Persistent mapping of the whole buffer, or the CPU side copy of it and how much of the current region has been uploaded
+		std::byte* m_Mapped = nullptr;
+		std::vector<std::byte> m_Staging;
+		std::size_t m_CommittedOffset = 0;
+	};
+
+} // OORenderer
@@ -2,6 +2,13 @@
 
 #include <filesystem>
 #include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -9,11 +16,80 @@
 #include <glad/glad.h>
 
 #include "OORenderer/Window.h"
+#include "OORenderer/Hash.h"
 
 
 namespace OORenderer {
 
 	class ShaderProgram {
+	public: // Public objects
+
+		/// <summary>
+		/// Hashed uniform or uniform block name, see HashUniformName and the _uniform literal
+		/// </summary>
+		using UniformID = std::uint32_t;
+
+		/// <summary>
+		/// Handle to an active uniform, found once when the program is linked.
+		/// Setting a uniform through a handle is a single OpenGL call with no name lookup.
+		/// </summary>
+		struct Uniform {
+			GLint Location = -1;
+			GLenum Type = GL_NONE;
+			GLint ArraySize = 0;
+
+			bool IsValid() const { return Location >= 0; }
+		};
+
+		/// <summary>
+		/// An active uniform block, found once when the program is linked
+		/// </summary>
+		struct UniformBlock {
+			GLuint Index = GL_INVALID_INDEX;
+			GLint DataSize = 0;
+			GLint Binding = 0;
+		};
+
+		/// <summary>
+		/// First of the four attribute locations a program may read a per instance model matrix from, in place of the modelMatrix uniform:
+		/// layout(location = 12) in mat4 instanceModelMatrix;
+		/// </summary>
+		static constexpr GLuint InstanceMatrixLocation = 12;
+
+		/// <summary>
+		/// Attribute location an instanced program may read the texture array layers of each instance's mesh from, see Mesh::GetTextureBindingMap:
+		/// layout(location = 11) in uvec4 instanceTextureLayers;
+		/// Components are the layers of the mesh's first four textures in sampler name order
+		/// </summary>
+		static constexpr GLuint InstanceTextureLayersLocation = 11;
+
+	public: // Public static methods
+
+		/// <summary>
+		/// Hash a uniform or uniform block name, usable at compile time.
+		/// Array uniforms may be found by either "name" or "name[0]".
+		/// </summary>
+		/// <param name="name">Name as it appears in the shader</param>
+		/// <returns>ID of that name</returns>
+		static constexpr UniformID HashUniformName(std::string_view name) {
+			return HashFNV1a32(name);
+		}
+
+		/// <summary>
+		/// Opt in to caching linked program binaries on disk, so later runs can skip compiling and linking.
+		/// Binaries are keyed by the stage sources and the driver's vendor, renderer and version strings,
+		/// anything stale or corrupt is ignored and the program built from source as normal.
+		/// While enabled RegisterShader defers compilation to LinkProgram, so compile errors are logged at link time.
+		/// The same is true for windows sharing objects with others.
+		/// </summary>
+		/// <param name="directory">Directory to keep cached binaries in, created if it doesn't exist</param>
+		static void EnableBinaryCache(std::filesystem::path directory);
+
+		/// <summary>
+		/// Stop using the program binary cache
+		/// </summary>
+		static void DisableBinaryCache();
+
 	public:
 
 		/// <summary>
@@ -38,7 +114,7 @@ namespace OORenderer {
 		/// </summary>
 		/// <param name="shaderSource">Shader source code. N.B. Not a path</param>
 		/// <param name="shaderType">OpenGL macro for which type of shader this is</param>
-		/// <returns>True if successful, false otherwise</returns>
+		/// <returns>True if successful, false otherwise. Always true when compilation is deferred, see EnableBinaryCache</returns>
 		bool RegisterShader(const char* shaderSource, int shaderType);
 
 		/// <summary>
@@ -51,7 +127,10 @@ namespace OORenderer {
 		bool RegisterShader(std::filesystem::path shaderPath, int shaderType);
 
 		/// <summary>
-		/// Link the registered shaders together creating the complete program ready to be used
+		/// Link the registered shaders together creating the complete program ready to be used.
+		/// Also reads every active uniform and uniform block so they may be set without further queries.
+		/// If a program with identical sources is already linked in this window's share group ours is linked from its binary,
+		/// skipping compilation. Programs are never shared, so uniform values set on one don't affect another.
 		/// </summary>
 		void LinkProgram();
 
@@ -66,6 +145,47 @@ namespace OORenderer {
 		/// <returns>Pointer to the GLFW window this shader program is bound to</returns>
 		GLFWwindow* GetGLFWWindow() const;
 
+		/// <summary>
+		/// Does this program read its model matrix per instance, from the instanceModelMatrix attribute at InstanceMatrixLocation.
+		/// Render queues draw many objects with such programs in one instanced call, they aren't for drawing directly
+		/// </summary>
+		bool IsInstanced() const;
+
+		/// <summary>
+		/// Get a handle to an active uniform of this program
+		/// </summary>
+		/// <param name="uniformID">Hashed name of the uniform</param>
+		/// <returns>Handle to the uniform, invalid if no such uniform is active</returns>
+		Uniform GetUniform(UniformID uniformID) const;
+
+		/// <summary>
+		/// Get a handle to an active uniform of this program - prefer the UniformID overload in hot paths
+		/// </summary>
+		/// <param name="uniformName">Name of the uniform</param>
+		/// <returns>Handle to the uniform, invalid if no such uniform is active</returns>
+		Uniform GetUniform(const GLchar* uniformName) const;
+
+		/// <summary>
+		/// Get an active uniform block of this program
+		/// </summary>
+		/// <param name="blockID">Hashed name of the uniform block</param>
+		/// <returns>Pointer to the block's details, nullptr if no such block is active</returns>
+		const UniformBlock* GetUniformBlock(UniformID blockID) const;
+
+		/// <summary>
+		/// Get every active uniform block of this program
+		/// </summary>
+		/// <returns>Map from hashed block name to block details</returns>
+		const std::unordered_map<UniformID, UniformBlock>& GetUniformBlocks() const;
+
+		/// <summary>
+		/// Bind a uniform block of this program to a uniform buffer binding point
+		/// </summary>
+		/// <param name="blockID">Hashed name of the uniform block</param>
+		/// <param name="binding">Binding point to use</param>
+		/// <returns>True if the block is active and was bound, false otherwise</returns>
+		bool SetUniformBlockBinding(UniformID blockID, GLuint binding);
+
 
 		// These uniforms call the OpenGL uniform equivalents arrays of vectors and matrices are not currently supported
 		// that is, OpenGL count values are hardcoded. E.g. SetUniformMatrix4fv assumes only 1 matrix is being set.
@@ -122,17 +242,113 @@ namespace OORenderer {
 		void SetUniformMatrix4fv(const GLchar* uniformName, const glm::mat4& value, const bool transpose = false);
 
 
+		// Handle overloads, see GetUniform. These skip the name lookup entirely.
+
+		void SetUniform1f(const Uniform& uniform, const float v0);
+		void SetUniform2f(const Uniform& uniform, const float v0, const float v1);
+		void SetUniform3f(const Uniform& uniform, const float v0, const float v1, const float v2);
+		void SetUniform4f(const Uniform& uniform, const float v0, const float v1, const float v2, const float v3);
+
+		void SetUniform1i(const Uniform& uniform, const int v0);
+		void SetUniform2i(const Uniform& uniform, const int v0, const int v1);
+		void SetUniform3i(const Uniform& uniform, const int v0, const int v1, const int v2);
+		void SetUniform4i(const Uniform& uniform, const int v0, const int v1, const int v2, const int v3);
+
+		void SetUniform1ui(const Uniform& uniform, const unsigned int v0);
+		void SetUniform2ui(const Uniform& uniform, const unsigned int v0, const unsigned int v1);
+		void SetUniform3ui(const Uniform& uniform, const unsigned int v0, const unsigned int v1, const unsigned int v2);
+		void SetUniform4ui(const Uniform& uniform, const unsigned int v0, const unsigned int v1, const unsigned int v2, const unsigned int v3);
+
+		void SetUniform1fv(const Uniform& uniform, const float* value);
+		void SetUniform2fv(const Uniform& uniform, const float* value);
+		void SetUniform3fv(const Uniform& uniform, const float* value);
+		void SetUniform4fv(const Uniform& uniform, const float* value);
+
+		void SetUniform1iv(const Uniform& uniform, const int* value);
+		void SetUniform2iv(const Uniform& uniform, const int* value);
+		void SetUniform3iv(const Uniform& uniform, const int* value);
+		void SetUniform4iv(const Uniform& uniform, const int* value);
+
+		void SetUniform1iuv(const Uniform& uniform, const unsigned int* value);
+		void SetUniform2iuv(const Uniform& uniform, const unsigned int* value);
+		void SetUniform3iuv(const Uniform& uniform, const unsigned int* value);
+		void SetUniform4iuv(const Uniform& uniform, const unsigned int* value);
+
+		void SetUniformMatrix2fv(const Uniform& uniform, const float* value, const bool transpose = false);
+		void SetUniformMatrix3fv(const Uniform& uniform, const float* value, const bool transpose = false);
+		void SetUniformMatrix4fv(const Uniform& uniform, const float* value, const bool transpose = false);
+
+		void SetUniformMatrix2x3fv(const Uniform& uniform, const float* value, const bool transpose = false);
+		void SetUniformMatrix3x2fv(const Uniform& uniform, const float* value, const bool transpose = false);
+		void SetUniformMatrix2x4fv(const Uniform& uniform, const float* value, const bool transpose = false);
+		void SetUniformMatrix4x2fv(const Uniform& uniform, const float* value, const bool transpose = false);
+		void SetUniformMatrix3x4fv(const Uniform& uniform, const float* value, const bool transpose = false);
+		void SetUniformMatrix4x3fv(const Uniform& uniform, const float* value, const bool transpose = false);
+
+		// glm type overloads
+
+		void SetUniform2fv(const Uniform& uniform, const glm::vec2& value);
+		void SetUniform3fv(const Uniform& uniform, const glm::vec3& value);
+		void SetUniform4fv(const Uniform& uniform, const glm::vec4& value);
+
+		void SetUniformMatrix2fv(const Uniform& uniform, const glm::mat2& value, const bool transpose = false);
+		void SetUniformMatrix3fv(const Uniform& uniform, const glm::mat3& value, const bool transpose = false);
+		void SetUniformMatrix4fv(const Uniform& uniform, const glm::mat4& value, const bool transpose = false);
+
+
 	private: // Private methods
 
 		/// <summary>
-		/// Set a given uniform for this program using a given OpenGL function and appropriate arguments
+		/// Set a given uniform for this program using a given OpenGL function and appropriate arguments.
+		/// Uses the glProgramUniform variant where available so the program needn't be bound.
 		/// </summary>
 		/// <typeparam name="...TArgs">Pack of types of the user arguments to be passed to the OpenGL function</typeparam>
-		/// <param name="uniformName">Name of uniform to set</param>
-		/// <param name="oglUniformFunction">OpenGL uniform function to use to set the value, see: https://registry.khronos.org/OpenGL-Refpages/gl4/html/glUniform.xhtml</param>
+		/// <param name="uniform">Handle of uniform to set</param>
+		/// <param name="oglProgramUniformFunction">OpenGL program uniform function to use to set the value, see: https://registry.khronos.org/OpenGL-Refpages/gl4/html/glProgramUniform.xhtml</param>
+		/// <param name="oglUniformFunction">OpenGL uniform function to use when program uniform functions are unavailable, see: https://registry.khronos.org/OpenGL-Refpages/gl4/html/glUniform.xhtml</param>
 		/// <param name="...args">Arguments to pass to the OpenGL uniform function</param>
 		template<typename... TArgs>
-		void SetUniformHelper(const GLchar* uniformName, void (*oglUniformFunction)(GLint, TArgs...), TArgs... args);
+		void SetUniformHelper(const Uniform& uniform, void (*oglProgramUniformFunction)(GLuint, GLint, TArgs...), void (*oglUniformFunction)(GLint, TArgs...), std::type_identity_t<TArgs>... args);
+
+		/// <summary>
+		/// Compile a shader stage and attach it to this program, expects the correct context to be active
+		/// </summary>
+		bool CompileShader(const char* shaderSource, int shaderType);
+
+		/// <summary>
+		/// Link this program from a binary, expects the correct context to be active
+		/// </summary>
+		/// <returns>True if the driver accepted the binary, false if we must compile from source</returns>
+		bool LinkFromBinary(GLenum format, const std::vector<char>& data);
+
+		/// <summary>
+		/// Try to link this program from a cached binary, expects the correct context to be active
+		/// </summary>
+		/// <returns>True if the cached binary was usable, false if we must compile from source</returns>
+		bool LinkFromBinaryCache(std::uint64_t cacheKey);
+
+		void StoreInBinaryCache(std::uint64_t cacheKey);
+
+		/// <summary>
+		/// Let others in our share group link from our binary, also storing it in the binary cache if given a key.
+		/// Expects the correct context to be active
+		/// </summary>
+		void ShareBinary(std::uint64_t sourceKey, std::optional<std::uint64_t> cacheKey);
+
+		std::uint64_t HashShaderSources() const;
+
+		/// <summary>
+		/// Work common to every successful link, expects the correct context to be active
+		/// </summary>
+		void FinishLink();
+
+		/// <summary>
+		/// Read every active uniform and uniform block from the linked program
+		/// </summary>
+		void ReflectUniforms();
+
+		void AddReflectedUniform(std::string name, const Uniform& uniform);
+		void AddReflectedUniformBlock(const std::string& name, const UniformBlock& block);
 
 	private:
 		int m_ProgramID;
@@ -142,6 +358,26 @@ namespace OORenderer {
 
 		// Map from shader type e.g. GL_VERTEX_SHADER to shader ID
 		std::map<int, unsigned int> m_RegisteredShaders;
+
+		// Map from shader type to source, for the binary cache and deferred compilation
+		std::map<int, std::string> m_ShaderSources;
+
+		// Active uniforms and uniform blocks by hashed name, filled on link
+		std::unordered_map<UniformID, Uniform> m_Uniforms;
+		std::unordered_map<UniformID, UniformBlock> m_UniformBlocks;
+
+		bool m_Instanced = false;
 	};
 
+	namespace Literals {
+
+		/// <summary>
+		/// Hash a uniform name at compile time, e.g. shader.GetUniform("modelMatrix"_uniform)
+		/// </summary>
+		consteval ShaderProgram::UniformID operator""_uniform(const char* name, std::size_t length) {
+			return ShaderProgram::HashUniformName(std::string_view{ name, length });
+		}
+
+	} // Literals
+
 } // OORenderer
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+namespace OORenderer {
+
+	/// <summary>
+	/// A set of windows whose OpenGL contexts share objects, formed by passing a window to share with when constructing a Window.
+	/// Buffers and textures are created once per share group and usable from any of its windows, programs are compiled once and linked per ShaderProgram,
+	/// container objects such as VAOs are never shared so those are still made per window.
+	/// </summary>
+	class ShareGroup : public std::enable_shared_from_this<ShareGroup> {
+	public: // Public objects
+
+		/// <summary>
+		/// Identifies a share group, never reused once the group is destroyed, so safe to key objects uploaded per group by
+		/// </summary>
+		using ID = std::uint64_t;
+
+		/// <summary>
+		/// A linked program as retrieved with glGetProgramBinary
+		/// </summary>
+		struct ProgramBinary {
+			GLenum Format = GL_NONE;
+			std::vector<char> Data;
+		};
+
+	public: // Public static methods
+
+		/// <summary>
+		/// Get the share group of a GLFW window
+		/// </summary>
+		/// <param name="window">GLFW window, must have been created by a Window</param>
+		/// <returns>The window's share group, nullptr if the window wasn't created by a Window</returns>
+		static ShareGroup* Of(GLFWwindow* window);
+
+	public: // Public methods
+		~ShareGroup();
+
+		/// <summary>
+		/// Get the ID of this group
+		/// </summary>
+		/// <returns>This group's ID, unlike its address never that of another group</returns>
+		ID GetID() const;
+
+		/// <summary>
+		/// Determine if a window belongs to this group
+		/// </summary>
+		/// <param name="window">GLFW window to check</param>
+		/// <returns>True if so, false otherwise</returns>
+		bool Contains(GLFWwindow* window) const;
+
+		/// <summary>
+		/// Get a context to work on this group's shared objects with, the current context if it's a member
+		/// </summary>
+		/// <returns>A window of this group</returns>
+		GLFWwindow* GetAnyContext() const;
+
+		/// <summary>
+		/// Get every window in this group
+		/// </summary>
+		/// <returns>Windows of this group</returns>
+		const std::vector<GLFWwindow*>& GetWindows() const;
+
+		/// <summary>
+		/// Find the binary of a program already linked in this group from identical sources.
+		/// Uniform values belong to a program object, so each ShaderProgram links its own program from this rather than sharing one.
+		/// </summary>
+		/// <param name="sourceKey">Hash of the program's sources</param>
+		/// <returns>The program's binary, nullptr if no such program has been linked in this group</returns>
+		const ProgramBinary* FindProgramBinary(std::uint64_t sourceKey) const;
+
+		/// <summary>
+		/// Make the binary of a newly linked program available to others in this group
+		/// </summary>
+		/// <param name="sourceKey">Hash of the program's sources</param>
+		/// <param name="binary">Binary retrieved from the linked program</param>
+		void AddProgramBinary(std::uint64_t sourceKey, ProgramBinary binary);
+
+	private: // Private methods
+		friend class Window;
+		void AddWindow(GLFWwindow* window);
+		void RemoveWindow(GLFWwindow* window);
+
+	private: // Private static members
+		inline static std::atomic<ID> sm_NextID = 1;
+
+	private: // Private members
+		const ID m_ID = sm_NextID++;
+		std::vector<GLFWwindow*> m_Windows;
+		std::unordered_map<std::uint64_t, ProgramBinary> m_ProgramBinaries;
+	};
+
+} // OORenderer
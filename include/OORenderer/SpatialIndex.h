@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "OORenderer/Bounds.h"
+#include "OORenderer/Frustum.h"
+
+namespace OORenderer {
+
+	class RenderObject;
+
+	/// <summary>
+	/// Dynamic AABB tree of render objects for sub-linear frustum, sphere and ray queries.
+	/// Objects are held with fat boxes, enlarged by a margin, so small moves leave the tree untouched and larger ones
+	/// reinsert only that object. RenderObjects added to an index keep themselves up to date as they are transformed
+	/// </summary>
+	class SpatialIndex {
+	public: // Public objects
+		using ProxyID = std::int32_t;
+		static constexpr ProxyID NullProxy = -1;
+
+		struct RayHit {
+			RenderObject* Object;
+			float Distance; // Along the ray to where it enters the object's bounds
+		};
+
+	public: // Public methods
+
+		/// <param name="fatMargin">How far each side of an object's box is pushed out, as a fraction of its largest extent</param>
+		SpatialIndex(float fatMargin = 0.1f);
+
+		/// <summary>
+		/// Add an object with the given world space box, prefer RenderObject::AddToSpatialIndex which keeps it up to date
+		/// </summary>
+		/// <returns>Proxy to update or remove the object by</returns>
+		ProxyID Insert(const AABB& box, RenderObject* object);
+
+		void Remove(ProxyID proxy);
+
+		/// <summary>
+		/// Give an object a new box. Nothing changes while the box stays within the object's fat box
+		/// </summary>
+		/// <returns>True if the object was reinserted</returns>
+		bool Update(ProxyID proxy, const AABB& box);
+
+		/// <summary>
+		/// Point a proxy at a different object, e.g. when one moves in memory
+		/// </summary>
+		void SetObject(ProxyID proxy, RenderObject* object);
+
+		/// <summary>
+		/// Find objects whose fat boxes might be in view
+		/// </summary>
+		/// <param name="results">Objects found are appended here</param>
+		void Query(const Frustum& frustum, std::vector<RenderObject*>& results) const;
+
+		/// <summary>
+		/// Find objects whose fat boxes overlap a sphere
+		/// </summary>
+		/// <param name="results">Objects found are appended here</param>
+		void Query(const BoundingSphere& sphere, std::vector<RenderObject*>& results) const;
+
+		/// <summary>
+		/// Find the object whose box a ray enters first. Tested against the exact boxes, not the fat ones
+		/// </summary>
+		/// <param name="origin">Start of the ray</param>
+		/// <param name="direction">Direction of the ray, need not be normalized, distances are in multiples of it</param>
+		/// <param name="maxDistance">Furthest along the ray to look</param>
+		std::optional<RayHit> RayCast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) const;
+
+		/// <summary>
+		/// Get the number of objects in the index
+		/// </summary>
+		std::size_t GetProxyCount() const;
+
+		/// <summary>
+		/// Get the height of the tree, about log2 of the object count when well balanced
+		/// </summary>
+		int GetHeight() const;
+
+	private: // Private objects
+		struct Node {
+			AABB FatBox;
+			AABB Box; // Exact, leaves only
+			RenderObject* Object = nullptr;
+
+			ProxyID Parent = NullProxy; // Or next free node
+			ProxyID Child1 = NullProxy;
+			ProxyID Child2 = NullProxy;
+			int Height = -1; // Leaves are 0, free nodes -1
+
+			bool IsLeaf() const { return Child1 == NullProxy; }
+		};
+
+	private: // Private methods
+		ProxyID AllocateNode();
+		void FreeNode(ProxyID node);
+		void InsertLeaf(ProxyID leaf);
+		void RemoveLeaf(ProxyID leaf);
+		ProxyID Balance(ProxyID node);
+		void CollectLeaves(ProxyID node, std::vector<RenderObject*>& results) const;
+		AABB Fatten(const AABB& box) const;
+
+	private: // Private members
+		std::vector<Node> m_Nodes;
+		ProxyID m_Root = NullProxy;
+		ProxyID m_FreeList = NullProxy;
+		std::size_t m_ProxyCount = 0;
+		float m_FatMargin;
+	};
+
+} // OORenderer
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#include <glm/glm.hpp>
+
+namespace OORenderer::Std140 {
+
+	// Helpers for laying out data following the std140 rules, see section 7.6.2.2 of the OpenGL 4.6 core spec.
+	// Only the types we pass to shaders are supported: 32 bit scalars, vectors, and float matrices.
+
+	/// <summary>
+	/// Round offset up to the next multiple of alignment
+	/// </summary>
+	constexpr std::size_t AlignUp(std::size_t offset, std::size_t alignment) {
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	/// <summary>
+	/// std140 base alignment, size and column count of a type.
+	/// Matrices are stored as arrays of column vectors, each column padded to a vec4.
+	/// </summary>
+	template<typename T>
+	struct Traits;
+
+	template<> struct Traits<float> { static constexpr std::size_t Alignment = 4; static constexpr std::size_t Size = 4; };
+	template<> struct Traits<int> { static constexpr std::size_t Alignment = 4; static constexpr std::size_t Size = 4; };
+	template<> struct Traits<unsigned int> { static constexpr std::size_t Alignment = 4; static constexpr std::size_t Size = 4; };
+
+	template<glm::length_t L, typename TScalar>
+	struct Traits<glm::vec<L, TScalar>> {
+		static constexpr std::size_t Alignment = L == 2 ? 8 : 16;
+		static constexpr std::size_t Size = L * 4;
+	};
+
+	template<glm::length_t C, glm::length_t R>
+	struct Traits<glm::mat<C, R, float>> {
+		static constexpr std::size_t ColumnStride = 16;
+		static constexpr std::size_t Alignment = 16;
+		static constexpr std::size_t Size = C * ColumnStride;
+	};
+
+	/// <summary>
+	/// Stride between elements of an array of T
+	/// </summary>
+	template<typename T>
+	constexpr std::size_t ArrayStride() {
+		return AlignUp(Traits<T>::Size, 16);
+	}
+
+	/// <summary>
+	/// Builds up the offsets of the members of a std140 block in declaration order
+	/// </summary>
+	class Layout {
+	public:
+		/// <summary>
+		/// Add a member to the end of the block
+		/// </summary>
+		/// <typeparam name="T">Type of the member</typeparam>
+		/// <param name="arrayCount">Number of elements if the member is an array, 0 otherwise</param>
+		/// <returns>Offset in bytes of the member within the block</returns>
+		template<typename T>
+		constexpr std::size_t Add(std::size_t arrayCount = 0) {
+			if (arrayCount == 0) {
+				std::size_t offset = AlignUp(m_Size, Traits<T>::Alignment);
+				m_Size = offset + Traits<T>::Size;
+				return offset;
+			}
+
+			// Arrays are aligned to a vec4 and so is whatever follows them
+			std::size_t offset = AlignUp(m_Size, 16);
+			m_Size = AlignUp(offset + arrayCount * ArrayStride<T>(), 16);
+			return offset;
+		}
+
+		/// <summary>
+		/// Size of the block as the buffer backing it must be, rounded up to a vec4
+		/// </summary>
+		/// <returns>Size in bytes</returns>
+		constexpr std::size_t GetSize() const {
+			return AlignUp(m_Size, 16);
+		}
+
+	private:
+		std::size_t m_Size = 0;
+	};
+
+	/// <summary>
+	/// Write a value into std140 laid out memory
+	/// </summary>
+	/// <param name="buffer">Start of the block</param>
+	/// <param name="offset">Offset of the member, see Layout</param>
+	/// <param name="value">Value to write</param>
+	template<typename T>
+	void Write(std::byte* buffer, std::size_t offset, const T& value) {
+		std::memcpy(buffer + offset, &value, Traits<T>::Size);
+	}
+
+	template<glm::length_t C, glm::length_t R>
+	void Write(std::byte* buffer, std::size_t offset, const glm::mat<C, R, float>& value) {
+		// Columns are padded out to a vec4 each
+		for (glm::length_t column = 0; column < C; ++column) {
+			std::memcpy(buffer + offset + column * Traits<glm::mat<C, R, float>>::ColumnStride, &value[column], R * sizeof(float));
+		}
+	}
+
+} // OORenderer::Std140
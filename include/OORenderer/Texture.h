@@ -2,16 +2,31 @@
 
 #include <filesystem>
 #include <array>
+#include <map>
+#include <memory>
+#include <optional>
 #include <glad/glad.h>
 
 #include <OORenderer/Window.h>
+#include <OORenderer/ShareGroup.h>
+#include <OORenderer/Residency.h>
+#include <OORenderer/TextureArrayPool.h>
 
 namespace OORenderer {
 
+	struct CompressedImage;
+
 	/// <summary>
-	/// 2D Texture class, Textures can only be bound to 1 window at a time
+	/// 2D Texture class. Textures may be bound to any number of windows, they are uploaded once per share group.
 	/// </summary>
 	class Texture {
+	public: // Public objects
+		enum class Compression {
+			None,       // Upload as decoded
+			Fast,       // BC1 for RGB, BC3 for RGBA
+			HighQuality // BC7 for RGB and RGBA
+		};
+
 	public:
 		Texture();
 		Texture(std::filesystem::path texturePath);
@@ -25,10 +40,25 @@ namespace OORenderer {
 		~Texture();
 
 		/// <summary>
-		/// Return the OpenGL Texture ID for this texture
+		/// Return the OpenGL Texture ID for this texture on the current context
+		/// </summary>
+		/// <returns>OpenGL Texture ID for this texture, 0 if not bound to the current context's share group</returns>
+		unsigned int GetTextureID() const;
+
+		/// <summary>
+		/// Return the OpenGL Texture ID for this texture on a given window
 		/// </summary>
-		/// <returns><OpenGL Texture ID for this texture/returns>
-		unsigned int GetTextureID();
+		/// <param name="window">Window to get the ID on</param>
+		/// <returns>OpenGL Texture ID for this texture, 0 if not bound to that window's share group</returns>
+		unsigned int GetTextureID(GLFWwindow* window) const;
+
+		/// <summary>
+		/// Return the array layer this texture was uploaded to on a given window, when uploaded with array pooling enabled.
+		/// Such textures have no image in the texture GetTextureID returns
+		/// </summary>
+		/// <param name="window">Window to get the layer on</param>
+		/// <returns>Array and layer, nullptr if not pooled on that window's share group</returns>
+		const TextureArrayPool::Slot* GetArraySlot(GLFWwindow* window) const;
 
 		/// <summary>
 		/// Load the texture at the given path into this object
@@ -38,13 +68,37 @@ namespace OORenderer {
 		void LoadTexture(std::filesystem::path texturePath, const bool flip = true);
 
 		/// <summary>
-		/// Bind this shader to a given GLFWwindow context
+		/// Decode the texture at the given path on a worker thread. The texture may be bound and rendered with straight away,
+		/// its image arrives once decoding finishes and UploadDecodedTexture is called
+		/// </summary>
+		/// <param name="texturePath">Path to texture to load</param>
+		/// <param name="flip">Flip the source image on load. Default: true</param>
+		void LoadTextureAsync(std::filesystem::path texturePath, const bool flip = true);
+
+		/// <summary>
+		/// Upload a finished background decode to every share group this texture is bound to. Call from the thread owning those contexts
+		/// </summary>
+		/// <returns>True if no decode is pending any more</returns>
+		bool UploadDecodedTexture();
+
+		/// <summary>
+		/// Is a background decode still waiting to be uploaded
+		/// </summary>
+		bool IsDecodePending() const;
+
+		/// <summary>
+		/// Block until the background decode, if any, has finished. Does not upload it
+		/// </summary>
+		void WaitForDecode() const;
+
+		/// <summary>
+		/// Bind this texture to a given Window context, does nothing if already available to that window's share group
 		/// </summary>
 		/// <param name="window"></param>
 		void BindToWindow(const Window& window);
 
 		/// <summary>
-		/// Bind this shader to a given Window context
+		/// Bind this texture to a given GLFWwindow context, does nothing if already available to that window's share group
 		/// </summary>
 		/// <param name="window"></param>
 		void BindToWindow(GLFWwindow* window);
@@ -79,20 +133,148 @@ namespace OORenderer {
 		/// <returns>Texture file path on disk</returns>
 		std::filesystem::path GetTexturePath() const;
 
+		/// <summary>
+		/// Get the approximate memory held by this texture, its CPU side image plus each share group's upload with mipmaps
+		/// </summary>
+		/// <returns>Size in bytes, 0 until an image has loaded</returns>
+		std::size_t GetMemorySize() const;
+
+		/// <summary>
+		/// Set what to do with this texture's CPU side image once uploaded, overriding the default policy
+		/// </summary>
+		void SetResidencyPolicy(ResidencyPolicy policy);
+
+		/// <summary>
+		/// Get the policy this texture follows, its own or the default
+		/// </summary>
+		ResidencyPolicy GetResidencyPolicy() const;
+
+		/// <summary>
+		/// Is the image held CPU side
+		/// </summary>
+		bool IsDataResident() const;
+
+	public: // Public static methods
+
+		/// <summary>
+		/// Set how many worker threads decode textures loaded with LoadTextureAsync. Defaults to one less than the hardware thread count.
+		/// Waits for decodes already queued to finish
+		/// </summary>
+		/// <param name="threadCount">Number of decode threads, at least 1</param>
+		static void SetDecodeThreadCount(unsigned int threadCount);
+
+		/// <summary>
+		/// Block compress textures loaded from now on, greyscale images use BC4 and greyscale with alpha BC5.
+		/// Encoding is slow, so compressed mips are cached on disk as KTX2 files and later loads upload those directly
+		/// </summary>
+		/// <param name="compression">Which formats to use for colour images</param>
+		/// <param name="cacheDirectory">Directory to cache compressed textures in, it is created if needed</param>
+		static void EnableCompression(Compression compression, std::filesystem::path cacheDirectory);
+
+		/// <summary>
+		/// Upload textures loaded from now on as decoded
+		/// </summary>
+		static void DisableCompression();
+
+		/// <summary>
+		/// Upload textures from now on into a layer of a TextureArrayPool array of their size and format, rather than a texture of their own.
+		/// Shaders sample them through a sampler2DArray of the binding's name and a layer, see Mesh
+		/// </summary>
+		static void EnableArrayPooling();
+
+		/// <summary>
+		/// Upload textures from now on to textures of their own
+		/// </summary>
+		static void DisableArrayPooling();
+
+	private: // Private objects
+		struct LoadedImage;
+		struct PendingDecode;
+
+	private: // Private static methods
+		/// <summary>
+		/// Decode, and optionally block compress, an image file. Touches no OpenGL state so may run on any thread
+		/// </summary>
+		static LoadedImage LoadImageFile(const std::filesystem::path& texturePath, bool flip, Compression compression, const std::filesystem::path& cacheDirectory);
+
 	private: // Private methods
-		void BindTexture();
-		void UnbindTexture();
+		/// <summary>
+		/// Take ownership of a loaded image and upload it to every share group we're bound to
+		/// </summary>
+		void SetImage(LoadedImage image);
+
+		/// <summary>
+		/// Upload the loaded image to the currently bound texture, expects the correct context to be active
+		/// </summary>
+		void UploadToBoundTexture(const ShareGroup& shareGroup);
+
+		/// <summary>
+		/// Upload the loaded image to a layer of a pooled array, expects the correct context to be active
+		/// </summary>
+		void UploadToArray(const ShareGroup& shareGroup);
+
+		/// <summary>
+		/// Size in bytes of the CPU side image, 0 if not resident
+		/// </summary>
+		std::size_t GetCPUMemorySize() const;
+
+		/// <summary>
+		/// Load the image again from where it was first loaded from
+		/// </summary>
+		void ReloadImageData();
+
+		/// <summary>
+		/// Free the CPU side image, keeping its description
+		/// </summary>
+		void DropImageData();
+
+		/// <summary>
+		/// Forget what we uploaded to share groups since destroyed, their objects went with their contexts
+		/// </summary>
+		void ForgetClosedShareGroups();
+
+		/// <summary>
+		/// Push our wrap and filtering settings to every share group we're bound to, pooled layers switching sampler
+		/// </summary>
+		void ApplyTextureParameters();
+
+		/// <summary>
+		/// Our wrap and filtering settings, for the sampler of a pooled layer
+		/// </summary>
+		TextureArrayPool::Sampling GetSampling() const;
 
 	private: // Private members
-		GLFWwindow* m_Window = nullptr;
-		GLFWwindow* m_OldContext = nullptr;
-		unsigned int m_TextureID = 0;
+		// One texture object per share group we're bound to
+		std::map<ShareGroup::ID, unsigned int> m_GroupTextureIDs;
+
+		// Lets us tell if a share group is still around to work on its texture object
+		std::map<ShareGroup::ID, std::weak_ptr<const ShareGroup>> m_GroupLifetimes;
+
+		// Layers holding our image instead, for share groups we were uploaded to while pooling arrays
+		std::map<ShareGroup::ID, TextureArrayPool::Slot> m_GroupArraySlots;
 
 		std::filesystem::path m_TextureFilePath{};
 		unsigned char* m_RawData = nullptr;
 		int m_Width = 0;
 		int m_Height = 0;
 		int m_NumChannels = 0;
+		bool m_Flip = true;
+
+		// Set instead of m_RawData when block compressed
+		std::shared_ptr<const CompressedImage> m_CompressedImage;
+
+		// How the image was loaded, so it may be reloaded the same way
+		Compression m_LoadCompression = Compression::None;
+		std::filesystem::path m_LoadCacheDirectory{};
+
+		// Residency of the image and its uploads
+		std::optional<ResidencyPolicy> m_ResidencyPolicy;
+		std::shared_ptr<void> m_CPUTracking;
+		std::map<ShareGroup::ID, std::shared_ptr<void>> m_GroupTracking;
+		std::size_t m_UploadedSize = 0;
+
+		// Background decode yet to be uploaded, shared with the worker decoding it
+		std::shared_ptr<PendingDecode> m_PendingDecode;
 
 		// Texture wrap details
 		std::array<float, 4> m_BorderColour = { 1.0f, 1.0f, 1.0f, 1.0f };
@@ -102,6 +284,11 @@ namespace OORenderer {
 		// Texture filtering details
 		int m_TextureFilteringMin = GL_LINEAR_MIPMAP_LINEAR;
 		int m_TextureFilteringMag = GL_LINEAR;
+
+	private: // Private static members
+		inline static Compression sm_Compression = Compression::None;
+		inline static std::filesystem::path sm_CompressedCacheDirectory{};
+		inline static bool sm_PoolArrays = false;
 	};
 
 } // OORenderer
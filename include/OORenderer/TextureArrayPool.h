@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "OORenderer/ShareGroup.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// 2D array textures shared by many textures of the same size and format, each texture one layer, so meshes whose textures
+	/// share arrays draw with no texture binds between them. Each share group has arrays per format, sized to a memory budget.
+	/// Textures of an array may wrap and filter differently, each is drawn with a sampler object matching its own settings. See Texture::EnableArrayPooling
+	/// </summary>
+	class TextureArrayPool {
+	public: // Public objects
+
+		/// <summary>
+		/// What a texture needs of its array, textures pool together only when every field matches
+		/// </summary>
+		struct Format {
+			GLenum InternalFormat;
+			int Width;
+			int Height;
+			int Levels;
+			int NumChannels;
+			std::size_t BlockSize = 0; // Bytes per 4x4 block if block compressed, else 0
+
+			auto operator<=>(const Format&) const = default;
+
+			/// <summary>
+			/// Size in bytes of one layer with all its levels
+			/// </summary>
+			std::size_t GetLayerSize() const;
+		};
+
+		/// <summary>
+		/// How a texture wraps and filters, pooled textures with equal sampling share a sampler object
+		/// </summary>
+		struct Sampling {
+			GLint WrapS;
+			GLint WrapT;
+			GLint MinFilter;
+			GLint MagFilter;
+			std::array<float, 4> BorderColour;
+
+			auto operator<=>(const Sampling&) const = default;
+		};
+
+		struct Array {
+			Format ArrayFormat;
+			unsigned int TextureID = 0;
+			int LayerCapacity = 0;
+			int LayerCount = 0;
+
+			// Layers given back by textures, reused before growing LayerCount
+			std::vector<int> FreeLayers;
+
+			// Set by uploads of uncompressed layers, whose mips are generated when next sampled
+			bool MipmapsDirty = false;
+
+			// Accounts for the array's memory
+			std::shared_ptr<void> Tracking;
+		};
+
+		/// <summary>
+		/// Where a texture lives in the pool
+		/// </summary>
+		struct Slot {
+			Array* PoolArray = nullptr;
+			int Layer = 0;
+			GLuint Sampler = 0; // Bound alongside the array, see GetSampler
+		};
+
+	public: // Public static methods
+
+		/// <summary>
+		/// Find a free layer in an array of the share group, creating an array if none of the format has room.
+		/// Expects a context of the share group to be active
+		/// </summary>
+		/// <param name="shareGroup">Share group the texture is being uploaded to</param>
+		/// <param name="format">Format of the texture</param>
+		/// <returns>The layer found, for the caller to upload into</returns>
+		static Slot Allocate(const ShareGroup* shareGroup, const Format& format);
+
+		/// <summary>
+		/// Give a layer back for another texture to use. Touches no OpenGL state
+		/// </summary>
+		static void Release(const Slot& slot);
+
+		/// <summary>
+		/// Get the sampler object of the share group sampling as given, creating it if none does yet.
+		/// Expects a context of the share group to be active
+		/// </summary>
+		/// <param name="shareGroup">Share group the texture is uploaded to</param>
+		/// <param name="sampling">Wrap and filtering of the texture</param>
+		/// <returns>OpenGL sampler ID</returns>
+		static GLuint GetSampler(const ShareGroup* shareGroup, const Sampling& sampling);
+
+		/// <summary>
+		/// Generate mips of any layers uploaded without them, binding the array to the active unit if need be
+		/// </summary>
+		static void PrepareForSampling(Array& array);
+
+		/// <summary>
+		/// Free a share group's arrays and samplers, called as the group is destroyed since they went with its last context
+		/// </summary>
+		/// <param name="shareGroupID">ID of the share group destroyed</param>
+		static void ReleaseShareGroup(ShareGroup::ID shareGroupID);
+
+		/// <summary>
+		/// Set the size in bytes of arrays created from now on, the layer count is as many as fit. Default: 128 MiB.
+		/// Textures too big for an array get one of their own
+		/// </summary>
+		static void SetArrayBudget(std::size_t bytes);
+
+		/// <summary>
+		/// Get the number of arrays across every share group
+		/// </summary>
+		static std::size_t GetArrayCount();
+
+	private: // Private static members
+		inline static std::map<ShareGroup::ID, std::vector<std::unique_ptr<Array>>> sm_Arrays{};
+		inline static std::map<ShareGroup::ID, std::map<Sampling, GLuint>> sm_Samplers{};
+		inline static std::size_t sm_ArrayBudget = 128 * 1024 * 1024;
+	};
+
+} // OORenderer
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "OORenderer/Texture.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// Process wide cache of loaded textures, so each image is loaded once however many models use it.
+	/// Textures stay cached while anything holds them, once released they're kept within a memory budget
+	/// and evicted least recently used first.
+	/// </summary>
+	class TextureCache {
+	public: // Public objects
+		enum class KeyMode {
+			CanonicalPath, // Same file, same texture
+			ContentHash    // Same bytes, same texture, even under different paths. Costs reading each file on lookup
+		};
+
+	public: // Public static methods
+
+		/// <summary>
+		/// Get the texture for an image file, loading it in the background if it isn't cached
+		/// </summary>
+		/// <param name="texturePath">Path to the image file</param>
+		/// <returns>The cached texture, nullptr if the file doesn't exist</returns>
+		static std::shared_ptr<Texture> Acquire(const std::filesystem::path& texturePath);
+
+		/// <summary>
+		/// Choose how textures are identified, only affects lookups made afterwards. Default: KeyMode::CanonicalPath
+		/// </summary>
+		static void SetKeyMode(KeyMode keyMode);
+
+		/// <summary>
+		/// Set how many bytes of released textures may be kept for reuse, evicting any over budget straight away. Default: 256 MiB
+		/// </summary>
+		/// <param name="bytes">Budget in bytes, 0 evicts textures as soon as they're released</param>
+		static void SetMemoryBudget(std::size_t bytes);
+
+		static std::size_t GetMemoryBudget();
+
+		/// <summary>
+		/// Get the bytes held by released textures kept for reuse
+		/// </summary>
+		static std::size_t GetReleasedMemory();
+
+		/// <summary>
+		/// Get the number of cached textures, whether in use or not
+		/// </summary>
+		static std::size_t GetTextureCount();
+
+		/// <summary>
+		/// Evict every released texture
+		/// </summary>
+		static void EvictReleased();
+
+	private: // Private objects
+		struct Entry {
+			// Keeps the texture alive while released, users hold it through the handle's deleter
+			std::shared_ptr<Texture> Resident;
+			std::weak_ptr<Texture> Handle;
+
+			// Position in the released list, only valid while released
+			std::list<std::string>::iterator ReleasedIt;
+			std::size_t ReleasedBytes = 0;
+			bool Released = false;
+		};
+
+	private: // Private static methods
+		static std::string BuildKey(const std::filesystem::path& texturePath);
+		static std::shared_ptr<Texture> MakeHandle(const std::string& key, Entry& entry);
+		static void Release(const std::string& key, Texture* texture);
+
+		// Expects sm_Mutex held
+		static void EvictOverBudget(std::size_t budget);
+
+	private: // Private static members
+		inline static std::mutex sm_Mutex{};
+		inline static std::unordered_map<std::string, Entry> sm_Entries{};
+
+		// Released entries, least recently released at the front
+		inline static std::list<std::string> sm_Released{};
+		inline static std::size_t sm_ReleasedBytes = 0;
+
+		inline static std::size_t sm_MemoryBudget = 256ull * 1024 * 1024;
+		inline static KeyMode sm_KeyMode = KeyMode::CanonicalPath;
+	};
+
+} // OORenderer
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OORenderer {
+
+	/// <summary>
+	/// Fixed size pool of worker threads running queued jobs in submission order. Jobs must not touch OpenGL.
+	/// </summary>
+	class ThreadPool {
+	public: // Public methods
+		explicit ThreadPool(unsigned int threadCount);
+
+		/// <summary>
+		/// Finishes every queued job, then joins the workers
+		/// </summary>
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		/// <summary>
+		/// Queue a job to run on the next free worker
+		/// </summary>
+		void Submit(std::function<void()> job);
+
+		unsigned int GetThreadCount() const;
+
+	private: // Private methods
+		void WorkerLoop();
+
+	private: // Private members
+		std::vector<std::thread> m_Workers;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_JobAvailable;
+		std::deque<std::function<void()>> m_Jobs;
+		bool m_Stopping = false;
+	};
+
+} // OORenderer
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <glad/glad.h>
+
+#include "OORenderer/Window.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// An OpenGL uniform buffer object, backing one or more uniform blocks. See Std140.h for laying out its contents.
+	/// </summary>
+	class UniformBuffer {
+	public:
+		/// <summary>
+		/// Create a uniform buffer on the given window's context
+		/// </summary>
+		/// <param name="window">Window to create the buffer on</param>
+		/// <param name="size">Size of the buffer in bytes</param>
+		/// <param name="usage">OpenGL usage hint, e.g. GL_DYNAMIC_DRAW</param>
+		UniformBuffer(const Window& window, std::size_t size, GLenum usage = GL_DYNAMIC_DRAW);
+		~UniformBuffer();
+
+		UniformBuffer(const UniformBuffer&) = delete;
+		UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+		/// <summary>
+		/// Write to part of the buffer
+		/// </summary>
+		/// <param name="offset">Offset in bytes to write to</param>
+		/// <param name="size">Number of bytes to write</param>
+		/// <param name="data">Data to write</param>
+		void SetData(std::size_t offset, std::size_t size, const void* data);
+
+		/// <summary>
+		/// Bind the whole buffer to a uniform buffer binding point, blocks bound to that point then read from this buffer
+		/// </summary>
+		/// <param name="binding">Binding point</param>
+		void BindToPoint(GLuint binding);
+
+		/// <summary>
+		/// Return the OpenGL buffer ID for this buffer
+		/// </summary>
+		/// <returns>OpenGL buffer ID</returns>
+		unsigned int GetBufferID() const;
+
+		/// <summary>
+		/// Get the size of this buffer
+		/// </summary>
+		/// <returns>Size in bytes</returns>
+		std::size_t GetSize() const;
+
+		/// <summary>
+		/// Get the GLFW context this buffer was created on
+		/// </summary>
+		/// <returns>Pointer to the GLFW window this buffer is bound to</returns>
+		GLFWwindow* GetGLFWWindow() const;
+
+	private: // Private members
+		GLFWwindow* m_Window;
+		unsigned int m_BufferID = 0;
+		std::size_t m_Size;
+	};
+
+} // OORenderer
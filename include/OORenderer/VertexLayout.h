@@ -0,0 +1,237 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+namespace OORenderer {
+
+	/// <summary>
+	/// Full precision vertex, what meshes are built from and cached as. Its GPU layout is chosen by a VertexLayout
+	/// </summary>
+	struct StandardVertex {
+		glm::vec3 Position;
+		glm::vec3 Normal;
+		glm::vec2 TexCoords;
+	};
+
+	/// <summary>
+	/// Axis aligned bounds of a mesh's positions, used to quantize them
+	/// </summary>
+	struct PositionBounds {
+		glm::vec3 Min{ 0.0f };
+		glm::vec3 Max{ 0.0f };
+
+		static PositionBounds Of(std::span<const StandardVertex> vertices);
+	};
+
+	/// <summary>
+	/// Runtime description of a vertex layout, what a mesh needs to upload and bind one
+	/// </summary>
+	struct VertexLayoutDescription {
+		struct Attribute {
+			GLuint Location;
+			GLint Components;
+			GLenum Type;
+			GLboolean Normalized;
+			std::size_t Offset;
+		};
+
+		std::size_t Stride;
+		std::array<Attribute, 3> Attributes;
+
+		// Quantized positions are relative to the mesh bounds, shaders apply the mesh's positionDequantization matrix
+		bool QuantizesPositions;
+
+		// Encode vertices into Stride sized elements of destination
+		void (*Encode)(std::span<const StandardVertex> vertices, const PositionBounds& bounds, std::byte* destination);
+	};
+
+	/// <summary>
+	/// Attribute formats. Each gives its storage, how OpenGL reads it, and how to encode it from full precision
+	/// </summary>
+	namespace VertexAttributes {
+
+		struct PositionFloat3 {
+			using Storage = glm::vec3;
+			static constexpr GLint Components = 3;
+			static constexpr GLenum Type = GL_FLOAT;
+			static constexpr GLboolean Normalized = GL_FALSE;
+			static constexpr bool UsesBounds = false;
+
+			static Storage Encode(const glm::vec3& position, const PositionBounds&) {
+				return position;
+			}
+		};
+
+		// Only suits meshes with small coordinates, half floats keep 11 bits of precision
+		struct PositionHalf3 {
+			using Storage = std::array<std::uint16_t, 4>; // Padded to keep attributes 4 byte aligned
+			static constexpr GLint Components = 3;
+			static constexpr GLenum Type = GL_HALF_FLOAT;
+			static constexpr GLboolean Normalized = GL_FALSE;
+			static constexpr bool UsesBounds = false;
+
+			static Storage Encode(const glm::vec3& position, const PositionBounds&) {
+				return { glm::packHalf1x16(position.x), glm::packHalf1x16(position.y), glm::packHalf1x16(position.z), 0 };
+			}
+		};
+
+		// 16 bits per axis across the mesh bounds, needs the positionDequantization matrix in the shader
+		struct PositionBoundsUNorm16 {
+			using Storage = std::array<std::uint16_t, 4>; // Padded to keep attributes 4 byte aligned
+			static constexpr GLint Components = 3;
+			static constexpr GLenum Type = GL_UNSIGNED_SHORT;
+			static constexpr GLboolean Normalized = GL_TRUE;
+			static constexpr bool UsesBounds = true;
+
+			static Storage Encode(const glm::vec3& position, const PositionBounds& bounds) {
+				glm::vec3 extent = glm::max(bounds.Max - bounds.Min, glm::vec3{ 1e-20f });
+				glm::vec3 relative = (position - bounds.Min) / extent;
+				return { glm::packUnorm1x16(relative.x), glm::packUnorm1x16(relative.y), glm::packUnorm1x16(relative.z), 0 };
+			}
+		};
+
+		struct NormalFloat3 {
+			using Storage = glm::vec3;
+			static constexpr GLint Components = 3;
+			static constexpr GLenum Type = GL_FLOAT;
+			static constexpr GLboolean Normalized = GL_FALSE;
+
+			static Storage Encode(const glm::vec3& normal) {
+				return normal;
+			}
+		};
+
+		// Read as a vec3 with no shader changes
+		struct NormalSNorm10 {
+			using Storage = std::uint32_t;
+			static constexpr GLint Components = 4;
+			static constexpr GLenum Type = GL_INT_2_10_10_10_REV;
+			static constexpr GLboolean Normalized = GL_TRUE;
+
+			static Storage Encode(const glm::vec3& normal) {
+				return glm::packSnorm3x10_1x2(glm::vec4{ normal, 0.0f });
+			}
+		};
+
+		// Octahedral mapping, the most precise per bit but shaders must decode it, see the README
+		struct NormalOctahedralSNorm16 {
+			using Storage = std::array<std::int16_t, 2>;
+			static constexpr GLint Components = 2;
+			static constexpr GLenum Type = GL_SHORT;
+			static constexpr GLboolean Normalized = GL_TRUE;
+
+			static Storage Encode(const glm::vec3& normal) {
+				glm::vec3 n = normal / (std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z) + 1e-20f);
+				glm::vec2 octahedral{ n.x, n.y };
+				if (n.z < 0.0f) {
+					octahedral = (1.0f - glm::abs(glm::vec2{ n.y, n.x })) * glm::vec2{ n.x >= 0.0f ? 1.0f : -1.0f, n.y >= 0.0f ? 1.0f : -1.0f };
+				}
+				return { static_cast<std::int16_t>(glm::packSnorm1x16(octahedral.x)), static_cast<std::int16_t>(glm::packSnorm1x16(octahedral.y)) };
+			}
+		};
+
+		struct TexCoordFloat2 {
+			using Storage = glm::vec2;
+			static constexpr GLint Components = 2;
+			static constexpr GLenum Type = GL_FLOAT;
+			static constexpr GLboolean Normalized = GL_FALSE;
+
+			static Storage Encode(const glm::vec2& texCoords) {
+				return texCoords;
+			}
+		};
+
+		// Suits repeating UVs
+		struct TexCoordHalf2 {
+			using Storage = std::array<std::uint16_t, 2>;
+			static constexpr GLint Components = 2;
+			static constexpr GLenum Type = GL_HALF_FLOAT;
+			static constexpr GLboolean Normalized = GL_FALSE;
+
+			static Storage Encode(const glm::vec2& texCoords) {
+				return { glm::packHalf1x16(texCoords.x), glm::packHalf1x16(texCoords.y) };
+			}
+		};
+
+		// Even precision across [0, 1], UVs outside that are clamped
+		struct TexCoordUNorm16 {
+			using Storage = std::array<std::uint16_t, 2>;
+			static constexpr GLint Components = 2;
+			static constexpr GLenum Type = GL_UNSIGNED_SHORT;
+			static constexpr GLboolean Normalized = GL_TRUE;
+
+			static Storage Encode(const glm::vec2& texCoords) {
+				return { glm::packUnorm1x16(texCoords.x), glm::packUnorm1x16(texCoords.y) };
+			}
+		};
+
+	} // VertexAttributes
+
+	/// <summary>
+	/// Interleaved GPU vertex layout built from attribute formats, bound to locations 0 (position), 1 (normal) and 2 (tex coords)
+	/// </summary>
+	template<typename TPosition, typename TNormal, typename TTexCoords>
+	struct VertexLayout {
+		struct Vertex {
+			typename TPosition::Storage Position;
+			typename TNormal::Storage Normal;
+			typename TTexCoords::Storage TexCoords;
+		};
+
+		static void Encode(std::span<const StandardVertex> vertices, const PositionBounds& bounds, std::byte* destination) {
+			for (const StandardVertex& vertex : vertices) {
+				Vertex encoded{
+					TPosition::Encode(vertex.Position, bounds),
+					TNormal::Encode(vertex.Normal),
+					TTexCoords::Encode(vertex.TexCoords)
+				};
+				std::memcpy(destination, &encoded, sizeof(Vertex));
+				destination += sizeof(Vertex);
+			}
+		}
+
+		static const VertexLayoutDescription& Describe() {
+			static const VertexLayoutDescription description{
+				.Stride = sizeof(Vertex),
+				.Attributes = { {
+					{ 0, TPosition::Components, TPosition::Type, TPosition::Normalized, offsetof(Vertex, Position) },
+					{ 1, TNormal::Components, TNormal::Type, TNormal::Normalized, offsetof(Vertex, Normal) },
+					{ 2, TTexCoords::Components, TTexCoords::Type, TTexCoords::Normalized, offsetof(Vertex, TexCoords) }
+				} },
+				.QuantizesPositions = TPosition::UsesBounds,
+				.Encode = &Encode
+			};
+			return description;
+		}
+	};
+
+	// 32 bytes, uploaded as is
+	using StandardVertexLayout = VertexLayout<VertexAttributes::PositionFloat3, VertexAttributes::NormalFloat3, VertexAttributes::TexCoordFloat2>;
+
+	// 16 bytes, shaders only need to apply positionDequantization
+	using CompactVertexLayout = VertexLayout<VertexAttributes::PositionBoundsUNorm16, VertexAttributes::NormalSNorm10, VertexAttributes::TexCoordHalf2>;
+
+	inline PositionBounds PositionBounds::Of(std::span<const StandardVertex> vertices) {
+		if (vertices.empty()) {
+			return {};
+		}
+
+		PositionBounds bounds{ vertices[0].Position, vertices[0].Position };
+		for (const StandardVertex& vertex : vertices) {
+			bounds.Min = glm::min(bounds.Min, vertex.Position);
+			bounds.Max = glm::max(bounds.Max, vertex.Position);
+		}
+		return bounds;
+	}
+
+} // OORenderer
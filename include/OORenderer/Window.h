@@ -1,11 +1,19 @@
 #pragma once
 
 #include <string>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <functional>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
 namespace OORenderer {
 
+	class GLFunctionTable;
+	class GLStateCache;
+	class ShareGroup;
+
 	class Window {
 	public: // Ctors and Dtors
 
@@ -16,7 +24,7 @@ namespace OORenderer {
 		/// <param name="height">The desired height, in screen coordinates, of the window. This must be greater than zero.</param>
 		/// <param name="title">The initial, UTF-8 encoded window title.</param>
 		/// <param name="monitor">The monitor to use for full screen mode, or NULL for windowed mode.</param>
-		/// <param name="share">The window whose context to share resources with, or NULL to not share resources.</param>
+		/// <param name="share">The window whose context to share resources with, or NULL to not share resources. See ShareGroup.</param>
 		/// <param name="setToCurrent">Immediately activate this window or not.</param>
 		Window(
 			int width,
@@ -31,11 +39,21 @@ namespace OORenderer {
 	public: // Public Static methods
 
 		/// <summary>
-		/// Set a given GLFWwindow to be the current GLFW context and bind OpenGL calls to it's viewport
+		/// Set a given GLFWwindow to be the current GLFW context and point OpenGL calls at it.
+		/// For windows owned by a Window this is a context switch and a function table swap, the viewport is
+		/// kept up to date by the resize callback rather than on every activation.
 		/// </summary>
 		/// <param name="window">GLFW window to make active</param>
 		static void ActivateGLFWWindow(GLFWwindow* window);
 
+		/// <summary>
+		/// Set the OpenGL version of contexts created from now on, core profile. Default: 3.3.
+		/// Windows fall back to 3.3 if the version isn't available, check HasContextVersion for what was granted
+		/// </summary>
+		/// <param name="major">Major version, e.g. 4</param>
+		/// <param name="minor">Minor version, e.g. 6</param>
+		static void SetContextVersion(int major, int minor);
+
 	public: // Public methods
 
 		/// <summary>
@@ -74,9 +92,45 @@ namespace OORenderer {
 
 		/// <summary>
 		/// Switch the rendering and display buffers for this window (call once per frame most likely)
+		/// Not needed with a render thread, which swaps after every submitted frame.
 		/// </summary>
 		void UpdateDisplay();
 
+		/// <summary>
+		/// Move this window's rendering to a thread of its own, with the context current there until StopRenderThread.
+		/// Frames are then handed over with SubmitFrame and swapped on that thread, so a window blocking on vsync holds up no other.
+		/// Events and callbacks stay on the main thread, which must no longer activate this window.
+		/// Create every window before starting render threads, loading a context's entry points rewrites the functions all threads call.
+		/// Frames drawing shared objects must not upload to or delete them, load such objects while no frames are queued.
+		/// </summary>
+		/// <param name="maxQueuedFrames">Frames that may be waiting or drawing before SubmitFrame blocks. Default: 2</param>
+		/// <returns>True if started, false if the contexts loaded need differing entry points, which threads can't use at once</returns>
+		bool StartRenderThread(unsigned int maxQueuedFrames = 2);
+
+		/// <summary>
+		/// Draw every frame still queued, then end the render thread. The context is left current on no thread
+		/// </summary>
+		void StopRenderThread();
+
+		/// <summary>
+		/// Determine if this window renders on a thread of its own
+		/// </summary>
+		/// <returns>True if so, false otherwise</returns>
+		bool HasRenderThread() const;
+
+		/// <summary>
+		/// Queue a frame to be drawn on this window's render thread, followed by a buffer swap. Blocks while the queue is full.
+		/// The frame runs after this returns, so it should capture by value whatever the caller goes on to change, e.g. camera matrices.
+		/// Without a render thread the frame is drawn and swapped straight away on this window's context.
+		/// </summary>
+		/// <param name="frame">OpenGL calls making up the frame</param>
+		void SubmitFrame(std::function<void()> frame);
+
+		/// <summary>
+		/// Block until every frame submitted has been drawn and swapped
+		/// </summary>
+		void WaitForFrames();
+
 		/// <summary>
 		/// Request the users attention (OS specific in how this is implemented)
 		/// </summary>
@@ -96,6 +150,27 @@ namespace OORenderer {
 		/// <returns>Current height in screen space terms</returns>
 		int GetHeight() const;
 
+		/// <summary>
+		/// Get the aspect ratio of this windows framebuffer, as of the last resize callback
+		/// </summary>
+		/// <returns>Width over height in pixels, 0 while minimised</returns>
+		float GetAspectRatio() const;
+
+		/// <summary>
+		/// Get the number of times this windows framebuffer has been resized, to tell if anything sized to it is out of date
+		/// </summary>
+		/// <returns>Framebuffer resize count</returns>
+		std::uint64_t GetResizeCount() const;
+
+		/// <summary>
+		/// Determine if this window's context is at least a given OpenGL version, as granted when it was created.
+		/// Unlike GLAD_GL_VERSION_X_Y this needn't have the window active
+		/// </summary>
+		/// <param name="major">Major version, e.g. 4</param>
+		/// <param name="minor">Minor version, e.g. 3</param>
+		/// <returns>True if so, false otherwise</returns>
+		bool HasContextVersion(int major, int minor) const;
+
 		/// <summary>
 		/// Register your own callback to be called when the framebuffer resizes
 		/// Only one may be registered at a time
@@ -126,19 +201,57 @@ namespace OORenderer {
 		/// <returns>GLFW window this window wraps</returns>
 		GLFWwindow* GetGLFWWindow() const;
 
+		/// <summary>
+		/// Get the group of windows this window shares OpenGL objects with
+		/// </summary>
+		/// <returns>This window's share group, a group of one if it shares with nothing</returns>
+		ShareGroup* GetShareGroup() const;
+
+		/// <summary>
+		/// Get the cache of what this window's context has bound, including counts of the binds it saved the last frame.
+		/// Use on the thread rendering this window
+		/// </summary>
+		/// <returns>This window's state cache</returns>
+		GLStateCache& GetStateCache() const;
+
 	protected: // Protected methods
 		void FramebufferSizeCallback(int width, int height);
 		void FocusCallback(int focused);
 		void KeyCallback(int key, int scancode, int action, int mods);
 
+	private: // Private objects
+		// Frame queue of a render thread, defined in Window.cpp
+		struct RenderThread;
+
+	private: // Private methods
+		void RenderThreadLoop();
+
 	private: // Private members
 		int m_Width;
 		int m_Height;
+		// Written by the resize callback, read by whichever thread recalculates cameras
+		std::atomic<int> m_FramebufferWidth = 0;
+		std::atomic<int> m_FramebufferHeight = 0;
+		std::atomic<std::uint64_t> m_ResizeCount = 0;
+		int m_ContextVersionMajor = 0;
+		int m_ContextVersionMinor = 0;
 		GLFWwindow* m_GLFWWindow;
 		GLFWkeyfun m_ExternKeyCallback;
 		GLFWwindowfocusfun m_ExternFocusCallback;
 		GLFWframebuffersizefun m_ExternFramebufferResizeCallback;
 
+		// OpenGL entry points for this window's context, loaded once on creation
+		std::shared_ptr<const GLFunctionTable> m_GLFunctionTable;
+
+		// What this window's context has bound
+		std::unique_ptr<GLStateCache> m_StateCache;
+
+		// Windows we share objects with, including ourselves
+		std::shared_ptr<ShareGroup> m_ShareGroup;
+
+		// Set while rendering on a thread of our own
+		std::unique_ptr<RenderThread> m_RenderThread;
+
 	private: // Friends
 		friend void StaticFramebufferSizeCallback(GLFWwindow* window, int width, int height);
 		friend void StaticFocusCallback(GLFWwindow* window, int focused);
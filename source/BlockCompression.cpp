@@ -0,0 +1,414 @@
+#include "BlockCompression.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+#include "GLFunctionTable.h"
+
+namespace OORenderer {
+
+	// S3TC formats come from an extension GLAD wasn't generated with
+	static constexpr GLenum s_CompressedRGBS3TCDXT1 = 0x83F0;
+	static constexpr GLenum s_CompressedRGBAS3TCDXT5 = 0x83F3;
+
+	// BC7 4 bit index interpolation weights, out of 64
+	static constexpr std::array<int, 16> s_BC7Weights = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	using BlockTexels = std::array<std::array<std::uint8_t, 4>, 16>;
+
+	static void LoadBlockTexels(const std::uint8_t* rgba, int width, int height, int blockX, int blockY, BlockTexels& texels) {
+		for (int y = 0; y < 4; ++y) {
+			int sourceY = std::min(blockY * 4 + y, height - 1);
+			for (int x = 0; x < 4; ++x) {
+				int sourceX = std::min(blockX * 4 + x, width - 1);
+				std::memcpy(texels[y * 4 + x].data(), rgba + (static_cast<std::size_t>(sourceY) * width + sourceX) * 4, 4);
+			}
+		}
+	}
+
+	static void PutBits(std::uint8_t* block, int& bitPosition, std::uint32_t value, int count) {
+		for (int i = 0; i < count; ++i, ++bitPosition) {
+			if ((value >> i) & 1) {
+				block[bitPosition / 8] |= static_cast<std::uint8_t>(1 << (bitPosition % 8));
+			}
+		}
+	}
+
+	/// <summary>
+	/// Pick the texels at either end of the block's principal axis over the first N channels
+	/// </summary>
+	template<int N>
+	static void FindEndpoints(const BlockTexels& texels, std::array<float, N>& low, std::array<float, N>& high) {
+		std::array<float, N> mean{};
+		for (const auto& texel : texels) {
+			for (int c = 0; c < N; ++c) {
+				mean[c] += texel[c] / 16.0f;
+			}
+		}
+
+		std::array<std::array<float, N>, N> covariance{};
+		for (const auto& texel : texels) {
+			for (int i = 0; i < N; ++i) {
+				for (int j = 0; j < N; ++j) {
+					covariance[i][j] += (texel[i] - mean[i]) * (texel[j] - mean[j]);
+				}
+			}
+		}
+
+		// Power iteration for the dominant eigenvector
+		std::array<float, N> axis;
+		axis.fill(1.0f);
+		for (int iteration = 0; iteration < 8; ++iteration) {
+			std::array<float, N> next{};
+			for (int i = 0; i < N; ++i) {
+				for (int j = 0; j < N; ++j) {
+					next[i] += covariance[i][j] * axis[j];
+				}
+			}
+
+			float largest = 0.0f;
+			for (float value : next) {
+				largest = std::max(largest, std::abs(value));
+			}
+			if (largest == 0.0f) {
+				break; // Flat block, any axis will do
+			}
+			for (int i = 0; i < N; ++i) {
+				axis[i] = next[i] / largest;
+			}
+		}
+
+		float minProjection = std::numeric_limits<float>::max();
+		float maxProjection = std::numeric_limits<float>::lowest();
+		for (const auto& texel : texels) {
+			float projection = 0.0f;
+			for (int c = 0; c < N; ++c) {
+				projection += (texel[c] - mean[c]) * axis[c];
+			}
+			if (projection < minProjection) {
+				minProjection = projection;
+				for (int c = 0; c < N; ++c) low[c] = texel[c];
+			}
+			if (projection > maxProjection) {
+				maxProjection = projection;
+				for (int c = 0; c < N; ++c) high[c] = texel[c];
+			}
+		}
+	}
+
+	template<int N, int PaletteSize>
+	static int NearestPaletteEntry(const std::array<std::uint8_t, 4>& texel, const std::array<std::array<float, N>, PaletteSize>& palette, int firstChannel = 0) {
+		int nearest = 0;
+		float nearestDistance = std::numeric_limits<float>::max();
+		for (int i = 0; i < PaletteSize; ++i) {
+			float distance = 0.0f;
+			for (int c = 0; c < N; ++c) {
+				float difference = texel[firstChannel + c] - palette[i][c];
+				distance += difference * difference;
+			}
+			if (distance < nearestDistance) {
+				nearestDistance = distance;
+				nearest = i;
+			}
+		}
+		return nearest;
+	}
+
+	static std::uint16_t To565(const std::array<float, 3>& colour) {
+		auto quantize = [](float value, int maxValue) {
+			return static_cast<std::uint16_t>(std::clamp(static_cast<int>(std::lround(value * maxValue / 255.0f)), 0, maxValue));
+		};
+		return static_cast<std::uint16_t>((quantize(colour[0], 31) << 11) | (quantize(colour[1], 63) << 5) | quantize(colour[2], 31));
+	}
+
+	static std::array<float, 3> From565(std::uint16_t colour) {
+		int r = (colour >> 11) & 31;
+		int g = (colour >> 5) & 63;
+		int b = colour & 31;
+		return { static_cast<float>((r << 3) | (r >> 2)), static_cast<float>((g << 2) | (g >> 4)), static_cast<float>((b << 3) | (b >> 2)) };
+	}
+
+	static void EncodeColourBlock(const BlockTexels& texels, std::uint8_t* block) {
+		std::array<float, 3> low, high;
+		FindEndpoints<3>(texels, low, high);
+
+		// Colour 0 above colour 1 selects four colour mode
+		std::uint16_t colour0 = To565(high);
+		std::uint16_t colour1 = To565(low);
+		if (colour0 < colour1) {
+			std::swap(colour0, colour1);
+		}
+
+		std::uint32_t indices = 0;
+		if (colour0 != colour1) {
+			std::array<std::array<float, 3>, 4> palette;
+			palette[0] = From565(colour0);
+			palette[1] = From565(colour1);
+			for (int c = 0; c < 3; ++c) {
+				palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f;
+				palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+			}
+
+			for (int i = 0; i < 16; ++i) {
+				indices |= static_cast<std::uint32_t>(NearestPaletteEntry<3, 4>(texels[i], palette)) << (2 * i);
+			}
+		}
+
+		block[0] = colour0 & 0xFF;
+		block[1] = colour0 >> 8;
+		block[2] = colour1 & 0xFF;
+		block[3] = colour1 >> 8;
+		for (int i = 0; i < 4; ++i) {
+			block[4 + i] = (indices >> (8 * i)) & 0xFF;
+		}
+	}
+
+	static void EncodeSingleChannelBlock(const BlockTexels& texels, int channel, std::uint8_t* block) {
+		std::uint8_t low = 255;
+		std::uint8_t high = 0;
+		for (const auto& texel : texels) {
+			low = std::min(low, texel[channel]);
+			high = std::max(high, texel[channel]);
+		}
+
+		// Endpoint 0 above endpoint 1 selects eight value mode
+		block[0] = high;
+		block[1] = low;
+
+		std::uint64_t indices = 0;
+		if (high != low) {
+			std::array<std::array<float, 1>, 8> palette;
+			palette[0][0] = high;
+			palette[1][0] = low;
+			for (int i = 2; i < 8; ++i) {
+				palette[i][0] = ((8 - i) * high + (i - 1) * low) / 7.0f;
+			}
+
+			for (int i = 0; i < 16; ++i) {
+				indices |= static_cast<std::uint64_t>(NearestPaletteEntry<1, 8>(texels[i], palette, channel)) << (3 * i);
+			}
+		}
+
+		for (int i = 0; i < 6; ++i) {
+			block[2 + i] = (indices >> (8 * i)) & 0xFF;
+		}
+	}
+
+	static void EncodeBC7Mode6Block(const BlockTexels& texels, std::uint8_t* block) {
+		std::array<float, 4> low, high;
+		FindEndpoints<4>(texels, low, high);
+
+		// Endpoints are 7 bits per channel plus one shared low bit per endpoint
+		struct Endpoint {
+			std::array<int, 4> Quantized;
+			int PBit;
+			std::array<int, 4> Value;
+		};
+		auto quantize = [](const std::array<float, 4>& colour) {
+			Endpoint best{};
+			float bestError = std::numeric_limits<float>::max();
+			for (int pBit = 0; pBit < 2; ++pBit) {
+				Endpoint candidate{ .Quantized = {}, .PBit = pBit, .Value = {} };
+				float error = 0.0f;
+				for (int c = 0; c < 4; ++c) {
+					candidate.Quantized[c] = std::clamp(static_cast<int>(std::lround((colour[c] - pBit) / 2.0f)), 0, 127);
+					candidate.Value[c] = (candidate.Quantized[c] << 1) | pBit;
+					error += (candidate.Value[c] - colour[c]) * (candidate.Value[c] - colour[c]);
+				}
+				if (error < bestError) {
+					bestError = error;
+					best = candidate;
+				}
+			}
+			return best;
+		};
+		Endpoint endpoint0 = quantize(low);
+		Endpoint endpoint1 = quantize(high);
+
+		std::array<std::array<float, 4>, 16> palette;
+		for (int i = 0; i < 16; ++i) {
+			for (int c = 0; c < 4; ++c) {
+				palette[i][c] = static_cast<float>(((64 - s_BC7Weights[i]) * endpoint0.Value[c] + s_BC7Weights[i] * endpoint1.Value[c] + 32) >> 6);
+			}
+		}
+
+		std::array<int, 16> indices;
+		for (int i = 0; i < 16; ++i) {
+			indices[i] = NearestPaletteEntry<4, 16>(texels[i], palette);
+		}
+
+		// The first index is stored without its top bit, which must therefore be zero
+		if (indices[0] & 8) {
+			std::swap(endpoint0, endpoint1);
+			for (int& index : indices) {
+				index = 15 - index;
+			}
+		}
+
+		std::memset(block, 0, 16);
+		int bitPosition = 0;
+		PutBits(block, bitPosition, 1 << 6, 7); // Mode 6
+		for (int c = 0; c < 4; ++c) {
+			PutBits(block, bitPosition, endpoint0.Quantized[c], 7);
+			PutBits(block, bitPosition, endpoint1.Quantized[c], 7);
+		}
+		PutBits(block, bitPosition, endpoint0.PBit, 1);
+		PutBits(block, bitPosition, endpoint1.PBit, 1);
+		PutBits(block, bitPosition, indices[0], 3);
+		for (int i = 1; i < 16; ++i) {
+			PutBits(block, bitPosition, indices[i], 4);
+		}
+	}
+
+	std::size_t CompressedImage::GetSize() const {
+		return std::accumulate(Levels.begin(), Levels.end(), std::size_t{ 0 },
+			[](std::size_t total, std::span<const std::byte> level) { return total + level.size(); });
+	}
+
+	namespace BlockCompression {
+
+		std::size_t GetBlockSize(BlockFormat format) {
+			switch (format) {
+			case BlockFormat::BC1:
+			case BlockFormat::BC4:
+				return 8;
+			default:
+				return 16;
+			}
+		}
+
+		GLenum GetGLInternalFormat(BlockFormat format) {
+			switch (format) {
+			case BlockFormat::BC1: return s_CompressedRGBS3TCDXT1;
+			case BlockFormat::BC3: return s_CompressedRGBAS3TCDXT5;
+			case BlockFormat::BC4: return GL_COMPRESSED_RED_RGTC1;
+			case BlockFormat::BC5: return GL_COMPRESSED_RG_RGTC2;
+			case BlockFormat::BC7: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+			}
+			return GL_NONE;
+		}
+
+		bool IsSupportedOnCurrentContext(BlockFormat format) {
+			GLenum internalFormat = GetGLInternalFormat(format);
+			if (const GLFunctionTable* table = GLFunctionTable::GetInstalled()) {
+				return table->SupportsCompressedFormat(internalFormat);
+			}
+
+			// GLAD was loaded by other means, so there's no list kept for this context
+			std::vector<GLint> formats = GLFunctionTable::QueryCompressedFormats();
+			return std::ranges::find(formats, static_cast<GLint>(internalFormat)) != formats.end();
+		}
+
+		bool IsSupportedOnEveryContext(BlockFormat format) {
+			return GLFunctionTable::SupportsCompressedFormatEverywhere(GetGLInternalFormat(format));
+		}
+
+		std::vector<std::byte> Encode(BlockFormat format, const std::uint8_t* rgba, int width, int height) {
+			int blocksX = (width + 3) / 4;
+			int blocksY = (height + 3) / 4;
+			std::size_t blockSize = GetBlockSize(format);
+
+			std::vector<std::byte> encoded(static_cast<std::size_t>(blocksX) * blocksY * blockSize);
+			BlockTexels texels;
+			for (int blockY = 0; blockY < blocksY; ++blockY) {
+				for (int blockX = 0; blockX < blocksX; ++blockX) {
+					LoadBlockTexels(rgba, width, height, blockX, blockY, texels);
+					std::uint8_t* block = reinterpret_cast<std::uint8_t*>(encoded.data() + (static_cast<std::size_t>(blockY) * blocksX + blockX) * blockSize);
+
+					switch (format) {
+					case BlockFormat::BC1:
+						EncodeColourBlock(texels, block);
+						break;
+					case BlockFormat::BC3:
+						EncodeSingleChannelBlock(texels, 3, block);
+						EncodeColourBlock(texels, block + 8);
+						break;
+					case BlockFormat::BC4:
+						EncodeSingleChannelBlock(texels, 0, block);
+						break;
+					case BlockFormat::BC5:
+						EncodeSingleChannelBlock(texels, 0, block);
+						EncodeSingleChannelBlock(texels, 1, block + 8);
+						break;
+					case BlockFormat::BC7:
+						EncodeBC7Mode6Block(texels, block);
+						break;
+					}
+				}
+			}
+			return encoded;
+		}
+
+		std::vector<std::uint8_t> ExpandToRGBA(const unsigned char* data, int width, int height, int numChannels) {
+			std::size_t texelCount = static_cast<std::size_t>(width) * height;
+			std::vector<std::uint8_t> rgba(texelCount * 4);
+			for (std::size_t i = 0; i < texelCount; ++i) {
+				std::uint8_t* texel = &rgba[i * 4];
+				texel[0] = texel[1] = texel[2] = 0;
+				texel[3] = 255;
+				for (int c = 0; c < numChannels; ++c) {
+					texel[c] = data[i * numChannels + c];
+				}
+			}
+			return rgba;
+		}
+
+		std::vector<std::uint8_t> Downsample(const std::vector<std::uint8_t>& rgba, int width, int height) {
+			int nextWidth = std::max(width / 2, 1);
+			int nextHeight = std::max(height / 2, 1);
+
+			std::vector<std::uint8_t> next(static_cast<std::size_t>(nextWidth) * nextHeight * 4);
+			for (int y = 0; y < nextHeight; ++y) {
+				int y0 = std::min(y * 2, height - 1);
+				int y1 = std::min(y * 2 + 1, height - 1);
+				for (int x = 0; x < nextWidth; ++x) {
+					int x0 = std::min(x * 2, width - 1);
+					int x1 = std::min(x * 2 + 1, width - 1);
+					for (int c = 0; c < 4; ++c) {
+						int sum = rgba[(static_cast<std::size_t>(y0) * width + x0) * 4 + c] + rgba[(static_cast<std::size_t>(y0) * width + x1) * 4 + c]
+							+ rgba[(static_cast<std::size_t>(y1) * width + x0) * 4 + c] + rgba[(static_cast<std::size_t>(y1) * width + x1) * 4 + c];
+						next[(static_cast<std::size_t>(y) * nextWidth + x) * 4 + c] = static_cast<std::uint8_t>((sum + 2) / 4);
+					}
+				}
+			}
+			return next;
+		}
+
+		CompressedImage EncodeWithMips(BlockFormat format, const unsigned char* data, int width, int height, int numChannels) {
+			std::vector<std::vector<std::byte>> levels;
+			std::vector<std::uint8_t> rgba = ExpandToRGBA(data, width, height, numChannels);
+
+			int levelWidth = width;
+			int levelHeight = height;
+			while (true) {
+				levels.push_back(Encode(format, rgba.data(), levelWidth, levelHeight));
+				if (levelWidth == 1 && levelHeight == 1) {
+					break;
+				}
+				rgba = Downsample(rgba, levelWidth, levelHeight);
+				levelWidth = std::max(levelWidth / 2, 1);
+				levelHeight = std::max(levelHeight / 2, 1);
+			}
+
+			// Pack every level into one allocation the image owns
+			auto packed = std::make_shared<std::vector<std::byte>>();
+			for (const auto& level : levels) {
+				packed->insert(packed->end(), level.begin(), level.end());
+			}
+
+			CompressedImage image{ .Format = format, .Width = width, .Height = height, .Backing = packed, .Levels = {} };
+			std::size_t offset = 0;
+			for (const auto& level : levels) {
+				image.Levels.emplace_back(packed->data() + offset, level.size());
+				offset += level.size();
+			}
+			return image;
+		}
+
+	} // BlockCompression
+
+} // OORenderer
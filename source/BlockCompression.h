@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace OORenderer {
+
+	/// <summary>
+	/// GPU block compressed formats we can encode. Every format works on 4x4 texel blocks.
+	/// </summary>
+	enum class BlockFormat : std::uint32_t {
+		BC1, // RGB, 8 bytes per block
+		BC3, // RGBA, BC1 colour plus a BC4 alpha block, 16 bytes per block
+		BC4, // R, 8 bytes per block
+		BC5, // RG, two BC4 blocks, 16 bytes per block
+		BC7  // RGBA, mode 6 only, 16 bytes per block
+	};
+
+	/// <summary>
+	/// A block compressed image with its full mip chain
+	/// </summary>
+	struct CompressedImage {
+		BlockFormat Format = BlockFormat::BC1;
+		int Width = 0;
+		int Height = 0;
+
+		// Whatever owns the memory Levels view, a file mapping or a vector
+		std::shared_ptr<const void> Backing;
+
+		// Largest first
+		std::vector<std::span<const std::byte>> Levels;
+
+		std::size_t GetSize() const;
+	};
+
+	namespace BlockCompression {
+
+		std::size_t GetBlockSize(BlockFormat format);
+
+		GLenum GetGLInternalFormat(BlockFormat format);
+
+		/// <summary>
+		/// Is the format among the current context's supported compressed formats
+		/// </summary>
+		bool IsSupportedOnCurrentContext(BlockFormat format);
+
+		/// <summary>
+		/// Is the format supported by every context created so far, so worth encoding to. Needs no context, for decode workers
+		/// </summary>
+		bool IsSupportedOnEveryContext(BlockFormat format);
+
+		/// <summary>
+		/// Encode an RGBA8 image, padding partial edge blocks by clamping
+		/// </summary>
+		/// <param name="format">Format to encode as</param>
+		/// <param name="rgba">Width * height RGBA8 texels</param>
+		/// <returns>Encoded blocks in row order</returns>
+		std::vector<std::byte> Encode(BlockFormat format, const std::uint8_t* rgba, int width, int height);
+
+		/// <summary>
+		/// Expand an image of any channel count to RGBA8
+		/// </summary>
+		std::vector<std::uint8_t> ExpandToRGBA(const unsigned char* data, int width, int height, int numChannels);
+
+		/// <summary>
+		/// Box filter an RGBA8 image down to the next mip level
+		/// </summary>
+		std::vector<std::uint8_t> Downsample(const std::vector<std::uint8_t>& rgba, int width, int height);
+
+		/// <summary>
+		/// Build and encode a full mip chain
+		/// </summary>
+		CompressedImage EncodeWithMips(BlockFormat format, const unsigned char* data, int width, int height, int numChannels);
+
+	} // BlockCompression
+
+} // OORenderer
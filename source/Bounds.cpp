@@ -0,0 +1,105 @@
+#include "OORenderer/Bounds.h"
+
+#include <algorithm>
+#include <array>
+
+namespace OORenderer {
+
+	glm::vec3 AABB::GetCenter() const {
+		return (Min + Max) * 0.5f;
+	}
+
+	glm::vec3 AABB::GetExtents() const {
+		return (Max - Min) * 0.5f;
+	}
+
+	AABB AABB::Transformed(const glm::mat4& transform) const {
+		// Arvo's method, the new extents are the old ones through the absolute rotation and scale
+		glm::vec3 center = transform * glm::vec4{ GetCenter(), 1.0f };
+		glm::mat3 absolute{ glm::abs(glm::vec3{ transform[0] }), glm::abs(glm::vec3{ transform[1] }), glm::abs(glm::vec3{ transform[2] }) };
+		glm::vec3 extents = absolute * GetExtents();
+		return { center - extents, center + extents };
+	}
+
+	AABB AABB::Merge(const AABB& a, const AABB& b) {
+		return { glm::min(a.Min, b.Min), glm::max(a.Max, b.Max) };
+	}
+
+	BoundingSphere BoundingSphere::Transformed(const glm::mat4& transform) const {
+		float scale = std::max({ glm::length(glm::vec3{ transform[0] }), glm::length(glm::vec3{ transform[1] }), glm::length(glm::vec3{ transform[2] }) });
+		return { glm::vec3{ transform * glm::vec4{ Center, 1.0f } }, Radius * scale };
+	}
+
+	BoundingSphere BoundingSphere::Merge(const BoundingSphere& a, const BoundingSphere& b) {
+		glm::vec3 offset = b.Center - a.Center;
+		float distance = glm::length(offset);
+
+		// One inside the other
+		if (distance + b.Radius <= a.Radius) {
+			return a;
+		}
+		if (distance + a.Radius <= b.Radius) {
+			return b;
+		}
+
+		float radius = (distance + a.Radius + b.Radius) * 0.5f;
+		return { a.Center + offset * ((radius - a.Radius) / distance), radius };
+	}
+
+	Bounds Bounds::Of(std::span<const StandardVertex> vertices) {
+		if (vertices.empty()) {
+			return {};
+		}
+
+		Bounds bounds{ .Box = { vertices[0].Position, vertices[0].Position } };
+		std::array<const glm::vec3*, 3> minPoints = { &vertices[0].Position, &vertices[0].Position, &vertices[0].Position };
+		std::array<const glm::vec3*, 3> maxPoints = minPoints;
+		for (const StandardVertex& vertex : vertices) {
+			bounds.Box.Min = glm::min(bounds.Box.Min, vertex.Position);
+			bounds.Box.Max = glm::max(bounds.Box.Max, vertex.Position);
+			for (int axis = 0; axis < 3; ++axis) {
+				if (vertex.Position[axis] < (*minPoints[axis])[axis]) {
+					minPoints[axis] = &vertex.Position;
+				}
+				if (vertex.Position[axis] > (*maxPoints[axis])[axis]) {
+					maxPoints[axis] = &vertex.Position;
+				}
+			}
+		}
+
+		// Start from the most separated pair of axis extremes, then grow to take in any point outside
+		int widestAxis = 0;
+		float widestDistance = 0.0f;
+		for (int axis = 0; axis < 3; ++axis) {
+			float distance = glm::distance(*minPoints[axis], *maxPoints[axis]);
+			if (distance > widestDistance) {
+				widestDistance = distance;
+				widestAxis = axis;
+			}
+		}
+		BoundingSphere& sphere = bounds.Sphere;
+		sphere.Center = (*minPoints[widestAxis] + *maxPoints[widestAxis]) * 0.5f;
+		sphere.Radius = widestDistance * 0.5f;
+
+		for (const StandardVertex& vertex : vertices) {
+			glm::vec3 offset = vertex.Position - sphere.Center;
+			float distance = glm::length(offset);
+			if (distance > sphere.Radius) {
+				float radius = (sphere.Radius + distance) * 0.5f;
+				sphere.Center += offset * ((radius - sphere.Radius) / distance);
+				sphere.Radius = radius;
+			}
+		}
+
+		return bounds;
+	}
+
+	Bounds Bounds::Transformed(const glm::mat4& transform) const {
+		return { Box.Transformed(transform), Sphere.Transformed(transform) };
+	}
+
+	Bounds Bounds::Merge(const Bounds& a, const Bounds& b) {
+		return { AABB::Merge(a.Box, b.Box), BoundingSphere::Merge(a.Sphere, b.Sphere) };
+	}
+
+} // OORenderer
@@ -1,32 +1,66 @@
 
 #include "OORenderer/Camera.h"
 
+#include <atomic>
 #include <glm/glm.hpp>
 #include <LoggingAD/LoggingAD.h>
 
 namespace OORenderer {
 
+	// Versions are handed out across all cameras, so no two sets of matrices share one
+	static std::atomic<std::uint64_t> s_NextVersion = 1;
+
 	Camera::Camera(glm::vec3 position, glm::vec3 direction)
 		: m_CameraUp(ms_WorldSpaceUp)
 	{
 		LoggingAD::Trace("Creating camera.");
-		int windowWidth = 0;
-		int windowHeight = 0;
-		glfwGetFramebufferSize(glfwGetCurrentContext(), &windowWidth, &windowHeight);
-		SetProjectionPerspective(1.0f, windowWidth / windowHeight, 0.1f, 100.0f);
 		RecalculateMatrices();
 	}
 
-	void Camera::RecalculateMatrices() {
-		// TODO                      \/
-		// Get updated projection - should probably only do on resize callback but we do in all cases for now
-		int windowWidth = 0;
-		int windowHeight = 0;
-		glfwGetFramebufferSize(glfwGetCurrentContext(), &windowWidth, &windowHeight);
-		SetProjectionPerspective(1.0f, windowWidth / windowHeight, 0.1f, 100.0f);
-
-		m_ViewMatrix = glm::lookAt(m_Position, m_Direction, m_CameraUp);
+	bool Camera::RecalculateMatrices() {
+		// Follow the bound window's framebuffer, only looked at when its resize callback has run since we last did
+		if (m_Window && m_Window->GetResizeCount() != m_WindowResizeCount) {
+			m_WindowResizeCount = m_Window->GetResizeCount();
+
+			// Minimised windows have no aspect ratio, keep the last
+			float aspectRatio = m_Window->GetAspectRatio();
+			if (aspectRatio > 0.0f && aspectRatio != m_AspectRatio) {
+				SetAspectRatio(aspectRatio);
+			}
+		}
+
+		if (!m_ViewDirty && !m_ProjectionDirty) {
+			return false;
+		}
+
+		if (m_ProjectionDirty && !m_OrthographicProjectionFlag) {
+			m_ProjectionMatrix = glm::perspective(m_FovRads, m_AspectRatio, m_Near, m_Far);
+		}
+		if (m_ViewDirty) {
+			m_ViewMatrix = glm::lookAt(m_Position, m_Direction, m_CameraUp);
+		}
 		m_PVMatrix = m_ProjectionMatrix * m_ViewMatrix;
+
+		m_ViewDirty = false;
+		m_ProjectionDirty = false;
+		m_Version = s_NextVersion.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	void Camera::BindToWindow(const Window& window) {
+		m_Window = &window;
+
+		// Differs from any real count, so the next recalculation takes the window's aspect ratio
+		m_WindowResizeCount = window.GetResizeCount() - 1;
+	}
+
+	void Camera::SetAspectRatio(float aspectRatio) {
+		m_AspectRatio = aspectRatio;
+		m_ProjectionDirty = true;
+	}
+
+	std::uint64_t Camera::GetVersion() const {
+		return m_Version;
 	}
 
 	glm::mat4 Camera::GetProjectionMatrix() const {
@@ -41,16 +75,23 @@ namespace OORenderer {
 		return m_PVMatrix;
 	}
 
+	glm::vec3 Camera::GetPosition() const {
+		return m_Position;
+	}
+
 	void Camera::LookAt(glm::vec3 position) {
 		m_Direction = glm::normalize(position - m_Position);
+		m_ViewDirty = true;
 	}
 
 	void Camera::MoveTo(glm::vec3 position) {
 		m_Position = position;
+		m_ViewDirty = true;
 	}
 
 	void Camera::Move(glm::vec3 displacement) {
 		m_Position += displacement;
+		m_ViewDirty = true;
 	}
 
 	void Camera::MoveForward(float distance) {
@@ -72,11 +113,16 @@ namespace OORenderer {
 	void Camera::SetProjectionOrthographic(float left, float right, float bottom, float top, float near, float far) {
 		m_ProjectionMatrix = glm::ortho(left, right, bottom, top, near, far);
 		m_OrthographicProjectionFlag = true;
+		m_ProjectionDirty = true;
 	}
 
 	void Camera::SetProjectionPerspective(float fovRads, float aspectRatio, float near, float far) {
-		m_ProjectionMatrix = glm::perspective(fovRads, aspectRatio, near, far);
+		m_FovRads = fovRads;
+		m_AspectRatio = aspectRatio;
+		m_Near = near;
+		m_Far = far;
 		m_OrthographicProjectionFlag = false;
+		m_ProjectionDirty = true;
 	}
 
 } // OORenderer
@@ -0,0 +1,61 @@
+#include "OORenderer/CameraUniforms.h"
+
+#include <algorithm>
+#include <LoggingAD/LoggingAD.h>
+
+namespace OORenderer {
+
+	CameraUniforms::CameraUniforms(const Window& window, std::size_t maxCameras)
+		: m_Buffer(window, std::max<std::size_t>(maxCameras, 1) * sm_Offsets.Stride),
+		m_Staging(std::max<std::size_t>(maxCameras, 1) * sm_Offsets.Stride),
+		m_SlotVersions(maxCameras, 0)
+	{
+		Bind();
+	}
+
+	std::size_t CameraUniforms::Update(std::span<Camera* const> cameras) {
+		if (cameras.size() > m_SlotVersions.size()) {
+			LoggingAD::Warning("[OORenderer::CameraUniforms::Update] Given {} cameras but only hold {}, publishing the first {}.", cameras.size(), m_SlotVersions.size(), m_SlotVersions.size());
+			cameras = cameras.first(m_SlotVersions.size());
+		}
+
+		// Stage the cameras that changed, tracking the range they span
+		std::size_t firstChanged = cameras.size();
+		std::size_t lastChanged = 0;
+		std::size_t written = 0;
+		for (std::size_t slot = 0; slot < cameras.size(); ++slot) {
+			Camera& camera = *cameras[slot];
+			camera.RecalculateMatrices();
+			if (camera.GetVersion() == m_SlotVersions[slot]) {
+				continue;
+			}
+			m_SlotVersions[slot] = camera.GetVersion();
+
+			std::byte* element = m_Staging.data() + slot * sm_Offsets.Stride;
+			Std140::Write(element, sm_Offsets.PVMatrix, camera.GetPVMatrix());
+			Std140::Write(element, sm_Offsets.ViewMatrix, camera.GetViewMatrix());
+			Std140::Write(element, sm_Offsets.ProjectionMatrix, camera.GetProjectionMatrix());
+			Std140::Write(element, sm_Offsets.CameraPosition, glm::vec4(camera.GetPosition(), 1.0f));
+
+			firstChanged = std::min(firstChanged, slot);
+			lastChanged = slot;
+			++written;
+		}
+
+		// One upload covering every changed slot, unchanged ones between them being written as they already are
+		if (written > 0) {
+			std::size_t offset = firstChanged * sm_Offsets.Stride;
+			m_Buffer.SetData(offset, (lastChanged + 1 - firstChanged) * sm_Offsets.Stride, m_Staging.data() + offset);
+		}
+		return written;
+	}
+
+	void CameraUniforms::Bind() {
+		m_Buffer.BindToPoint(BlockBinding);
+	}
+
+	std::size_t CameraUniforms::GetMaxCameras() const {
+		return m_SlotVersions.size();
+	}
+
+} // OORenderer
@@ -0,0 +1,147 @@
+#include "OORenderer/CommandList.h"
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "OORenderer/Window.h"
+#include "OORenderer/Model.h"
+#include "OORenderer/GLStateCache.h"
+
+namespace OORenderer {
+
+	// Records start aligned to this, their payloads read back with memcpy whatever their alignment
+	static constexpr std::size_t s_RecordAlignment = 8;
+
+	void CommandList::Draw(const Mesh& mesh, ShaderProgram& shader, const glm::mat4& modelMatrix, std::size_t lodLevel, RenderPass pass) {
+		DrawRecord record{ &mesh, &shader, modelMatrix, static_cast<std::uint32_t>(lodLevel), pass };
+		std::memcpy(AppendRecord(CommandType::Draw, sizeof(DrawRecord)), &record, sizeof(DrawRecord));
+	}
+
+	void CommandList::SetView(const glm::mat4& viewMatrix) {
+		std::memcpy(AppendRecord(CommandType::SetView, sizeof(glm::mat4)), &viewMatrix, sizeof(glm::mat4));
+	}
+
+	void CommandList::BindUniformBuffer(GLFWwindow* window, GLuint binding, unsigned int bufferID, std::size_t offset, std::size_t size) {
+		BindUniformBufferRecord record{ window, binding, bufferID, offset, size };
+		std::memcpy(AppendRecord(CommandType::BindUniformBuffer, sizeof(BindUniformBufferRecord)), &record, sizeof(BindUniformBufferRecord));
+	}
+
+	void CommandList::UploadTextures(Model& model) {
+		Model* modelPtr = &model;
+		std::memcpy(AppendRecord(CommandType::UploadTextures, sizeof(Model*)), &modelPtr, sizeof(Model*));
+	}
+
+	std::size_t CommandList::Replay(RenderQueue* queue) const {
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+
+		const std::byte* read = m_Arena.data();
+		const std::byte* end = read + m_Arena.size();
+		while (read < end) {
+			RecordHeader header;
+			std::memcpy(&header, read, sizeof(RecordHeader));
+			const std::byte* payload = read + sizeof(RecordHeader);
+
+			switch (header.Type) {
+			case CommandType::Draw: {
+				DrawRecord draw;
+				std::memcpy(&draw, payload, sizeof(DrawRecord));
+				if (queue) {
+					queue->Submit(*draw.DrawnMesh, *draw.Shader, draw.ModelMatrix, draw.LODLevel, draw.Pass);
+					break;
+				}
+				draw.Shader->UseProgram();
+				draw.DrawnMesh->Render(*draw.Shader, draw.ModelMatrix, draw.LODLevel);
+				break;
+			}
+			case CommandType::SetView: {
+				if (queue) {
+					glm::mat4 viewMatrix;
+					std::memcpy(&viewMatrix, payload, sizeof(glm::mat4));
+					queue->SetView(viewMatrix);
+				}
+				break;
+			}
+			case CommandType::SetUniform:
+				ReplayUniform(payload);
+				break;
+			case CommandType::BindUniformBuffer: {
+				BindUniformBufferRecord bind;
+				std::memcpy(&bind, payload, sizeof(BindUniformBufferRecord));
+				Window::ActivateGLFWWindow(bind.Window);
+				GLStateCache::Current().BindBufferRange(GL_UNIFORM_BUFFER, bind.Binding, bind.BufferID, bind.Offset, bind.Size);
+				break;
+			}
+			case CommandType::UploadTextures: {
+				Model* model;
+				std::memcpy(&model, payload, sizeof(Model*));
+				model->UploadDecodedTextures();
+				break;
+			}
+			}
+
+			read = payload + header.Size;
+		}
+
+		// Revert context
+		Window::ActivateGLFWWindow(oldContext);
+		return m_CommandCount;
+	}
+
+	void CommandList::Clear() {
+		m_Arena.clear();
+		m_CommandCount = 0;
+	}
+
+	std::size_t CommandList::GetCommandCount() const {
+		return m_CommandCount;
+	}
+
+	std::size_t CommandList::GetSize() const {
+		return m_Arena.size();
+	}
+
+	std::size_t CommandList::ReplayAll(std::span<const CommandList> lists, RenderQueue* queue) {
+		std::size_t commandCount = 0;
+		for (const CommandList& list : lists) {
+			commandCount += list.Replay(queue);
+		}
+		return commandCount;
+	}
+
+	std::byte* CommandList::AppendRecord(CommandType type, std::size_t payloadSize) {
+		// Padded so the next header starts aligned
+		std::size_t recordSize = (sizeof(RecordHeader) + payloadSize + s_RecordAlignment - 1) & ~(s_RecordAlignment - 1);
+		RecordHeader header{ type, static_cast<std::uint32_t>(recordSize - sizeof(RecordHeader)) };
+
+		std::size_t offset = m_Arena.size();
+		m_Arena.resize(offset + recordSize);
+		std::memcpy(m_Arena.data() + offset, &header, sizeof(RecordHeader));
+		++m_CommandCount;
+		return m_Arena.data() + offset + sizeof(RecordHeader);
+	}
+
+	void CommandList::ReplayUniform(const std::byte* payload) {
+		UniformRecord record;
+		std::memcpy(&record, payload, sizeof(UniformRecord));
+		const std::byte* value = payload + sizeof(UniformRecord);
+
+		auto read = [value]<typename T>(T& out) {
+			std::memcpy(&out, value, sizeof(T));
+			return out;
+		};
+
+		ShaderProgram& shader = *record.Shader;
+		ShaderProgram::Uniform uniform = shader.GetUniform(record.ID);
+		switch (record.Type) {
+		case UniformType::Int: { int v; shader.SetUniform1i(uniform, read(v)); break; }
+		case UniformType::UInt: { unsigned int v; shader.SetUniform1ui(uniform, read(v)); break; }
+		case UniformType::Float: { float v; shader.SetUniform1f(uniform, read(v)); break; }
+		case UniformType::Vec2: { glm::vec2 v; shader.SetUniform2fv(uniform, read(v)); break; }
+		case UniformType::Vec3: { glm::vec3 v; shader.SetUniform3fv(uniform, read(v)); break; }
+		case UniformType::Vec4: { glm::vec4 v; shader.SetUniform4fv(uniform, read(v)); break; }
+		case UniformType::Mat3: { glm::mat3 v; shader.SetUniformMatrix3fv(uniform, read(v)); break; }
+		case UniformType::Mat4: { glm::mat4 v; shader.SetUniformMatrix4fv(uniform, read(v)); break; }
+		}
+	}
+
+} // OORenderer
@@ -0,0 +1,56 @@
+#include "OORenderer/FrameUniforms.h"
+
+#include <cstring>
+#include <LoggingAD/LoggingAD.h>
+
+#include "OORenderer/GLStateCache.h"
+
+namespace OORenderer {
+
+	FrameUniforms::FrameUniforms(const Window& window)
+		: m_Buffer(window, sm_Offsets.Size)
+	{
+		Bind();
+	}
+
+	void FrameUniforms::Update(const Camera& camera, float time) {
+		WriteStaging(camera, time);
+
+		// One upload for the lot
+		m_Buffer.SetData(0, m_Staging.size(), m_Staging.data());
+	}
+
+	void FrameUniforms::Update(const Camera& camera, float time, RingBuffer& ring) {
+		RingBuffer::Allocation allocation = ring.Allocate(m_Staging.size(), ring.GetUniformAlignment());
+		if (!allocation.IsValid()) {
+			LoggingAD::Warning("[OORenderer::FrameUniforms::Update] Ring buffer {} is full this frame, updating our own buffer instead.", ring.GetBufferID());
+			Update(camera, time);
+			Bind();
+			return;
+		}
+
+		WriteStaging(camera, time);
+		std::memcpy(allocation.Data, m_Staging.data(), m_Staging.size());
+		ring.Commit();
+
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		Window::ActivateGLFWWindow(ring.GetGLFWWindow());
+
+		GLStateCache::Current().BindBufferRange(GL_UNIFORM_BUFFER, BlockBinding, allocation.BufferID, allocation.Offset, allocation.Size);
+
+		Window::ActivateGLFWWindow(oldContext);
+	}
+
+	void FrameUniforms::WriteStaging(const Camera& camera, float time) {
+		Std140::Write(m_Staging.data(), sm_Offsets.PVMatrix, camera.GetPVMatrix());
+		Std140::Write(m_Staging.data(), sm_Offsets.ViewMatrix, camera.GetViewMatrix());
+		Std140::Write(m_Staging.data(), sm_Offsets.ProjectionMatrix, camera.GetProjectionMatrix());
+		Std140::Write(m_Staging.data(), sm_Offsets.CameraPosition, glm::vec4(camera.GetPosition(), 1.0f));
+		Std140::Write(m_Staging.data(), sm_Offsets.Time, time);
+	}
+
+	void FrameUniforms::Bind() {
+		m_Buffer.BindToPoint(BlockBinding);
+	}
+
+} // OORenderer
@@ -0,0 +1,139 @@
+#include "OORenderer/Frustum.h"
+
+#include <bit>
+
+#if defined(OORENDERER_ENABLE_AVX) && defined(__AVX__)
+	#define OORENDERER_FRUSTUM_AVX
+	#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define OORENDERER_FRUSTUM_SSE
+	#include <emmintrin.h>
+#endif
+
+namespace OORenderer {
+
+	Frustum::Frustum(const glm::mat4& pvMatrix) {
+		// Gribb and Hartmann, each plane is the last row of the matrix plus or minus another
+		glm::mat4 rows = glm::transpose(pvMatrix);
+		m_Planes = {
+			rows[3] + rows[0],
+			rows[3] - rows[0],
+			rows[3] + rows[1],
+			rows[3] - rows[1],
+			rows[3] + rows[2],
+			rows[3] - rows[2]
+		};
+
+		for (glm::vec4& plane : m_Planes) {
+			plane /= glm::length(glm::vec3{ plane });
+		}
+	}
+
+	bool Frustum::Intersects(const BoundingSphere& sphere) const {
+		for (const glm::vec4& plane : m_Planes) {
+			if (glm::dot(glm::vec3{ plane }, sphere.Center) + plane.w < -sphere.Radius) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool Frustum::Intersects(const AABB& box) const {
+		glm::vec3 center = box.GetCenter();
+		glm::vec3 extents = box.GetExtents();
+		for (const glm::vec4& plane : m_Planes) {
+			// Distance of the corner furthest along the plane normal
+			glm::vec3 normal{ plane };
+			if (glm::dot(normal, center) + glm::dot(glm::abs(normal), extents) + plane.w < 0.0f) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void Frustum::Cull(std::span<const BoundingSphere> spheres, std::vector<std::uint32_t>& visibleIndices) const {
+		const float* data = reinterpret_cast<const float*>(spheres.data());
+		std::size_t i = 0;
+
+		auto appendVisible = [&visibleIndices](std::size_t first, unsigned int mask) {
+			while (mask) {
+				visibleIndices.push_back(static_cast<std::uint32_t>(first + std::countr_zero(mask)));
+				mask &= mask - 1;
+			}
+		};
+
+#if defined(OORENDERER_FRUSTUM_AVX)
+		__m256 planeX[6], planeY[6], planeZ[6], planeW[6];
+		for (std::size_t p = 0; p < m_Planes.size(); ++p) {
+			planeX[p] = _mm256_set1_ps(m_Planes[p].x);
+			planeY[p] = _mm256_set1_ps(m_Planes[p].y);
+			planeZ[p] = _mm256_set1_ps(m_Planes[p].z);
+			planeW[p] = _mm256_set1_ps(m_Planes[p].w);
+		}
+
+		for (; i + 8 <= spheres.size(); i += 8) {
+			// Eight spheres to structure of arrays, each 128 bit lane transposes four
+			__m256 v0 = _mm256_loadu2_m128(data + (i + 4) * 4, data + i * 4);
+			__m256 v1 = _mm256_loadu2_m128(data + (i + 5) * 4, data + (i + 1) * 4);
+			__m256 v2 = _mm256_loadu2_m128(data + (i + 6) * 4, data + (i + 2) * 4);
+			__m256 v3 = _mm256_loadu2_m128(data + (i + 7) * 4, data + (i + 3) * 4);
+			__m256 t0 = _mm256_unpacklo_ps(v0, v1);
+			__m256 t1 = _mm256_unpacklo_ps(v2, v3);
+			__m256 t2 = _mm256_unpackhi_ps(v0, v1);
+			__m256 t3 = _mm256_unpackhi_ps(v2, v3);
+			__m256 x = _mm256_shuffle_ps(t0, t1, 0x44);
+			__m256 y = _mm256_shuffle_ps(t0, t1, 0xEE);
+			__m256 z = _mm256_shuffle_ps(t2, t3, 0x44);
+			__m256 negativeRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_shuffle_ps(t2, t3, 0xEE));
+
+			__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+			for (std::size_t p = 0; p < m_Planes.size(); ++p) {
+				__m256 distance = _mm256_add_ps(
+					_mm256_add_ps(_mm256_mul_ps(planeX[p], x), _mm256_mul_ps(planeY[p], y)),
+					_mm256_add_ps(_mm256_mul_ps(planeZ[p], z), planeW[p]));
+				inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negativeRadius, _CMP_GE_OQ));
+			}
+			appendVisible(i, static_cast<unsigned int>(_mm256_movemask_ps(inside)));
+		}
+#elif defined(OORENDERER_FRUSTUM_SSE)
+		__m128 planeX[6], planeY[6], planeZ[6], planeW[6];
+		for (std::size_t p = 0; p < m_Planes.size(); ++p) {
+			planeX[p] = _mm_set1_ps(m_Planes[p].x);
+			planeY[p] = _mm_set1_ps(m_Planes[p].y);
+			planeZ[p] = _mm_set1_ps(m_Planes[p].z);
+			planeW[p] = _mm_set1_ps(m_Planes[p].w);
+		}
+
+		for (; i + 4 <= spheres.size(); i += 4) {
+			// Four spheres to structure of arrays, x, y, z and radius
+			__m128 x = _mm_loadu_ps(data + i * 4);
+			__m128 y = _mm_loadu_ps(data + (i + 1) * 4);
+			__m128 z = _mm_loadu_ps(data + (i + 2) * 4);
+			__m128 radius = _mm_loadu_ps(data + (i + 3) * 4);
+			_MM_TRANSPOSE4_PS(x, y, z, radius);
+			__m128 negativeRadius = _mm_sub_ps(_mm_setzero_ps(), radius);
+
+			__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (std::size_t p = 0; p < m_Planes.size(); ++p) {
+				__m128 distance = _mm_add_ps(
+					_mm_add_ps(_mm_mul_ps(planeX[p], x), _mm_mul_ps(planeY[p], y)),
+					_mm_add_ps(_mm_mul_ps(planeZ[p], z), planeW[p]));
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negativeRadius));
+			}
+			appendVisible(i, static_cast<unsigned int>(_mm_movemask_ps(inside)));
+		}
+#endif
+
+		// Whatever doesn't fill a batch, or everything without SIMD
+		for (; i < spheres.size(); ++i) {
+			if (Intersects(spheres[i])) {
+				visibleIndices.push_back(static_cast<std::uint32_t>(i));
+			}
+		}
+	}
+
+	const std::array<glm::vec4, 6>& Frustum::GetPlanes() const {
+		return m_Planes;
+	}
+
+} // OORenderer
@@ -0,0 +1,1082 @@
+#pragma once
+
+// Every OpenGL entry point and version flag GLAD exposes, as X-macro lists.
+// Generated from vendor/GLAD/include/glad/glad.h - regenerate if GLAD is regenerated.
+
+#define OORENDERER_GLAD_VERSION_FLAGS(X) \
+	X(GLAD_GL_VERSION_1_0) \
+	X(GLAD_GL_VERSION_1_1) \
+	X(GLAD_GL_VERSION_1_2) \
+	X(GLAD_GL_VERSION_1_3) \
+	X(GLAD_GL_VERSION_1_4) \
+	X(GLAD_GL_VERSION_1_5) \
+	X(GLAD_GL_VERSION_2_0) \
+	X(GLAD_GL_VERSION_2_1) \
+	X(GLAD_GL_VERSION_3_0) \
+	X(GLAD_GL_VERSION_3_1) \
+	X(GLAD_GL_VERSION_3_2) \
+	X(GLAD_GL_VERSION_3_3) \
+	X(GLAD_GL_VERSION_4_0) \
+	X(GLAD_GL_VERSION_4_1) \
+	X(GLAD_GL_VERSION_4_2) \
+	X(GLAD_GL_VERSION_4_3) \
+	X(GLAD_GL_VERSION_4_4) \
+	X(GLAD_GL_VERSION_4_5) \
+	X(GLAD_GL_VERSION_4_6) \
+	X(GLAD_GL_ES_VERSION_2_0) \
+	X(GLAD_GL_ES_VERSION_3_0) \
+	X(GLAD_GL_ES_VERSION_3_1) \
+	X(GLAD_GL_ES_VERSION_3_2)
+
+#define OORENDERER_GLAD_FUNCTIONS(X) \
+	X(PFNGLCULLFACEPROC, glCullFace) \
+	X(PFNGLFRONTFACEPROC, glFrontFace) \
+	X(PFNGLHINTPROC, glHint) \
+	X(PFNGLLINEWIDTHPROC, glLineWidth) \
+	X(PFNGLPOINTSIZEPROC, glPointSize) \
+	X(PFNGLPOLYGONMODEPROC, glPolygonMode) \
+	X(PFNGLSCISSORPROC, glScissor) \
+	X(PFNGLTEXPARAMETERFPROC, glTexParameterf) \
+	X(PFNGLTEXPARAMETERFVPROC, glTexParameterfv) \
+	X(PFNGLTEXPARAMETERIPROC, glTexParameteri) \
+	X(PFNGLTEXPARAMETERIVPROC, glTexParameteriv) \
+	X(PFNGLTEXIMAGE1DPROC, glTexImage1D) \
+	X(PFNGLTEXIMAGE2DPROC, glTexImage2D) \
+	X(PFNGLDRAWBUFFERPROC, glDrawBuffer) \
+	X(PFNGLCLEARPROC, glClear) \
+	X(PFNGLCLEARCOLORPROC, glClearColor) \
+	X(PFNGLCLEARSTENCILPROC, glClearStencil) \
+	X(PFNGLCLEARDEPTHPROC, glClearDepth) \
+	X(PFNGLSTENCILMASKPROC, glStencilMask) \
+	X(PFNGLCOLORMASKPROC, glColorMask) \
+	X(PFNGLDEPTHMASKPROC, glDepthMask) \
+	X(PFNGLDISABLEPROC, glDisable) \
+	X(PFNGLENABLEPROC, glEnable) \
+	X(PFNGLFINISHPROC, glFinish) \
+	X(PFNGLFLUSHPROC, glFlush) \
+	X(PFNGLBLENDFUNCPROC, glBlendFunc) \
+	X(PFNGLLOGICOPPROC, glLogicOp) \
+	X(PFNGLSTENCILFUNCPROC, glStencilFunc) \
+	X(PFNGLSTENCILOPPROC, glStencilOp) \
+	X(PFNGLDEPTHFUNCPROC, glDepthFunc) \
+	X(PFNGLPIXELSTOREFPROC, glPixelStoref) \
+	X(PFNGLPIXELSTOREIPROC, glPixelStorei) \
+	X(PFNGLREADBUFFERPROC, glReadBuffer) \
+	X(PFNGLREADPIXELSPROC, glReadPixels) \
+	X(PFNGLGETBOOLEANVPROC, glGetBooleanv) \
+	X(PFNGLGETDOUBLEVPROC, glGetDoublev) \
+	X(PFNGLGETERRORPROC, glGetError) \
+	X(PFNGLGETFLOATVPROC, glGetFloatv) \
+	X(PFNGLGETINTEGERVPROC, glGetIntegerv) \
+	X(PFNGLGETSTRINGPROC, glGetString) \
+	X(PFNGLGETTEXIMAGEPROC, glGetTexImage) \
+	X(PFNGLGETTEXPARAMETERFVPROC, glGetTexParameterfv) \
+	X(PFNGLGETTEXPARAMETERIVPROC, glGetTexParameteriv) \
+	X(PFNGLGETTEXLEVELPARAMETERFVPROC, glGetTexLevelParameterfv) \
+	X(PFNGLGETTEXLEVELPARAMETERIVPROC, glGetTexLevelParameteriv) \
+	X(PFNGLISENABLEDPROC, glIsEnabled) \
+	X(PFNGLDEPTHRANGEPROC, glDepthRange) \
+	X(PFNGLVIEWPORTPROC, glViewport) \
+	X(PFNGLNEWLISTPROC, glNewList) \
+	X(PFNGLENDLISTPROC, glEndList) \
+	X(PFNGLCALLLISTPROC, glCallList) \
+	X(PFNGLCALLLISTSPROC, glCallLists) \
+	X(PFNGLDELETELISTSPROC, glDeleteLists) \
+	X(PFNGLGENLISTSPROC, glGenLists) \
+	X(PFNGLLISTBASEPROC, glListBase) \
+	X(PFNGLBEGINPROC, glBegin) \
+	X(PFNGLBITMAPPROC, glBitmap) \
+	X(PFNGLCOLOR3BPROC, glColor3b) \
+	X(PFNGLCOLOR3BVPROC, glColor3bv) \
+	X(PFNGLCOLOR3DPROC, glColor3d) \
+	X(PFNGLCOLOR3DVPROC, glColor3dv) \
+	X(PFNGLCOLOR3FPROC, glColor3f) \
+	X(PFNGLCOLOR3FVPROC, glColor3fv) \
+	X(PFNGLCOLOR3IPROC, glColor3i) \
+	X(PFNGLCOLOR3IVPROC, glColor3iv) \
+	X(PFNGLCOLOR3SPROC, glColor3s) \
+	X(PFNGLCOLOR3SVPROC, glColor3sv) \
+	X(PFNGLCOLOR3UBPROC, glColor3ub) \
+	X(PFNGLCOLOR3UBVPROC, glColor3ubv) \
+	X(PFNGLCOLOR3UIPROC, glColor3ui) \
+	X(PFNGLCOLOR3UIVPROC, glColor3uiv) \
+	X(PFNGLCOLOR3USPROC, glColor3us) \
+	X(PFNGLCOLOR3USVPROC, glColor3usv) \
+	X(PFNGLCOLOR4BPROC, glColor4b) \
+	X(PFNGLCOLOR4BVPROC, glColor4bv) \
+	X(PFNGLCOLOR4DPROC, glColor4d) \
+	X(PFNGLCOLOR4DVPROC, glColor4dv) \
+	X(PFNGLCOLOR4FPROC, glColor4f) \
+	X(PFNGLCOLOR4FVPROC, glColor4fv) \
+	X(PFNGLCOLOR4IPROC, glColor4i) \
+	X(PFNGLCOLOR4IVPROC, glColor4iv) \
+	X(PFNGLCOLOR4SPROC, glColor4s) \
+	X(PFNGLCOLOR4SVPROC, glColor4sv) \
+	X(PFNGLCOLOR4UBPROC, glColor4ub) \
+	X(PFNGLCOLOR4UBVPROC, glColor4ubv) \
+	X(PFNGLCOLOR4UIPROC, glColor4ui) \
+	X(PFNGLCOLOR4UIVPROC, glColor4uiv) \
+	X(PFNGLCOLOR4USPROC, glColor4us) \
+	X(PFNGLCOLOR4USVPROC, glColor4usv) \
+	X(PFNGLEDGEFLAGPROC, glEdgeFlag) \
+	X(PFNGLEDGEFLAGVPROC, glEdgeFlagv) \
+	X(PFNGLENDPROC, glEnd) \
+	X(PFNGLINDEXDPROC, glIndexd) \
+	X(PFNGLINDEXDVPROC, glIndexdv) \
+	X(PFNGLINDEXFPROC, glIndexf) \
+	X(PFNGLINDEXFVPROC, glIndexfv) \
+	X(PFNGLINDEXIPROC, glIndexi) \
+	X(PFNGLINDEXIVPROC, glIndexiv) \
+	X(PFNGLINDEXSPROC, glIndexs) \
+	X(PFNGLINDEXSVPROC, glIndexsv) \
+	X(PFNGLNORMAL3BPROC, glNormal3b) \
+	X(PFNGLNORMAL3BVPROC, glNormal3bv) \
+	X(PFNGLNORMAL3DPROC, glNormal3d) \
+	X(PFNGLNORMAL3DVPROC, glNormal3dv) \
+	X(PFNGLNORMAL3FPROC, glNormal3f) \
+	X(PFNGLNORMAL3FVPROC, glNormal3fv) \
+	X(PFNGLNORMAL3IPROC, glNormal3i) \
+	X(PFNGLNORMAL3IVPROC, glNormal3iv) \
+	X(PFNGLNORMAL3SPROC, glNormal3s) \
+	X(PFNGLNORMAL3SVPROC, glNormal3sv) \
+	X(PFNGLRASTERPOS2DPROC, glRasterPos2d) \
+	X(PFNGLRASTERPOS2DVPROC, glRasterPos2dv) \
+	X(PFNGLRASTERPOS2FPROC, glRasterPos2f) \
+	X(PFNGLRASTERPOS2FVPROC, glRasterPos2fv) \
+	X(PFNGLRASTERPOS2IPROC, glRasterPos2i) \
+	X(PFNGLRASTERPOS2IVPROC, glRasterPos2iv) \
+	X(PFNGLRASTERPOS2SPROC, glRasterPos2s) \
+	X(PFNGLRASTERPOS2SVPROC, glRasterPos2sv) \
+	X(PFNGLRASTERPOS3DPROC, glRasterPos3d) \
+	X(PFNGLRASTERPOS3DVPROC, glRasterPos3dv) \
+	X(PFNGLRASTERPOS3FPROC, glRasterPos3f) \
+	X(PFNGLRASTERPOS3FVPROC, glRasterPos3fv) \
+	X(PFNGLRASTERPOS3IPROC, glRasterPos3i) \
+	X(PFNGLRASTERPOS3IVPROC, glRasterPos3iv) \
+	X(PFNGLRASTERPOS3SPROC, glRasterPos3s) \
+	X(PFNGLRASTERPOS3SVPROC, glRasterPos3sv) \
+	X(PFNGLRASTERPOS4DPROC, glRasterPos4d) \
+	X(PFNGLRASTERPOS4DVPROC, glRasterPos4dv) \
+	X(PFNGLRASTERPOS4FPROC, glRasterPos4f) \
+	X(PFNGLRASTERPOS4FVPROC, glRasterPos4fv) \
+	X(PFNGLRASTERPOS4IPROC, glRasterPos4i) \
+	X(PFNGLRASTERPOS4IVPROC, glRasterPos4iv) \
+	X(PFNGLRASTERPOS4SPROC, glRasterPos4s) \
+	X(PFNGLRASTERPOS4SVPROC, glRasterPos4sv) \
+	X(PFNGLRECTDPROC, glRectd) \
+	X(PFNGLRECTDVPROC, glRectdv) \
+	X(PFNGLRECTFPROC, glRectf) \
+	X(PFNGLRECTFVPROC, glRectfv) \
+	X(PFNGLRECTIPROC, glRecti) \
+	X(PFNGLRECTIVPROC, glRectiv) \
+	X(PFNGLRECTSPROC, glRects) \
+	X(PFNGLRECTSVPROC, glRectsv) \
+	X(PFNGLTEXCOORD1DPROC, glTexCoord1d) \
+	X(PFNGLTEXCOORD1DVPROC, glTexCoord1dv) \
+	X(PFNGLTEXCOORD1FPROC, glTexCoord1f) \
+	X(PFNGLTEXCOORD1FVPROC, glTexCoord1fv) \
+	X(PFNGLTEXCOORD1IPROC, glTexCoord1i) \
+	X(PFNGLTEXCOORD1IVPROC, glTexCoord1iv) \
+	X(PFNGLTEXCOORD1SPROC, glTexCoord1s) \
+	X(PFNGLTEXCOORD1SVPROC, glTexCoord1sv) \
+	X(PFNGLTEXCOORD2DPROC, glTexCoord2d) \
+	X(PFNGLTEXCOORD2DVPROC, glTexCoord2dv) \
+	X(PFNGLTEXCOORD2FPROC, glTexCoord2f) \
+	X(PFNGLTEXCOORD2FVPROC, glTexCoord2fv) \
+	X(PFNGLTEXCOORD2IPROC, glTexCoord2i) \
+	X(PFNGLTEXCOORD2IVPROC, glTexCoord2iv) \
+	X(PFNGLTEXCOORD2SPROC, glTexCoord2s) \
+	X(PFNGLTEXCOORD2SVPROC, glTexCoord2sv) \
+	X(PFNGLTEXCOORD3DPROC, glTexCoord3d) \
+	X(PFNGLTEXCOORD3DVPROC, glTexCoord3dv) \
+	X(PFNGLTEXCOORD3FPROC, glTexCoord3f) \
+	X(PFNGLTEXCOORD3FVPROC, glTexCoord3fv) \
+	X(PFNGLTEXCOORD3IPROC, glTexCoord3i) \
+	X(PFNGLTEXCOORD3IVPROC, glTexCoord3iv) \
+	X(PFNGLTEXCOORD3SPROC, glTexCoord3s) \
+	X(PFNGLTEXCOORD3SVPROC, glTexCoord3sv) \
+	X(PFNGLTEXCOORD4DPROC, glTexCoord4d) \
+	X(PFNGLTEXCOORD4DVPROC, glTexCoord4dv) \
+	X(PFNGLTEXCOORD4FPROC, glTexCoord4f) \
+	X(PFNGLTEXCOORD4FVPROC, glTexCoord4fv) \
+	X(PFNGLTEXCOORD4IPROC, glTexCoord4i) \
+	X(PFNGLTEXCOORD4IVPROC, glTexCoord4iv) \
+	X(PFNGLTEXCOORD4SPROC, glTexCoord4s) \
+	X(PFNGLTEXCOORD4SVPROC, glTexCoord4sv) \
+	X(PFNGLVERTEX2DPROC, glVertex2d) \
+	X(PFNGLVERTEX2DVPROC, glVertex2dv) \
+	X(PFNGLVERTEX2FPROC, glVertex2f) \
+	X(PFNGLVERTEX2FVPROC, glVertex2fv) \
+	X(PFNGLVERTEX2IPROC, glVertex2i) \
+	X(PFNGLVERTEX2IVPROC, glVertex2iv) \
+	X(PFNGLVERTEX2SPROC, glVertex2s) \
+	X(PFNGLVERTEX2SVPROC, glVertex2sv) \
+	X(PFNGLVERTEX3DPROC, glVertex3d) \
+	X(PFNGLVERTEX3DVPROC, glVertex3dv) \
+	X(PFNGLVERTEX3FPROC, glVertex3f) \
+	X(PFNGLVERTEX3FVPROC, glVertex3fv) \
+	X(PFNGLVERTEX3IPROC, glVertex3i) \
+	X(PFNGLVERTEX3IVPROC, glVertex3iv) \
+	X(PFNGLVERTEX3SPROC, glVertex3s) \
+	X(PFNGLVERTEX3SVPROC, glVertex3sv) \
+	X(PFNGLVERTEX4DPROC, glVertex4d) \
+	X(PFNGLVERTEX4DVPROC, glVertex4dv) \
+	X(PFNGLVERTEX4FPROC, glVertex4f) \
+	X(PFNGLVERTEX4FVPROC, glVertex4fv) \
+	X(PFNGLVERTEX4IPROC, glVertex4i) \
+	X(PFNGLVERTEX4IVPROC, glVertex4iv) \
+	X(PFNGLVERTEX4SPROC, glVertex4s) \
+	X(PFNGLVERTEX4SVPROC, glVertex4sv) \
+	X(PFNGLCLIPPLANEPROC, glClipPlane) \
+	X(PFNGLCOLORMATERIALPROC, glColorMaterial) \
+	X(PFNGLFOGFPROC, glFogf) \
+	X(PFNGLFOGFVPROC, glFogfv) \
+	X(PFNGLFOGIPROC, glFogi) \
+	X(PFNGLFOGIVPROC, glFogiv) \
+	X(PFNGLLIGHTFPROC, glLightf) \
+	X(PFNGLLIGHTFVPROC, glLightfv) \
+	X(PFNGLLIGHTIPROC, glLighti) \
+	X(PFNGLLIGHTIVPROC, glLightiv) \
+	X(PFNGLLIGHTMODELFPROC, glLightModelf) \
+	X(PFNGLLIGHTMODELFVPROC, glLightModelfv) \
+	X(PFNGLLIGHTMODELIPROC, glLightModeli) \
+	X(PFNGLLIGHTMODELIVPROC, glLightModeliv) \
+	X(PFNGLLINESTIPPLEPROC, glLineStipple) \
+	X(PFNGLMATERIALFPROC, glMaterialf) \
+	X(PFNGLMATERIALFVPROC, glMaterialfv) \
+	X(PFNGLMATERIALIPROC, glMateriali) \
+	X(PFNGLMATERIALIVPROC, glMaterialiv) \
+	X(PFNGLPOLYGONSTIPPLEPROC, glPolygonStipple) \
+	X(PFNGLSHADEMODELPROC, glShadeModel) \
+	X(PFNGLTEXENVFPROC, glTexEnvf) \
+	X(PFNGLTEXENVFVPROC, glTexEnvfv) \
+	X(PFNGLTEXENVIPROC, glTexEnvi) \
+	X(PFNGLTEXENVIVPROC, glTexEnviv) \
+	X(PFNGLTEXGENDPROC, glTexGend) \
+	X(PFNGLTEXGENDVPROC, glTexGendv) \
+	X(PFNGLTEXGENFPROC, glTexGenf) \
+	X(PFNGLTEXGENFVPROC, glTexGenfv) \
+	X(PFNGLTEXGENIPROC, glTexGeni) \
+	X(PFNGLTEXGENIVPROC, glTexGeniv) \
+	X(PFNGLFEEDBACKBUFFERPROC, glFeedbackBuffer) \
+	X(PFNGLSELECTBUFFERPROC, glSelectBuffer) \
+	X(PFNGLRENDERMODEPROC, glRenderMode) \
+	X(PFNGLINITNAMESPROC, glInitNames) \
+	X(PFNGLLOADNAMEPROC, glLoadName) \
+	X(PFNGLPASSTHROUGHPROC, glPassThrough) \
+	X(PFNGLPOPNAMEPROC, glPopName) \
+	X(PFNGLPUSHNAMEPROC, glPushName) \
+	X(PFNGLCLEARACCUMPROC, glClearAccum) \
+	X(PFNGLCLEARINDEXPROC, glClearIndex) \
+	X(PFNGLINDEXMASKPROC, glIndexMask) \
+	X(PFNGLACCUMPROC, glAccum) \
+	X(PFNGLPOPATTRIBPROC, glPopAttrib) \
+	X(PFNGLPUSHATTRIBPROC, glPushAttrib) \
+	X(PFNGLMAP1DPROC, glMap1d) \
+	X(PFNGLMAP1FPROC, glMap1f) \
+	X(PFNGLMAP2DPROC, glMap2d) \
+	X(PFNGLMAP2FPROC, glMap2f) \
+	X(PFNGLMAPGRID1DPROC, glMapGrid1d) \
+	X(PFNGLMAPGRID1FPROC, glMapGrid1f) \
+	X(PFNGLMAPGRID2DPROC, glMapGrid2d) \
+	X(PFNGLMAPGRID2FPROC, glMapGrid2f) \
+	X(PFNGLEVALCOORD1DPROC, glEvalCoord1d) \
+	X(PFNGLEVALCOORD1DVPROC, glEvalCoord1dv) \
+	X(PFNGLEVALCOORD1FPROC, glEvalCoord1f) \
+	X(PFNGLEVALCOORD1FVPROC, glEvalCoord1fv) \
+	X(PFNGLEVALCOORD2DPROC, glEvalCoord2d) \
+	X(PFNGLEVALCOORD2DVPROC, glEvalCoord2dv) \
+	X(PFNGLEVALCOORD2FPROC, glEvalCoord2f) \
+	X(PFNGLEVALCOORD2FVPROC, glEvalCoord2fv) \
+	X(PFNGLEVALMESH1PROC, glEvalMesh1) \
+	X(PFNGLEVALPOINT1PROC, glEvalPoint1) \
+	X(PFNGLEVALMESH2PROC, glEvalMesh2) \
+	X(PFNGLEVALPOINT2PROC, glEvalPoint2) \
+	X(PFNGLALPHAFUNCPROC, glAlphaFunc) \
+	X(PFNGLPIXELZOOMPROC, glPixelZoom) \
+	X(PFNGLPIXELTRANSFERFPROC, glPixelTransferf) \
+	X(PFNGLPIXELTRANSFERIPROC, glPixelTransferi) \
+	X(PFNGLPIXELMAPFVPROC, glPixelMapfv) \
+	X(PFNGLPIXELMAPUIVPROC, glPixelMapuiv) \
+	X(PFNGLPIXELMAPUSVPROC, glPixelMapusv) \
+	X(PFNGLCOPYPIXELSPROC, glCopyPixels) \
+	X(PFNGLDRAWPIXELSPROC, glDrawPixels) \
+	X(PFNGLGETCLIPPLANEPROC, glGetClipPlane) \
+	X(PFNGLGETLIGHTFVPROC, glGetLightfv) \
+	X(PFNGLGETLIGHTIVPROC, glGetLightiv) \
+	X(PFNGLGETMAPDVPROC, glGetMapdv) \
+	X(PFNGLGETMAPFVPROC, glGetMapfv) \
+	X(PFNGLGETMAPIVPROC, glGetMapiv) \
+	X(PFNGLGETMATERIALFVPROC, glGetMaterialfv) \
+	X(PFNGLGETMATERIALIVPROC, glGetMaterialiv) \
+	X(PFNGLGETPIXELMAPFVPROC, glGetPixelMapfv) \
+	X(PFNGLGETPIXELMAPUIVPROC, glGetPixelMapuiv) \
+	X(PFNGLGETPIXELMAPUSVPROC, glGetPixelMapusv) \
+	X(PFNGLGETPOLYGONSTIPPLEPROC, glGetPolygonStipple) \
+	X(PFNGLGETTEXENVFVPROC, glGetTexEnvfv) \
+	X(PFNGLGETTEXENVIVPROC, glGetTexEnviv) \
+	X(PFNGLGETTEXGENDVPROC, glGetTexGendv) \
+	X(PFNGLGETTEXGENFVPROC, glGetTexGenfv) \
+	X(PFNGLGETTEXGENIVPROC, glGetTexGeniv) \
+	X(PFNGLISLISTPROC, glIsList) \
+	X(PFNGLFRUSTUMPROC, glFrustum) \
+	X(PFNGLLOADIDENTITYPROC, glLoadIdentity) \
+	X(PFNGLLOADMATRIXFPROC, glLoadMatrixf) \
+	X(PFNGLLOADMATRIXDPROC, glLoadMatrixd) \
+	X(PFNGLMATRIXMODEPROC, glMatrixMode) \
+	X(PFNGLMULTMATRIXFPROC, glMultMatrixf) \
+	X(PFNGLMULTMATRIXDPROC, glMultMatrixd) \
+	X(PFNGLORTHOPROC, glOrtho) \
+	X(PFNGLPOPMATRIXPROC, glPopMatrix) \
+	X(PFNGLPUSHMATRIXPROC, glPushMatrix) \
+	X(PFNGLROTATEDPROC, glRotated) \
+	X(PFNGLROTATEFPROC, glRotatef) \
+	X(PFNGLSCALEDPROC, glScaled) \
+	X(PFNGLSCALEFPROC, glScalef) \
+	X(PFNGLTRANSLATEDPROC, glTranslated) \
+	X(PFNGLTRANSLATEFPROC, glTranslatef) \
+	X(PFNGLDRAWARRAYSPROC, glDrawArrays) \
+	X(PFNGLDRAWELEMENTSPROC, glDrawElements) \
+	X(PFNGLGETPOINTERVPROC, glGetPointerv) \
+	X(PFNGLPOLYGONOFFSETPROC, glPolygonOffset) \
+	X(PFNGLCOPYTEXIMAGE1DPROC, glCopyTexImage1D) \
+	X(PFNGLCOPYTEXIMAGE2DPROC, glCopyTexImage2D) \
+	X(PFNGLCOPYTEXSUBIMAGE1DPROC, glCopyTexSubImage1D) \
+	X(PFNGLCOPYTEXSUBIMAGE2DPROC, glCopyTexSubImage2D) \
+	X(PFNGLTEXSUBIMAGE1DPROC, glTexSubImage1D) \
+	X(PFNGLTEXSUBIMAGE2DPROC, glTexSubImage2D) \
+	X(PFNGLBINDTEXTUREPROC, glBindTexture) \
+	X(PFNGLDELETETEXTURESPROC, glDeleteTextures) \
+	X(PFNGLGENTEXTURESPROC, glGenTextures) \
+	X(PFNGLISTEXTUREPROC, glIsTexture) \
+	X(PFNGLARRAYELEMENTPROC, glArrayElement) \
+	X(PFNGLCOLORPOINTERPROC, glColorPointer) \
+	X(PFNGLDISABLECLIENTSTATEPROC, glDisableClientState) \
+	X(PFNGLEDGEFLAGPOINTERPROC, glEdgeFlagPointer) \
+	X(PFNGLENABLECLIENTSTATEPROC, glEnableClientState) \
+	X(PFNGLINDEXPOINTERPROC, glIndexPointer) \
+	X(PFNGLINTERLEAVEDARRAYSPROC, glInterleavedArrays) \
+	X(PFNGLNORMALPOINTERPROC, glNormalPointer) \
+	X(PFNGLTEXCOORDPOINTERPROC, glTexCoordPointer) \
+	X(PFNGLVERTEXPOINTERPROC, glVertexPointer) \
+	X(PFNGLARETEXTURESRESIDENTPROC, glAreTexturesResident) \
+	X(PFNGLPRIORITIZETEXTURESPROC, glPrioritizeTextures) \
+	X(PFNGLINDEXUBPROC, glIndexub) \
+	X(PFNGLINDEXUBVPROC, glIndexubv) \
+	X(PFNGLPOPCLIENTATTRIBPROC, glPopClientAttrib) \
+	X(PFNGLPUSHCLIENTATTRIBPROC, glPushClientAttrib) \
+	X(PFNGLDRAWRANGEELEMENTSPROC, glDrawRangeElements) \
+	X(PFNGLTEXIMAGE3DPROC, glTexImage3D) \
+	X(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D) \
+	X(PFNGLCOPYTEXSUBIMAGE3DPROC, glCopyTexSubImage3D) \
+	X(PFNGLACTIVETEXTUREPROC, glActiveTexture) \
+	X(PFNGLSAMPLECOVERAGEPROC, glSampleCoverage) \
+	X(PFNGLCOMPRESSEDTEXIMAGE3DPROC, glCompressedTexImage3D) \
+	X(PFNGLCOMPRESSEDTEXIMAGE2DPROC, glCompressedTexImage2D) \
+	X(PFNGLCOMPRESSEDTEXIMAGE1DPROC, glCompressedTexImage1D) \
+	X(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D) \
+	X(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D) \
+	X(PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, glCompressedTexSubImage1D) \
+	X(PFNGLGETCOMPRESSEDTEXIMAGEPROC, glGetCompressedTexImage) \
+	X(PFNGLCLIENTACTIVETEXTUREPROC, glClientActiveTexture) \
+	X(PFNGLMULTITEXCOORD1DPROC, glMultiTexCoord1d) \
+	X(PFNGLMULTITEXCOORD1DVPROC, glMultiTexCoord1dv) \
+	X(PFNGLMULTITEXCOORD1FPROC, glMultiTexCoord1f) \
+	X(PFNGLMULTITEXCOORD1FVPROC, glMultiTexCoord1fv) \
+	X(PFNGLMULTITEXCOORD1IPROC, glMultiTexCoord1i) \
+	X(PFNGLMULTITEXCOORD1IVPROC, glMultiTexCoord1iv) \
+	X(PFNGLMULTITEXCOORD1SPROC, glMultiTexCoord1s) \
+	X(PFNGLMULTITEXCOORD1SVPROC, glMultiTexCoord1sv) \
+	X(PFNGLMULTITEXCOORD2DPROC, glMultiTexCoord2d) \
+	X(PFNGLMULTITEXCOORD2DVPROC, glMultiTexCoord2dv) \
+	X(PFNGLMULTITEXCOORD2FPROC, glMultiTexCoord2f) \
+	X(PFNGLMULTITEXCOORD2FVPROC, glMultiTexCoord2fv) \
+	X(PFNGLMULTITEXCOORD2IPROC, glMultiTexCoord2i) \
+	X(PFNGLMULTITEXCOORD2IVPROC, glMultiTexCoord2iv) \
+	X(PFNGLMULTITEXCOORD2SPROC, glMultiTexCoord2s) \
+	X(PFNGLMULTITEXCOORD2SVPROC, glMultiTexCoord2sv) \
+	X(PFNGLMULTITEXCOORD3DPROC, glMultiTexCoord3d) \
+	X(PFNGLMULTITEXCOORD3DVPROC, glMultiTexCoord3dv) \
+	X(PFNGLMULTITEXCOORD3FPROC, glMultiTexCoord3f) \
+	X(PFNGLMULTITEXCOORD3FVPROC, glMultiTexCoord3fv) \
+	X(PFNGLMULTITEXCOORD3IPROC, glMultiTexCoord3i) \
+	X(PFNGLMULTITEXCOORD3IVPROC, glMultiTexCoord3iv) \
+	X(PFNGLMULTITEXCOORD3SPROC, glMultiTexCoord3s) \
+	X(PFNGLMULTITEXCOORD3SVPROC, glMultiTexCoord3sv) \
+	X(PFNGLMULTITEXCOORD4DPROC, glMultiTexCoord4d) \
+	X(PFNGLMULTITEXCOORD4DVPROC, glMultiTexCoord4dv) \
+	X(PFNGLMULTITEXCOORD4FPROC, glMultiTexCoord4f) \
+	X(PFNGLMULTITEXCOORD4FVPROC, glMultiTexCoord4fv) \
+	X(PFNGLMULTITEXCOORD4IPROC, glMultiTexCoord4i) \
+	X(PFNGLMULTITEXCOORD4IVPROC, glMultiTexCoord4iv) \
+	X(PFNGLMULTITEXCOORD4SPROC, glMultiTexCoord4s) \
+	X(PFNGLMULTITEXCOORD4SVPROC, glMultiTexCoord4sv) \
+	X(PFNGLLOADTRANSPOSEMATRIXFPROC, glLoadTransposeMatrixf) \
+	X(PFNGLLOADTRANSPOSEMATRIXDPROC, glLoadTransposeMatrixd) \
+	X(PFNGLMULTTRANSPOSEMATRIXFPROC, glMultTransposeMatrixf) \
+	X(PFNGLMULTTRANSPOSEMATRIXDPROC, glMultTransposeMatrixd) \
+	X(PFNGLBLENDFUNCSEPARATEPROC, glBlendFuncSeparate) \
+	X(PFNGLMULTIDRAWARRAYSPROC, glMultiDrawArrays) \
+	X(PFNGLMULTIDRAWELEMENTSPROC, glMultiDrawElements) \
+	X(PFNGLPOINTPARAMETERFPROC, glPointParameterf) \
+	X(PFNGLPOINTPARAMETERFVPROC, glPointParameterfv) \
+	X(PFNGLPOINTPARAMETERIPROC, glPointParameteri) \
+	X(PFNGLPOINTPARAMETERIVPROC, glPointParameteriv) \
+	X(PFNGLFOGCOORDFPROC, glFogCoordf) \
+	X(PFNGLFOGCOORDFVPROC, glFogCoordfv) \
+	X(PFNGLFOGCOORDDPROC, glFogCoordd) \
+	X(PFNGLFOGCOORDDVPROC, glFogCoorddv) \
+	X(PFNGLFOGCOORDPOINTERPROC, glFogCoordPointer) \
+	X(PFNGLSECONDARYCOLOR3BPROC, glSecondaryColor3b) \
+	X(PFNGLSECONDARYCOLOR3BVPROC, glSecondaryColor3bv) \
+	X(PFNGLSECONDARYCOLOR3DPROC, glSecondaryColor3d) \
+	X(PFNGLSECONDARYCOLOR3DVPROC, glSecondaryColor3dv) \
+	X(PFNGLSECONDARYCOLOR3FPROC, glSecondaryColor3f) \
+	X(PFNGLSECONDARYCOLOR3FVPROC, glSecondaryColor3fv) \
+	X(PFNGLSECONDARYCOLOR3IPROC, glSecondaryColor3i) \
+	X(PFNGLSECONDARYCOLOR3IVPROC, glSecondaryColor3iv) \
+	X(PFNGLSECONDARYCOLOR3SPROC, glSecondaryColor3s) \
+	X(PFNGLSECONDARYCOLOR3SVPROC, glSecondaryColor3sv) \
+	X(PFNGLSECONDARYCOLOR3UBPROC, glSecondaryColor3ub) \
+	X(PFNGLSECONDARYCOLOR3UBVPROC, glSecondaryColor3ubv) \
+	X(PFNGLSECONDARYCOLOR3UIPROC, glSecondaryColor3ui) \
+	X(PFNGLSECONDARYCOLOR3UIVPROC, glSecondaryColor3uiv) \
+	X(PFNGLSECONDARYCOLOR3USPROC, glSecondaryColor3us) \
+	X(PFNGLSECONDARYCOLOR3USVPROC, glSecondaryColor3usv) \
+	X(PFNGLSECONDARYCOLORPOINTERPROC, glSecondaryColorPointer) \
+	X(PFNGLWINDOWPOS2DPROC, glWindowPos2d) \
+	X(PFNGLWINDOWPOS2DVPROC, glWindowPos2dv) \
+	X(PFNGLWINDOWPOS2FPROC, glWindowPos2f) \
+	X(PFNGLWINDOWPOS2FVPROC, glWindowPos2fv) \
+	X(PFNGLWINDOWPOS2IPROC, glWindowPos2i) \
+	X(PFNGLWINDOWPOS2IVPROC, glWindowPos2iv) \
+	X(PFNGLWINDOWPOS2SPROC, glWindowPos2s) \
+	X(PFNGLWINDOWPOS2SVPROC, glWindowPos2sv) \
+	X(PFNGLWINDOWPOS3DPROC, glWindowPos3d) \
+	X(PFNGLWINDOWPOS3DVPROC, glWindowPos3dv) \
+	X(PFNGLWINDOWPOS3FPROC, glWindowPos3f) \
+	X(PFNGLWINDOWPOS3FVPROC, glWindowPos3fv) \
+	X(PFNGLWINDOWPOS3IPROC, glWindowPos3i) \
+	X(PFNGLWINDOWPOS3IVPROC, glWindowPos3iv) \
+	X(PFNGLWINDOWPOS3SPROC, glWindowPos3s) \
+	X(PFNGLWINDOWPOS3SVPROC, glWindowPos3sv) \
+	X(PFNGLBLENDCOLORPROC, glBlendColor) \
+	X(PFNGLBLENDEQUATIONPROC, glBlendEquation) \
+	X(PFNGLGENQUERIESPROC, glGenQueries) \
+	X(PFNGLDELETEQUERIESPROC, glDeleteQueries) \
+	X(PFNGLISQUERYPROC, glIsQuery) \
+	X(PFNGLBEGINQUERYPROC, glBeginQuery) \
+	X(PFNGLENDQUERYPROC, glEndQuery) \
+	X(PFNGLGETQUERYIVPROC, glGetQueryiv) \
+	X(PFNGLGETQUERYOBJECTIVPROC, glGetQueryObjectiv) \
+	X(PFNGLGETQUERYOBJECTUIVPROC, glGetQueryObjectuiv) \
+	X(PFNGLBINDBUFFERPROC, glBindBuffer) \
+	X(PFNGLDELETEBUFFERSPROC, glDeleteBuffers) \
+	X(PFNGLGENBUFFERSPROC, glGenBuffers) \
+	X(PFNGLISBUFFERPROC, glIsBuffer) \
+	X(PFNGLBUFFERDATAPROC, glBufferData) \
+	X(PFNGLBUFFERSUBDATAPROC, glBufferSubData) \
+	X(PFNGLGETBUFFERSUBDATAPROC, glGetBufferSubData) \
+	X(PFNGLMAPBUFFERPROC, glMapBuffer) \
+	X(PFNGLUNMAPBUFFERPROC, glUnmapBuffer) \
+	X(PFNGLGETBUFFERPARAMETERIVPROC, glGetBufferParameteriv) \
+	X(PFNGLGETBUFFERPOINTERVPROC, glGetBufferPointerv) \
+	X(PFNGLBLENDEQUATIONSEPARATEPROC, glBlendEquationSeparate) \
+	X(PFNGLDRAWBUFFERSPROC, glDrawBuffers) \
+	X(PFNGLSTENCILOPSEPARATEPROC, glStencilOpSeparate) \
+	X(PFNGLSTENCILFUNCSEPARATEPROC, glStencilFuncSeparate) \
+	X(PFNGLSTENCILMASKSEPARATEPROC, glStencilMaskSeparate) \
+	X(PFNGLATTACHSHADERPROC, glAttachShader) \
+	X(PFNGLBINDATTRIBLOCATIONPROC, glBindAttribLocation) \
+	X(PFNGLCOMPILESHADERPROC, glCompileShader) \
+	X(PFNGLCREATEPROGRAMPROC, glCreateProgram) \
+	X(PFNGLCREATESHADERPROC, glCreateShader) \
+	X(PFNGLDELETEPROGRAMPROC, glDeleteProgram) \
+	X(PFNGLDELETESHADERPROC, glDeleteShader) \
+	X(PFNGLDETACHSHADERPROC, glDetachShader) \
+	X(PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray) \
+	X(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray) \
+	X(PFNGLGETACTIVEATTRIBPROC, glGetActiveAttrib) \
+	X(PFNGLGETACTIVEUNIFORMPROC, glGetActiveUniform) \
+	X(PFNGLGETATTACHEDSHADERSPROC, glGetAttachedShaders) \
+	X(PFNGLGETATTRIBLOCATIONPROC, glGetAttribLocation) \
+	X(PFNGLGETPROGRAMIVPROC, glGetProgramiv) \
+	X(PFNGLGETPROGRAMINFOLOGPROC, glGetProgramInfoLog) \
+	X(PFNGLGETSHADERIVPROC, glGetShaderiv) \
+	X(PFNGLGETSHADERINFOLOGPROC, glGetShaderInfoLog) \
+	X(PFNGLGETSHADERSOURCEPROC, glGetShaderSource) \
+	X(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation) \
+	X(PFNGLGETUNIFORMFVPROC, glGetUniformfv) \
+	X(PFNGLGETUNIFORMIVPROC, glGetUniformiv) \
+	X(PFNGLGETVERTEXATTRIBDVPROC, glGetVertexAttribdv) \
+	X(PFNGLGETVERTEXATTRIBFVPROC, glGetVertexAttribfv) \
+	X(PFNGLGETVERTEXATTRIBIVPROC, glGetVertexAttribiv) \
+	X(PFNGLGETVERTEXATTRIBPOINTERVPROC, glGetVertexAttribPointerv) \
+	X(PFNGLISPROGRAMPROC, glIsProgram) \
+	X(PFNGLISSHADERPROC, glIsShader) \
+	X(PFNGLLINKPROGRAMPROC, glLinkProgram) \
+	X(PFNGLSHADERSOURCEPROC, glShaderSource) \
+	X(PFNGLUSEPROGRAMPROC, glUseProgram) \
+	X(PFNGLUNIFORM1FPROC, glUniform1f) \
+	X(PFNGLUNIFORM2FPROC, glUniform2f) \
+	X(PFNGLUNIFORM3FPROC, glUniform3f) \
+	X(PFNGLUNIFORM4FPROC, glUniform4f) \
+	X(PFNGLUNIFORM1IPROC, glUniform1i) \
+	X(PFNGLUNIFORM2IPROC, glUniform2i) \
+	X(PFNGLUNIFORM3IPROC, glUniform3i) \
+	X(PFNGLUNIFORM4IPROC, glUniform4i) \
+	X(PFNGLUNIFORM1FVPROC, glUniform1fv) \
+	X(PFNGLUNIFORM2FVPROC, glUniform2fv) \
+	X(PFNGLUNIFORM3FVPROC, glUniform3fv) \
+	X(PFNGLUNIFORM4FVPROC, glUniform4fv) \
+	X(PFNGLUNIFORM1IVPROC, glUniform1iv) \
+	X(PFNGLUNIFORM2IVPROC, glUniform2iv) \
+	X(PFNGLUNIFORM3IVPROC, glUniform3iv) \
+	X(PFNGLUNIFORM4IVPROC, glUniform4iv) \
+	X(PFNGLUNIFORMMATRIX2FVPROC, glUniformMatrix2fv) \
+	X(PFNGLUNIFORMMATRIX3FVPROC, glUniformMatrix3fv) \
+	X(PFNGLUNIFORMMATRIX4FVPROC, glUniformMatrix4fv) \
+	X(PFNGLVALIDATEPROGRAMPROC, glValidateProgram) \
+	X(PFNGLVERTEXATTRIB1DPROC, glVertexAttrib1d) \
+	X(PFNGLVERTEXATTRIB1DVPROC, glVertexAttrib1dv) \
+	X(PFNGLVERTEXATTRIB1FPROC, glVertexAttrib1f) \
+	X(PFNGLVERTEXATTRIB1FVPROC, glVertexAttrib1fv) \
+	X(PFNGLVERTEXATTRIB1SPROC, glVertexAttrib1s) \
+	X(PFNGLVERTEXATTRIB1SVPROC, glVertexAttrib1sv) \
+	X(PFNGLVERTEXATTRIB2DPROC, glVertexAttrib2d) \
+	X(PFNGLVERTEXATTRIB2DVPROC, glVertexAttrib2dv) \
+	X(PFNGLVERTEXATTRIB2FPROC, glVertexAttrib2f) \
+	X(PFNGLVERTEXATTRIB2FVPROC, glVertexAttrib2fv) \
+	X(PFNGLVERTEXATTRIB2SPROC, glVertexAttrib2s) \
+	X(PFNGLVERTEXATTRIB2SVPROC, glVertexAttrib2sv) \
+	X(PFNGLVERTEXATTRIB3DPROC, glVertexAttrib3d) \
+	X(PFNGLVERTEXATTRIB3DVPROC, glVertexAttrib3dv) \
+	X(PFNGLVERTEXATTRIB3FPROC, glVertexAttrib3f) \
+	X(PFNGLVERTEXATTRIB3FVPROC, glVertexAttrib3fv) \
+	X(PFNGLVERTEXATTRIB3SPROC, glVertexAttrib3s) \
+	X(PFNGLVERTEXATTRIB3SVPROC, glVertexAttrib3sv) \
+	X(PFNGLVERTEXATTRIB4NBVPROC, glVertexAttrib4Nbv) \
+	X(PFNGLVERTEXATTRIB4NIVPROC, glVertexAttrib4Niv) \
+	X(PFNGLVERTEXATTRIB4NSVPROC, glVertexAttrib4Nsv) \
+	X(PFNGLVERTEXATTRIB4NUBPROC, glVertexAttrib4Nub) \
+	X(PFNGLVERTEXATTRIB4NUBVPROC, glVertexAttrib4Nubv) \
+	X(PFNGLVERTEXATTRIB4NUIVPROC, glVertexAttrib4Nuiv) \
+	X(PFNGLVERTEXATTRIB4NUSVPROC, glVertexAttrib4Nusv) \
+	X(PFNGLVERTEXATTRIB4BVPROC, glVertexAttrib4bv) \
+	X(PFNGLVERTEXATTRIB4DPROC, glVertexAttrib4d) \
+	X(PFNGLVERTEXATTRIB4DVPROC, glVertexAttrib4dv) \
+	X(PFNGLVERTEXATTRIB4FPROC, glVertexAttrib4f) \
+	X(PFNGLVERTEXATTRIB4FVPROC, glVertexAttrib4fv) \
+	X(PFNGLVERTEXATTRIB4IVPROC, glVertexAttrib4iv) \
+	X(PFNGLVERTEXATTRIB4SPROC, glVertexAttrib4s) \
+	X(PFNGLVERTEXATTRIB4SVPROC, glVertexAttrib4sv) \
+	X(PFNGLVERTEXATTRIB4UBVPROC, glVertexAttrib4ubv) \
+	X(PFNGLVERTEXATTRIB4UIVPROC, glVertexAttrib4uiv) \
+	X(PFNGLVERTEXATTRIB4USVPROC, glVertexAttrib4usv) \
+	X(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer) \
+	X(PFNGLUNIFORMMATRIX2X3FVPROC, glUniformMatrix2x3fv) \
+	X(PFNGLUNIFORMMATRIX3X2FVPROC, glUniformMatrix3x2fv) \
+	X(PFNGLUNIFORMMATRIX2X4FVPROC, glUniformMatrix2x4fv) \
+	X(PFNGLUNIFORMMATRIX4X2FVPROC, glUniformMatrix4x2fv) \
+	X(PFNGLUNIFORMMATRIX3X4FVPROC, glUniformMatrix3x4fv) \
+	X(PFNGLUNIFORMMATRIX4X3FVPROC, glUniformMatrix4x3fv) \
+	X(PFNGLCOLORMASKIPROC, glColorMaski) \
+	X(PFNGLGETBOOLEANI_VPROC, glGetBooleani_v) \
+	X(PFNGLGETINTEGERI_VPROC, glGetIntegeri_v) \
+	X(PFNGLENABLEIPROC, glEnablei) \
+	X(PFNGLDISABLEIPROC, glDisablei) \
+	X(PFNGLISENABLEDIPROC, glIsEnabledi) \
+	X(PFNGLBEGINTRANSFORMFEEDBACKPROC, glBeginTransformFeedback) \
+	X(PFNGLENDTRANSFORMFEEDBACKPROC, glEndTransformFeedback) \
+	X(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange) \
+	X(PFNGLBINDBUFFERBASEPROC, glBindBufferBase) \
+	X(PFNGLTRANSFORMFEEDBACKVARYINGSPROC, glTransformFeedbackVaryings) \
+	X(PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, glGetTransformFeedbackVarying) \
+	X(PFNGLCLAMPCOLORPROC, glClampColor) \
+	X(PFNGLBEGINCONDITIONALRENDERPROC, glBeginConditionalRender) \
+	X(PFNGLENDCONDITIONALRENDERPROC, glEndConditionalRender) \
+	X(PFNGLVERTEXATTRIBIPOINTERPROC, glVertexAttribIPointer) \
+	X(PFNGLGETVERTEXATTRIBIIVPROC, glGetVertexAttribIiv) \
+	X(PFNGLGETVERTEXATTRIBIUIVPROC, glGetVertexAttribIuiv) \
+	X(PFNGLVERTEXATTRIBI1IPROC, glVertexAttribI1i) \
+	X(PFNGLVERTEXATTRIBI2IPROC, glVertexAttribI2i) \
+	X(PFNGLVERTEXATTRIBI3IPROC, glVertexAttribI3i) \
+	X(PFNGLVERTEXATTRIBI4IPROC, glVertexAttribI4i) \
+	X(PFNGLVERTEXATTRIBI1UIPROC, glVertexAttribI1ui) \
+	X(PFNGLVERTEXATTRIBI2UIPROC, glVertexAttribI2ui) \
+	X(PFNGLVERTEXATTRIBI3UIPROC, glVertexAttribI3ui) \
+	X(PFNGLVERTEXATTRIBI4UIPROC, glVertexAttribI4ui) \
+	X(PFNGLVERTEXATTRIBI1IVPROC, glVertexAttribI1iv) \
+	X(PFNGLVERTEXATTRIBI2IVPROC, glVertexAttribI2iv) \
+	X(PFNGLVERTEXATTRIBI3IVPROC, glVertexAttribI3iv) \
+	X(PFNGLVERTEXATTRIBI4IVPROC, glVertexAttribI4iv) \
+	X(PFNGLVERTEXATTRIBI1UIVPROC, glVertexAttribI1uiv) \
+	X(PFNGLVERTEXATTRIBI2UIVPROC, glVertexAttribI2uiv) \
+	X(PFNGLVERTEXATTRIBI3UIVPROC, glVertexAttribI3uiv) \
+	X(PFNGLVERTEXATTRIBI4UIVPROC, glVertexAttribI4uiv) \
+	X(PFNGLVERTEXATTRIBI4BVPROC, glVertexAttribI4bv) \
+	X(PFNGLVERTEXATTRIBI4SVPROC, glVertexAttribI4sv) \
+	X(PFNGLVERTEXATTRIBI4UBVPROC, glVertexAttribI4ubv) \
+	X(PFNGLVERTEXATTRIBI4USVPROC, glVertexAttribI4usv) \
+	X(PFNGLGETUNIFORMUIVPROC, glGetUniformuiv) \
+	X(PFNGLBINDFRAGDATALOCATIONPROC, glBindFragDataLocation) \
+	X(PFNGLGETFRAGDATALOCATIONPROC, glGetFragDataLocation) \
+	X(PFNGLUNIFORM1UIPROC, glUniform1ui) \
+	X(PFNGLUNIFORM2UIPROC, glUniform2ui) \
+	X(PFNGLUNIFORM3UIPROC, glUniform3ui) \
+	X(PFNGLUNIFORM4UIPROC, glUniform4ui) \
+	X(PFNGLUNIFORM1UIVPROC, glUniform1uiv) \
+	X(PFNGLUNIFORM2UIVPROC, glUniform2uiv) \
+	X(PFNGLUNIFORM3UIVPROC, glUniform3uiv) \
+	X(PFNGLUNIFORM4UIVPROC, glUniform4uiv) \
+	X(PFNGLTEXPARAMETERIIVPROC, glTexParameterIiv) \
+	X(PFNGLTEXPARAMETERIUIVPROC, glTexParameterIuiv) \
+	X(PFNGLGETTEXPARAMETERIIVPROC, glGetTexParameterIiv) \
+	X(PFNGLGETTEXPARAMETERIUIVPROC, glGetTexParameterIuiv) \
+	X(PFNGLCLEARBUFFERIVPROC, glClearBufferiv) \
+	X(PFNGLCLEARBUFFERUIVPROC, glClearBufferuiv) \
+	X(PFNGLCLEARBUFFERFVPROC, glClearBufferfv) \
+	X(PFNGLCLEARBUFFERFIPROC, glClearBufferfi) \
+	X(PFNGLGETSTRINGIPROC, glGetStringi) \
+	X(PFNGLISRENDERBUFFERPROC, glIsRenderbuffer) \
+	X(PFNGLBINDRENDERBUFFERPROC, glBindRenderbuffer) \
+	X(PFNGLDELETERENDERBUFFERSPROC, glDeleteRenderbuffers) \
+	X(PFNGLGENRENDERBUFFERSPROC, glGenRenderbuffers) \
+	X(PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage) \
+	X(PFNGLGETRENDERBUFFERPARAMETERIVPROC, glGetRenderbufferParameteriv) \
+	X(PFNGLISFRAMEBUFFERPROC, glIsFramebuffer) \
+	X(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer) \
+	X(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers) \
+	X(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers) \
+	X(PFNGLCHECKFRAMEBUFFERSTATUSPROC, glCheckFramebufferStatus) \
+	X(PFNGLFRAMEBUFFERTEXTURE1DPROC, glFramebufferTexture1D) \
+	X(PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D) \
+	X(PFNGLFRAMEBUFFERTEXTURE3DPROC, glFramebufferTexture3D) \
+	X(PFNGLFRAMEBUFFERRENDERBUFFERPROC, glFramebufferRenderbuffer) \
+	X(PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, glGetFramebufferAttachmentParameteriv) \
+	X(PFNGLGENERATEMIPMAPPROC, glGenerateMipmap) \
+	X(PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer) \
+	X(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, glRenderbufferStorageMultisample) \
+	X(PFNGLFRAMEBUFFERTEXTURELAYERPROC, glFramebufferTextureLayer) \
+	X(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange) \
+	X(PFNGLFLUSHMAPPEDBUFFERRANGEPROC, glFlushMappedBufferRange) \
+	X(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray) \
+	X(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays) \
+	X(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays) \
+	X(PFNGLISVERTEXARRAYPROC, glIsVertexArray) \
+	X(PFNGLDRAWARRAYSINSTANCEDPROC, glDrawArraysInstanced) \
+	X(PFNGLDRAWELEMENTSINSTANCEDPROC, glDrawElementsInstanced) \
+	X(PFNGLTEXBUFFERPROC, glTexBuffer) \
+	X(PFNGLPRIMITIVERESTARTINDEXPROC, glPrimitiveRestartIndex) \
+	X(PFNGLCOPYBUFFERSUBDATAPROC, glCopyBufferSubData) \
+	X(PFNGLGETUNIFORMINDICESPROC, glGetUniformIndices) \
+	X(PFNGLGETACTIVEUNIFORMSIVPROC, glGetActiveUniformsiv) \
+	X(PFNGLGETACTIVEUNIFORMNAMEPROC, glGetActiveUniformName) \
+	X(PFNGLGETUNIFORMBLOCKINDEXPROC, glGetUniformBlockIndex) \
+	X(PFNGLGETACTIVEUNIFORMBLOCKIVPROC, glGetActiveUniformBlockiv) \
+	X(PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, glGetActiveUniformBlockName) \
+	X(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding) \
+	X(PFNGLDRAWELEMENTSBASEVERTEXPROC, glDrawElementsBaseVertex) \
+	X(PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, glDrawRangeElementsBaseVertex) \
+	X(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, glDrawElementsInstancedBaseVertex) \
+	X(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, glMultiDrawElementsBaseVertex) \
+	X(PFNGLPROVOKINGVERTEXPROC, glProvokingVertex) \
+	X(PFNGLFENCESYNCPROC, glFenceSync) \
+	X(PFNGLISSYNCPROC, glIsSync) \
+	X(PFNGLDELETESYNCPROC, glDeleteSync) \
+	X(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync) \
+	X(PFNGLWAITSYNCPROC, glWaitSync) \
+	X(PFNGLGETINTEGER64VPROC, glGetInteger64v) \
+	X(PFNGLGETSYNCIVPROC, glGetSynciv) \
+	X(PFNGLGETINTEGER64I_VPROC, glGetInteger64i_v) \
+	X(PFNGLGETBUFFERPARAMETERI64VPROC, glGetBufferParameteri64v) \
+	X(PFNGLFRAMEBUFFERTEXTUREPROC, glFramebufferTexture) \
+	X(PFNGLTEXIMAGE2DMULTISAMPLEPROC, glTexImage2DMultisample) \
+	X(PFNGLTEXIMAGE3DMULTISAMPLEPROC, glTexImage3DMultisample) \
+	X(PFNGLGETMULTISAMPLEFVPROC, glGetMultisamplefv) \
+	X(PFNGLSAMPLEMASKIPROC, glSampleMaski) \
+	X(PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, glBindFragDataLocationIndexed) \
+	X(PFNGLGETFRAGDATAINDEXPROC, glGetFragDataIndex) \
+	X(PFNGLGENSAMPLERSPROC, glGenSamplers) \
+	X(PFNGLDELETESAMPLERSPROC, glDeleteSamplers) \
+	X(PFNGLISSAMPLERPROC, glIsSampler) \
+	X(PFNGLBINDSAMPLERPROC, glBindSampler) \
+	X(PFNGLSAMPLERPARAMETERIPROC, glSamplerParameteri) \
+	X(PFNGLSAMPLERPARAMETERIVPROC, glSamplerParameteriv) \
+	X(PFNGLSAMPLERPARAMETERFPROC, glSamplerParameterf) \
+	X(PFNGLSAMPLERPARAMETERFVPROC, glSamplerParameterfv) \
+	X(PFNGLSAMPLERPARAMETERIIVPROC, glSamplerParameterIiv) \
+	X(PFNGLSAMPLERPARAMETERIUIVPROC, glSamplerParameterIuiv) \
+	X(PFNGLGETSAMPLERPARAMETERIVPROC, glGetSamplerParameteriv) \
+	X(PFNGLGETSAMPLERPARAMETERIIVPROC, glGetSamplerParameterIiv) \
+	X(PFNGLGETSAMPLERPARAMETERFVPROC, glGetSamplerParameterfv) \
+	X(PFNGLGETSAMPLERPARAMETERIUIVPROC, glGetSamplerParameterIuiv) \
+	X(PFNGLQUERYCOUNTERPROC, glQueryCounter) \
+	X(PFNGLGETQUERYOBJECTI64VPROC, glGetQueryObjecti64v) \
+	X(PFNGLGETQUERYOBJECTUI64VPROC, glGetQueryObjectui64v) \
+	X(PFNGLVERTEXATTRIBDIVISORPROC, glVertexAttribDivisor) \
+	X(PFNGLVERTEXATTRIBP1UIPROC, glVertexAttribP1ui) \
+	X(PFNGLVERTEXATTRIBP1UIVPROC, glVertexAttribP1uiv) \
+	X(PFNGLVERTEXATTRIBP2UIPROC, glVertexAttribP2ui) \
+	X(PFNGLVERTEXATTRIBP2UIVPROC, glVertexAttribP2uiv) \
+	X(PFNGLVERTEXATTRIBP3UIPROC, glVertexAttribP3ui) \
+	X(PFNGLVERTEXATTRIBP3UIVPROC, glVertexAttribP3uiv) \
+	X(PFNGLVERTEXATTRIBP4UIPROC, glVertexAttribP4ui) \
+	X(PFNGLVERTEXATTRIBP4UIVPROC, glVertexAttribP4uiv) \
+	X(PFNGLVERTEXP2UIPROC, glVertexP2ui) \
+	X(PFNGLVERTEXP2UIVPROC, glVertexP2uiv) \
+	X(PFNGLVERTEXP3UIPROC, glVertexP3ui) \
+	X(PFNGLVERTEXP3UIVPROC, glVertexP3uiv) \
+	X(PFNGLVERTEXP4UIPROC, glVertexP4ui) \
+	X(PFNGLVERTEXP4UIVPROC, glVertexP4uiv) \
+	X(PFNGLTEXCOORDP1UIPROC, glTexCoordP1ui) \
+	X(PFNGLTEXCOORDP1UIVPROC, glTexCoordP1uiv) \
+	X(PFNGLTEXCOORDP2UIPROC, glTexCoordP2ui) \
+	X(PFNGLTEXCOORDP2UIVPROC, glTexCoordP2uiv) \
+	X(PFNGLTEXCOORDP3UIPROC, glTexCoordP3ui) \
+	X(PFNGLTEXCOORDP3UIVPROC, glTexCoordP3uiv) \
+	X(PFNGLTEXCOORDP4UIPROC, glTexCoordP4ui) \
+	X(PFNGLTEXCOORDP4UIVPROC, glTexCoordP4uiv) \
+	X(PFNGLMULTITEXCOORDP1UIPROC, glMultiTexCoordP1ui) \
+	X(PFNGLMULTITEXCOORDP1UIVPROC, glMultiTexCoordP1uiv) \
+	X(PFNGLMULTITEXCOORDP2UIPROC, glMultiTexCoordP2ui) \
+	X(PFNGLMULTITEXCOORDP2UIVPROC, glMultiTexCoordP2uiv) \
+	X(PFNGLMULTITEXCOORDP3UIPROC, glMultiTexCoordP3ui) \
+	X(PFNGLMULTITEXCOORDP3UIVPROC, glMultiTexCoordP3uiv) \
+	X(PFNGLMULTITEXCOORDP4UIPROC, glMultiTexCoordP4ui) \
+	X(PFNGLMULTITEXCOORDP4UIVPROC, glMultiTexCoordP4uiv) \
+	X(PFNGLNORMALP3UIPROC, glNormalP3ui) \
+	X(PFNGLNORMALP3UIVPROC, glNormalP3uiv) \
+	X(PFNGLCOLORP3UIPROC, glColorP3ui) \
+	X(PFNGLCOLORP3UIVPROC, glColorP3uiv) \
+	X(PFNGLCOLORP4UIPROC, glColorP4ui) \
+	X(PFNGLCOLORP4UIVPROC, glColorP4uiv) \
+	X(PFNGLSECONDARYCOLORP3UIPROC, glSecondaryColorP3ui) \
+	X(PFNGLSECONDARYCOLORP3UIVPROC, glSecondaryColorP3uiv) \
+	X(PFNGLMINSAMPLESHADINGPROC, glMinSampleShading) \
+	X(PFNGLBLENDEQUATIONIPROC, glBlendEquationi) \
+	X(PFNGLBLENDEQUATIONSEPARATEIPROC, glBlendEquationSeparatei) \
+	X(PFNGLBLENDFUNCIPROC, glBlendFunci) \
+	X(PFNGLBLENDFUNCSEPARATEIPROC, glBlendFuncSeparatei) \
+	X(PFNGLDRAWARRAYSINDIRECTPROC, glDrawArraysIndirect) \
+	X(PFNGLDRAWELEMENTSINDIRECTPROC, glDrawElementsIndirect) \
+	X(PFNGLUNIFORM1DPROC, glUniform1d) \
+	X(PFNGLUNIFORM2DPROC, glUniform2d) \
+	X(PFNGLUNIFORM3DPROC, glUniform3d) \
+	X(PFNGLUNIFORM4DPROC, glUniform4d) \
+	X(PFNGLUNIFORM1DVPROC, glUniform1dv) \
+	X(PFNGLUNIFORM2DVPROC, glUniform2dv) \
+	X(PFNGLUNIFORM3DVPROC, glUniform3dv) \
+	X(PFNGLUNIFORM4DVPROC, glUniform4dv) \
+	X(PFNGLUNIFORMMATRIX2DVPROC, glUniformMatrix2dv) \
+	X(PFNGLUNIFORMMATRIX3DVPROC, glUniformMatrix3dv) \
+	X(PFNGLUNIFORMMATRIX4DVPROC, glUniformMatrix4dv) \
+	X(PFNGLUNIFORMMATRIX2X3DVPROC, glUniformMatrix2x3dv) \
+	X(PFNGLUNIFORMMATRIX2X4DVPROC, glUniformMatrix2x4dv) \
+	X(PFNGLUNIFORMMATRIX3X2DVPROC, glUniformMatrix3x2dv) \
+	X(PFNGLUNIFORMMATRIX3X4DVPROC, glUniformMatrix3x4dv) \
+	X(PFNGLUNIFORMMATRIX4X2DVPROC, glUniformMatrix4x2dv) \
+	X(PFNGLUNIFORMMATRIX4X3DVPROC, glUniformMatrix4x3dv) \
+	X(PFNGLGETUNIFORMDVPROC, glGetUniformdv) \
+	X(PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC, glGetSubroutineUniformLocation) \
+	X(PFNGLGETSUBROUTINEINDEXPROC, glGetSubroutineIndex) \
+	X(PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC, glGetActiveSubroutineUniformiv) \
+	X(PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC, glGetActiveSubroutineUniformName) \
+	X(PFNGLGETACTIVESUBROUTINENAMEPROC, glGetActiveSubroutineName) \
+	X(PFNGLUNIFORMSUBROUTINESUIVPROC, glUniformSubroutinesuiv) \
+	X(PFNGLGETUNIFORMSUBROUTINEUIVPROC, glGetUniformSubroutineuiv) \
+	X(PFNGLGETPROGRAMSTAGEIVPROC, glGetProgramStageiv) \
+	X(PFNGLPATCHPARAMETERIPROC, glPatchParameteri) \
+	X(PFNGLPATCHPARAMETERFVPROC, glPatchParameterfv) \
+	X(PFNGLBINDTRANSFORMFEEDBACKPROC, glBindTransformFeedback) \
+	X(PFNGLDELETETRANSFORMFEEDBACKSPROC, glDeleteTransformFeedbacks) \
+	X(PFNGLGENTRANSFORMFEEDBACKSPROC, glGenTransformFeedbacks) \
+	X(PFNGLISTRANSFORMFEEDBACKPROC, glIsTransformFeedback) \
+	X(PFNGLPAUSETRANSFORMFEEDBACKPROC, glPauseTransformFeedback) \
+	X(PFNGLRESUMETRANSFORMFEEDBACKPROC, glResumeTransformFeedback) \
+	X(PFNGLDRAWTRANSFORMFEEDBACKPROC, glDrawTransformFeedback) \
+	X(PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC, glDrawTransformFeedbackStream) \
+	X(PFNGLBEGINQUERYINDEXEDPROC, glBeginQueryIndexed) \
+	X(PFNGLENDQUERYINDEXEDPROC, glEndQueryIndexed) \
+	X(PFNGLGETQUERYINDEXEDIVPROC, glGetQueryIndexediv) \
+	X(PFNGLRELEASESHADERCOMPILERPROC, glReleaseShaderCompiler) \
+	X(PFNGLSHADERBINARYPROC, glShaderBinary) \
+	X(PFNGLGETSHADERPRECISIONFORMATPROC, glGetShaderPrecisionFormat) \
+	X(PFNGLDEPTHRANGEFPROC, glDepthRangef) \
+	X(PFNGLCLEARDEPTHFPROC, glClearDepthf) \
+	X(PFNGLGETPROGRAMBINARYPROC, glGetProgramBinary) \
+	X(PFNGLPROGRAMBINARYPROC, glProgramBinary) \
+	X(PFNGLPROGRAMPARAMETERIPROC, glProgramParameteri) \
+	X(PFNGLUSEPROGRAMSTAGESPROC, glUseProgramStages) \
+	X(PFNGLACTIVESHADERPROGRAMPROC, glActiveShaderProgram) \
+	X(PFNGLCREATESHADERPROGRAMVPROC, glCreateShaderProgramv) \
+	X(PFNGLBINDPROGRAMPIPELINEPROC, glBindProgramPipeline) \
+	X(PFNGLDELETEPROGRAMPIPELINESPROC, glDeleteProgramPipelines) \
+	X(PFNGLGENPROGRAMPIPELINESPROC, glGenProgramPipelines) \
+	X(PFNGLISPROGRAMPIPELINEPROC, glIsProgramPipeline) \
+	X(PFNGLGETPROGRAMPIPELINEIVPROC, glGetProgramPipelineiv) \
+	X(PFNGLPROGRAMUNIFORM1IPROC, glProgramUniform1i) \
+	X(PFNGLPROGRAMUNIFORM1IVPROC, glProgramUniform1iv) \
+	X(PFNGLPROGRAMUNIFORM1FPROC, glProgramUniform1f) \
+	X(PFNGLPROGRAMUNIFORM1FVPROC, glProgramUniform1fv) \
+	X(PFNGLPROGRAMUNIFORM1DPROC, glProgramUniform1d) \
+	X(PFNGLPROGRAMUNIFORM1DVPROC, glProgramUniform1dv) \
+	X(PFNGLPROGRAMUNIFORM1UIPROC, glProgramUniform1ui) \
+	X(PFNGLPROGRAMUNIFORM1UIVPROC, glProgramUniform1uiv) \
+	X(PFNGLPROGRAMUNIFORM2IPROC, glProgramUniform2i) \
+	X(PFNGLPROGRAMUNIFORM2IVPROC, glProgramUniform2iv) \
+	X(PFNGLPROGRAMUNIFORM2FPROC, glProgramUniform2f) \
+	X(PFNGLPROGRAMUNIFORM2FVPROC, glProgramUniform2fv) \
+	X(PFNGLPROGRAMUNIFORM2DPROC, glProgramUniform2d) \
+	X(PFNGLPROGRAMUNIFORM2DVPROC, glProgramUniform2dv) \
+	X(PFNGLPROGRAMUNIFORM2UIPROC, glProgramUniform2ui) \
+	X(PFNGLPROGRAMUNIFORM2UIVPROC, glProgramUniform2uiv) \
+	X(PFNGLPROGRAMUNIFORM3IPROC, glProgramUniform3i) \
+	X(PFNGLPROGRAMUNIFORM3IVPROC, glProgramUniform3iv) \
+	X(PFNGLPROGRAMUNIFORM3FPROC, glProgramUniform3f) \
+	X(PFNGLPROGRAMUNIFORM3FVPROC, glProgramUniform3fv) \
+	X(PFNGLPROGRAMUNIFORM3DPROC, glProgramUniform3d) \
+	X(PFNGLPROGRAMUNIFORM3DVPROC, glProgramUniform3dv) \
+	X(PFNGLPROGRAMUNIFORM3UIPROC, glProgramUniform3ui) \
+	X(PFNGLPROGRAMUNIFORM3UIVPROC, glProgramUniform3uiv) \
+	X(PFNGLPROGRAMUNIFORM4IPROC, glProgramUniform4i) \
+	X(PFNGLPROGRAMUNIFORM4IVPROC, glProgramUniform4iv) \
+	X(PFNGLPROGRAMUNIFORM4FPROC, glProgramUniform4f) \
+	X(PFNGLPROGRAMUNIFORM4FVPROC, glProgramUniform4fv) \
+	X(PFNGLPROGRAMUNIFORM4DPROC, glProgramUniform4d) \
+	X(PFNGLPROGRAMUNIFORM4DVPROC, glProgramUniform4dv) \
+	X(PFNGLPROGRAMUNIFORM4UIPROC, glProgramUniform4ui) \
+	X(PFNGLPROGRAMUNIFORM4UIVPROC, glProgramUniform4uiv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX2FVPROC, glProgramUniformMatrix2fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX3FVPROC, glProgramUniformMatrix3fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX4FVPROC, glProgramUniformMatrix4fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX2DVPROC, glProgramUniformMatrix2dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX3DVPROC, glProgramUniformMatrix3dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX4DVPROC, glProgramUniformMatrix4dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, glProgramUniformMatrix2x3fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, glProgramUniformMatrix3x2fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, glProgramUniformMatrix2x4fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, glProgramUniformMatrix4x2fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, glProgramUniformMatrix3x4fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, glProgramUniformMatrix4x3fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, glProgramUniformMatrix2x3dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, glProgramUniformMatrix3x2dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, glProgramUniformMatrix2x4dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, glProgramUniformMatrix4x2dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, glProgramUniformMatrix3x4dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, glProgramUniformMatrix4x3dv) \
+	X(PFNGLVALIDATEPROGRAMPIPELINEPROC, glValidateProgramPipeline) \
+	X(PFNGLGETPROGRAMPIPELINEINFOLOGPROC, glGetProgramPipelineInfoLog) \
+	X(PFNGLVERTEXATTRIBL1DPROC, glVertexAttribL1d) \
+	X(PFNGLVERTEXATTRIBL2DPROC, glVertexAttribL2d) \
+	X(PFNGLVERTEXATTRIBL3DPROC, glVertexAttribL3d) \
+	X(PFNGLVERTEXATTRIBL4DPROC, glVertexAttribL4d) \
+	X(PFNGLVERTEXATTRIBL1DVPROC, glVertexAttribL1dv) \
+	X(PFNGLVERTEXATTRIBL2DVPROC, glVertexAttribL2dv) \
+	X(PFNGLVERTEXATTRIBL3DVPROC, glVertexAttribL3dv) \
+	X(PFNGLVERTEXATTRIBL4DVPROC, glVertexAttribL4dv) \
+	X(PFNGLVERTEXATTRIBLPOINTERPROC, glVertexAttribLPointer) \
+	X(PFNGLGETVERTEXATTRIBLDVPROC, glGetVertexAttribLdv) \
+	X(PFNGLVIEWPORTARRAYVPROC, glViewportArrayv) \
+	X(PFNGLVIEWPORTINDEXEDFPROC, glViewportIndexedf) \
+	X(PFNGLVIEWPORTINDEXEDFVPROC, glViewportIndexedfv) \
+	X(PFNGLSCISSORARRAYVPROC, glScissorArrayv) \
+	X(PFNGLSCISSORINDEXEDPROC, glScissorIndexed) \
+	X(PFNGLSCISSORINDEXEDVPROC, glScissorIndexedv) \
+	X(PFNGLDEPTHRANGEARRAYVPROC, glDepthRangeArrayv) \
+	X(PFNGLDEPTHRANGEINDEXEDPROC, glDepthRangeIndexed) \
+	X(PFNGLGETFLOATI_VPROC, glGetFloati_v) \
+	X(PFNGLGETDOUBLEI_VPROC, glGetDoublei_v) \
+	X(PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, glDrawArraysInstancedBaseInstance) \
+	X(PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC, glDrawElementsInstancedBaseInstance) \
+	X(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, glDrawElementsInstancedBaseVertexBaseInstance) \
+	X(PFNGLGETINTERNALFORMATIVPROC, glGetInternalformativ) \
+	X(PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC, glGetActiveAtomicCounterBufferiv) \
+	X(PFNGLBINDIMAGETEXTUREPROC, glBindImageTexture) \
+	X(PFNGLMEMORYBARRIERPROC, glMemoryBarrier) \
+	X(PFNGLTEXSTORAGE1DPROC, glTexStorage1D) \
+	X(PFNGLTEXSTORAGE2DPROC, glTexStorage2D) \
+	X(PFNGLTEXSTORAGE3DPROC, glTexStorage3D) \
+	X(PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC, glDrawTransformFeedbackInstanced) \
+	X(PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC, glDrawTransformFeedbackStreamInstanced) \
+	X(PFNGLCLEARBUFFERDATAPROC, glClearBufferData) \
+	X(PFNGLCLEARBUFFERSUBDATAPROC, glClearBufferSubData) \
+	X(PFNGLDISPATCHCOMPUTEPROC, glDispatchCompute) \
+	X(PFNGLDISPATCHCOMPUTEINDIRECTPROC, glDispatchComputeIndirect) \
+	X(PFNGLCOPYIMAGESUBDATAPROC, glCopyImageSubData) \
+	X(PFNGLFRAMEBUFFERPARAMETERIPROC, glFramebufferParameteri) \
+	X(PFNGLGETFRAMEBUFFERPARAMETERIVPROC, glGetFramebufferParameteriv) \
+	X(PFNGLGETINTERNALFORMATI64VPROC, glGetInternalformati64v) \
+	X(PFNGLINVALIDATETEXSUBIMAGEPROC, glInvalidateTexSubImage) \
+	X(PFNGLINVALIDATETEXIMAGEPROC, glInvalidateTexImage) \
+	X(PFNGLINVALIDATEBUFFERSUBDATAPROC, glInvalidateBufferSubData) \
+	X(PFNGLINVALIDATEBUFFERDATAPROC, glInvalidateBufferData) \
+	X(PFNGLINVALIDATEFRAMEBUFFERPROC, glInvalidateFramebuffer) \
+	X(PFNGLINVALIDATESUBFRAMEBUFFERPROC, glInvalidateSubFramebuffer) \
+	X(PFNGLMULTIDRAWARRAYSINDIRECTPROC, glMultiDrawArraysIndirect) \
+	X(PFNGLMULTIDRAWELEMENTSINDIRECTPROC, glMultiDrawElementsIndirect) \
+	X(PFNGLGETPROGRAMINTERFACEIVPROC, glGetProgramInterfaceiv) \
+	X(PFNGLGETPROGRAMRESOURCEINDEXPROC, glGetProgramResourceIndex) \
+	X(PFNGLGETPROGRAMRESOURCENAMEPROC, glGetProgramResourceName) \
+	X(PFNGLGETPROGRAMRESOURCEIVPROC, glGetProgramResourceiv) \
+	X(PFNGLGETPROGRAMRESOURCELOCATIONPROC, glGetProgramResourceLocation) \
+	X(PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC, glGetProgramResourceLocationIndex) \
+	X(PFNGLSHADERSTORAGEBLOCKBINDINGPROC, glShaderStorageBlockBinding) \
+	X(PFNGLTEXBUFFERRANGEPROC, glTexBufferRange) \
+	X(PFNGLTEXSTORAGE2DMULTISAMPLEPROC, glTexStorage2DMultisample) \
+	X(PFNGLTEXSTORAGE3DMULTISAMPLEPROC, glTexStorage3DMultisample) \
+	X(PFNGLTEXTUREVIEWPROC, glTextureView) \
+	X(PFNGLBINDVERTEXBUFFERPROC, glBindVertexBuffer) \
+	X(PFNGLVERTEXATTRIBFORMATPROC, glVertexAttribFormat) \
+	X(PFNGLVERTEXATTRIBIFORMATPROC, glVertexAttribIFormat) \
+	X(PFNGLVERTEXATTRIBLFORMATPROC, glVertexAttribLFormat) \
+	X(PFNGLVERTEXATTRIBBINDINGPROC, glVertexAttribBinding) \
+	X(PFNGLVERTEXBINDINGDIVISORPROC, glVertexBindingDivisor) \
+	X(PFNGLDEBUGMESSAGECONTROLPROC, glDebugMessageControl) \
+	X(PFNGLDEBUGMESSAGEINSERTPROC, glDebugMessageInsert) \
+	X(PFNGLDEBUGMESSAGECALLBACKPROC, glDebugMessageCallback) \
+	X(PFNGLGETDEBUGMESSAGELOGPROC, glGetDebugMessageLog) \
+	X(PFNGLPUSHDEBUGGROUPPROC, glPushDebugGroup) \
+	X(PFNGLPOPDEBUGGROUPPROC, glPopDebugGroup) \
+	X(PFNGLOBJECTLABELPROC, glObjectLabel) \
+	X(PFNGLGETOBJECTLABELPROC, glGetObjectLabel) \
+	X(PFNGLOBJECTPTRLABELPROC, glObjectPtrLabel) \
+	X(PFNGLGETOBJECTPTRLABELPROC, glGetObjectPtrLabel) \
+	X(PFNGLBUFFERSTORAGEPROC, glBufferStorage) \
+	X(PFNGLCLEARTEXIMAGEPROC, glClearTexImage) \
+	X(PFNGLCLEARTEXSUBIMAGEPROC, glClearTexSubImage) \
+	X(PFNGLBINDBUFFERSBASEPROC, glBindBuffersBase) \
+	X(PFNGLBINDBUFFERSRANGEPROC, glBindBuffersRange) \
+	X(PFNGLBINDTEXTURESPROC, glBindTextures) \
+	X(PFNGLBINDSAMPLERSPROC, glBindSamplers) \
+	X(PFNGLBINDIMAGETEXTURESPROC, glBindImageTextures) \
+	X(PFNGLBINDVERTEXBUFFERSPROC, glBindVertexBuffers) \
+	X(PFNGLCLIPCONTROLPROC, glClipControl) \
+	X(PFNGLCREATETRANSFORMFEEDBACKSPROC, glCreateTransformFeedbacks) \
+	X(PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC, glTransformFeedbackBufferBase) \
+	X(PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC, glTransformFeedbackBufferRange) \
+	X(PFNGLGETTRANSFORMFEEDBACKIVPROC, glGetTransformFeedbackiv) \
+	X(PFNGLGETTRANSFORMFEEDBACKI_VPROC, glGetTransformFeedbacki_v) \
+	X(PFNGLGETTRANSFORMFEEDBACKI64_VPROC, glGetTransformFeedbacki64_v) \
+	X(PFNGLCREATEBUFFERSPROC, glCreateBuffers) \
+	X(PFNGLNAMEDBUFFERSTORAGEPROC, glNamedBufferStorage) \
+	X(PFNGLNAMEDBUFFERDATAPROC, glNamedBufferData) \
+	X(PFNGLNAMEDBUFFERSUBDATAPROC, glNamedBufferSubData) \
+	X(PFNGLCOPYNAMEDBUFFERSUBDATAPROC, glCopyNamedBufferSubData) \
+	X(PFNGLCLEARNAMEDBUFFERDATAPROC, glClearNamedBufferData) \
+	X(PFNGLCLEARNAMEDBUFFERSUBDATAPROC, glClearNamedBufferSubData) \
+	X(PFNGLMAPNAMEDBUFFERPROC, glMapNamedBuffer) \
+	X(PFNGLMAPNAMEDBUFFERRANGEPROC, glMapNamedBufferRange) \
+	X(PFNGLUNMAPNAMEDBUFFERPROC, glUnmapNamedBuffer) \
+	X(PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC, glFlushMappedNamedBufferRange) \
+	X(PFNGLGETNAMEDBUFFERPARAMETERIVPROC, glGetNamedBufferParameteriv) \
+	X(PFNGLGETNAMEDBUFFERPARAMETERI64VPROC, glGetNamedBufferParameteri64v) \
+	X(PFNGLGETNAMEDBUFFERPOINTERVPROC, glGetNamedBufferPointerv) \
+	X(PFNGLGETNAMEDBUFFERSUBDATAPROC, glGetNamedBufferSubData) \
+	X(PFNGLCREATEFRAMEBUFFERSPROC, glCreateFramebuffers) \
+	X(PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC, glNamedFramebufferRenderbuffer) \
+	X(PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC, glNamedFramebufferParameteri) \
+	X(PFNGLNAMEDFRAMEBUFFERTEXTUREPROC, glNamedFramebufferTexture) \
+	X(PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC, glNamedFramebufferTextureLayer) \
+	X(PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC, glNamedFramebufferDrawBuffer) \
+	X(PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC, glNamedFramebufferDrawBuffers) \
+	X(PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC, glNamedFramebufferReadBuffer) \
+	X(PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC, glInvalidateNamedFramebufferData) \
+	X(PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC, glInvalidateNamedFramebufferSubData) \
+	X(PFNGLCLEARNAMEDFRAMEBUFFERIVPROC, glClearNamedFramebufferiv) \
+	X(PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC, glClearNamedFramebufferuiv) \
+	X(PFNGLCLEARNAMEDFRAMEBUFFERFVPROC, glClearNamedFramebufferfv) \
+	X(PFNGLCLEARNAMEDFRAMEBUFFERFIPROC, glClearNamedFramebufferfi) \
+	X(PFNGLBLITNAMEDFRAMEBUFFERPROC, glBlitNamedFramebuffer) \
+	X(PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC, glCheckNamedFramebufferStatus) \
+	X(PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC, glGetNamedFramebufferParameteriv) \
+	X(PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC, glGetNamedFramebufferAttachmentParameteriv) \
+	X(PFNGLCREATERENDERBUFFERSPROC, glCreateRenderbuffers) \
+	X(PFNGLNAMEDRENDERBUFFERSTORAGEPROC, glNamedRenderbufferStorage) \
+	X(PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC, glNamedRenderbufferStorageMultisample) \
+	X(PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC, glGetNamedRenderbufferParameteriv) \
+	X(PFNGLCREATETEXTURESPROC, glCreateTextures) \
+	X(PFNGLTEXTUREBUFFERPROC, glTextureBuffer) \
+	X(PFNGLTEXTUREBUFFERRANGEPROC, glTextureBufferRange) \
+	X(PFNGLTEXTURESTORAGE1DPROC, glTextureStorage1D) \
+	X(PFNGLTEXTURESTORAGE2DPROC, glTextureStorage2D) \
+	X(PFNGLTEXTURESTORAGE3DPROC, glTextureStorage3D) \
+	X(PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC, glTextureStorage2DMultisample) \
+	X(PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC, glTextureStorage3DMultisample) \
+	X(PFNGLTEXTURESUBIMAGE1DPROC, glTextureSubImage1D) \
+	X(PFNGLTEXTURESUBIMAGE2DPROC, glTextureSubImage2D) \
+	X(PFNGLTEXTURESUBIMAGE3DPROC, glTextureSubImage3D) \
+	X(PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC, glCompressedTextureSubImage1D) \
+	X(PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC, glCompressedTextureSubImage2D) \
+	X(PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC, glCompressedTextureSubImage3D) \
+	X(PFNGLCOPYTEXTURESUBIMAGE1DPROC, glCopyTextureSubImage1D) \
+	X(PFNGLCOPYTEXTURESUBIMAGE2DPROC, glCopyTextureSubImage2D) \
+	X(PFNGLCOPYTEXTURESUBIMAGE3DPROC, glCopyTextureSubImage3D) \
+	X(PFNGLTEXTUREPARAMETERFPROC, glTextureParameterf) \
+	X(PFNGLTEXTUREPARAMETERFVPROC, glTextureParameterfv) \
+	X(PFNGLTEXTUREPARAMETERIPROC, glTextureParameteri) \
+	X(PFNGLTEXTUREPARAMETERIIVPROC, glTextureParameterIiv) \
+	X(PFNGLTEXTUREPARAMETERIUIVPROC, glTextureParameterIuiv) \
+	X(PFNGLTEXTUREPARAMETERIVPROC, glTextureParameteriv) \
+	X(PFNGLGENERATETEXTUREMIPMAPPROC, glGenerateTextureMipmap) \
+	X(PFNGLBINDTEXTUREUNITPROC, glBindTextureUnit) \
+	X(PFNGLGETTEXTUREIMAGEPROC, glGetTextureImage) \
+	X(PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC, glGetCompressedTextureImage) \
+	X(PFNGLGETTEXTURELEVELPARAMETERFVPROC, glGetTextureLevelParameterfv) \
+	X(PFNGLGETTEXTURELEVELPARAMETERIVPROC, glGetTextureLevelParameteriv) \
+	X(PFNGLGETTEXTUREPARAMETERFVPROC, glGetTextureParameterfv) \
+	X(PFNGLGETTEXTUREPARAMETERIIVPROC, glGetTextureParameterIiv) \
+	X(PFNGLGETTEXTUREPARAMETERIUIVPROC, glGetTextureParameterIuiv) \
+	X(PFNGLGETTEXTUREPARAMETERIVPROC, glGetTextureParameteriv) \
+	X(PFNGLCREATEVERTEXARRAYSPROC, glCreateVertexArrays) \
+	X(PFNGLDISABLEVERTEXARRAYATTRIBPROC, glDisableVertexArrayAttrib) \
+	X(PFNGLENABLEVERTEXARRAYATTRIBPROC, glEnableVertexArrayAttrib) \
+	X(PFNGLVERTEXARRAYELEMENTBUFFERPROC, glVertexArrayElementBuffer) \
+	X(PFNGLVERTEXARRAYVERTEXBUFFERPROC, glVertexArrayVertexBuffer) \
+	X(PFNGLVERTEXARRAYVERTEXBUFFERSPROC, glVertexArrayVertexBuffers) \
+	X(PFNGLVERTEXARRAYATTRIBBINDINGPROC, glVertexArrayAttribBinding) \
+	X(PFNGLVERTEXARRAYATTRIBFORMATPROC, glVertexArrayAttribFormat) \
+	X(PFNGLVERTEXARRAYATTRIBIFORMATPROC, glVertexArrayAttribIFormat) \
+	X(PFNGLVERTEXARRAYATTRIBLFORMATPROC, glVertexArrayAttribLFormat) \
+	X(PFNGLVERTEXARRAYBINDINGDIVISORPROC, glVertexArrayBindingDivisor) \
+	X(PFNGLGETVERTEXARRAYIVPROC, glGetVertexArrayiv) \
+	X(PFNGLGETVERTEXARRAYINDEXEDIVPROC, glGetVertexArrayIndexediv) \
+	X(PFNGLGETVERTEXARRAYINDEXED64IVPROC, glGetVertexArrayIndexed64iv) \
+	X(PFNGLCREATESAMPLERSPROC, glCreateSamplers) \
+	X(PFNGLCREATEPROGRAMPIPELINESPROC, glCreateProgramPipelines) \
+	X(PFNGLCREATEQUERIESPROC, glCreateQueries) \
+	X(PFNGLGETQUERYBUFFEROBJECTI64VPROC, glGetQueryBufferObjecti64v) \
+	X(PFNGLGETQUERYBUFFEROBJECTIVPROC, glGetQueryBufferObjectiv) \
+	X(PFNGLGETQUERYBUFFEROBJECTUI64VPROC, glGetQueryBufferObjectui64v) \
+	X(PFNGLGETQUERYBUFFEROBJECTUIVPROC, glGetQueryBufferObjectuiv) \
+	X(PFNGLMEMORYBARRIERBYREGIONPROC, glMemoryBarrierByRegion) \
+	X(PFNGLGETTEXTURESUBIMAGEPROC, glGetTextureSubImage) \
+	X(PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC, glGetCompressedTextureSubImage) \
+	X(PFNGLGETGRAPHICSRESETSTATUSPROC, glGetGraphicsResetStatus) \
+	X(PFNGLGETNCOMPRESSEDTEXIMAGEPROC, glGetnCompressedTexImage) \
+	X(PFNGLGETNTEXIMAGEPROC, glGetnTexImage) \
+	X(PFNGLGETNUNIFORMDVPROC, glGetnUniformdv) \
+	X(PFNGLGETNUNIFORMFVPROC, glGetnUniformfv) \
+	X(PFNGLGETNUNIFORMIVPROC, glGetnUniformiv) \
+	X(PFNGLGETNUNIFORMUIVPROC, glGetnUniformuiv) \
+	X(PFNGLREADNPIXELSPROC, glReadnPixels) \
+	X(PFNGLGETNMAPDVPROC, glGetnMapdv) \
+	X(PFNGLGETNMAPFVPROC, glGetnMapfv) \
+	X(PFNGLGETNMAPIVPROC, glGetnMapiv) \
+	X(PFNGLGETNPIXELMAPFVPROC, glGetnPixelMapfv) \
+	X(PFNGLGETNPIXELMAPUIVPROC, glGetnPixelMapuiv) \
+	X(PFNGLGETNPIXELMAPUSVPROC, glGetnPixelMapusv) \
+	X(PFNGLGETNPOLYGONSTIPPLEPROC, glGetnPolygonStipple) \
+	X(PFNGLGETNCOLORTABLEPROC, glGetnColorTable) \
+	X(PFNGLGETNCONVOLUTIONFILTERPROC, glGetnConvolutionFilter) \
+	X(PFNGLGETNSEPARABLEFILTERPROC, glGetnSeparableFilter) \
+	X(PFNGLGETNHISTOGRAMPROC, glGetnHistogram) \
+	X(PFNGLGETNMINMAXPROC, glGetnMinmax) \
+	X(PFNGLTEXTUREBARRIERPROC, glTextureBarrier) \
+	X(PFNGLSPECIALIZESHADERPROC, glSpecializeShader) \
+	X(PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC, glMultiDrawArraysIndirectCount) \
+	X(PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC, glMultiDrawElementsIndirectCount) \
+	X(PFNGLPOLYGONOFFSETCLAMPPROC, glPolygonOffsetClamp) \
+	X(PFNGLBLENDBARRIERPROC, glBlendBarrier) \
+	X(PFNGLPRIMITIVEBOUNDINGBOXPROC, glPrimitiveBoundingBox)
+
@@ -0,0 +1,135 @@
+#include "GLFunctionTable.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+#include <GLFW/glfw3.h>
+#include <LoggingAD/LoggingAD.h>
+
+namespace OORenderer {
+
+	// Every table loaded so far, so contexts with identical entry points can share one. Guarded as decode workers check formats against them
+	static std::vector<std::weak_ptr<const GLFunctionTable>> s_LoadedTables;
+	static std::mutex s_LoadedTablesMutex;
+
+	std::shared_ptr<const GLFunctionTable> GLFunctionTable::LoadForCurrentContext() {
+		if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+			LoggingAD::Error("[OORenderer::GLFunctionTable::Load] GLAD failed to load for context: {:#010x}", reinterpret_cast<std::uintptr_t>(glfwGetCurrentContext()));
+			return nullptr;
+		}
+
+		auto table = std::make_shared<GLFunctionTable>();
+		table->CaptureFromGLAD();
+
+		// GLAD's globals now hold this context's entry points, whichever table we hand back
+		sm_InstalledTable = nullptr;
+
+		std::lock_guard lock(s_LoadedTablesMutex);
+		std::erase_if(s_LoadedTables, [](const auto& weakTable) { return weakTable.expired(); });
+		for (const auto& weakTable : s_LoadedTables) {
+			auto loadedTable = weakTable.lock();
+			if (loadedTable->HasSameEntryPoints(*table)) {
+				LoggingAD::Trace("[OORenderer::GLFunctionTable::Load] Context shares entry points with an existing table, reusing it.");
+				sm_InstalledTable = loadedTable.get();
+				return loadedTable;
+			}
+		}
+
+		LoggingAD::Trace("[OORenderer::GLFunctionTable::Load] Loaded new function table for OpenGL {}.{}", table->m_Version.major, table->m_Version.minor);
+		sm_InstalledTable = table.get();
+		s_LoadedTables.push_back(table);
+		return table;
+	}
+
+	void GLFunctionTable::InvalidateInstalled() {
+		sm_InstalledTable = nullptr;
+	}
+
+	std::size_t GLFunctionTable::GetLoadedCount() {
+		std::lock_guard lock(s_LoadedTablesMutex);
+		return std::ranges::count_if(s_LoadedTables, [](const auto& weakTable) { return !weakTable.expired(); });
+	}
+
+	const GLFunctionTable* GLFunctionTable::GetInstalled() {
+		return sm_InstalledTable;
+	}
+
+	bool GLFunctionTable::SupportsCompressedFormatEverywhere(GLenum internalFormat) {
+		std::lock_guard lock(s_LoadedTablesMutex);
+		return std::ranges::all_of(s_LoadedTables, [internalFormat](const auto& weakTable) {
+			auto loadedTable = weakTable.lock();
+			return !loadedTable || loadedTable->SupportsCompressedFormat(internalFormat);
+		});
+	}
+
+	std::vector<GLint> GLFunctionTable::QueryCompressedFormats() {
+		GLint numFormats = 0;
+		glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &numFormats);
+		std::vector<GLint> formats(numFormats);
+		glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats.data());
+
+		// Only general purpose formats need be listed, RGTC is core since 3.0 and BPTC since 4.2
+		if (GLAD_GL_VERSION_3_0) {
+			formats.push_back(GL_COMPRESSED_RED_RGTC1);
+			formats.push_back(GL_COMPRESSED_RG_RGTC2);
+		}
+		if (GLAD_GL_VERSION_4_2) {
+			formats.push_back(GL_COMPRESSED_RGBA_BPTC_UNORM);
+		}
+		return formats;
+	}
+
+	GLFunctionTable::~GLFunctionTable() {
+		// A later table may be allocated at this address, don't let it think it's installed
+		if (sm_InstalledTable == this) {
+			sm_InstalledTable = nullptr;
+		}
+	}
+
+	void GLFunctionTable::Install() const {
+		if (sm_InstalledTable == this) {
+			return;
+		}
+
+		std::size_t i = 0;
+#define OORENDERER_INSTALL_FUNCTION(type, name) glad_##name = reinterpret_cast<type>(m_Functions[i++]);
+		OORENDERER_GLAD_FUNCTIONS(OORENDERER_INSTALL_FUNCTION)
+#undef OORENDERER_INSTALL_FUNCTION
+
+		i = 0;
+#define OORENDERER_INSTALL_FLAG(name) name = m_VersionFlags[i++];
+		OORENDERER_GLAD_VERSION_FLAGS(OORENDERER_INSTALL_FLAG)
+#undef OORENDERER_INSTALL_FLAG
+
+		GLVersion = m_Version;
+		sm_InstalledTable = this;
+	}
+
+	bool GLFunctionTable::SupportsCompressedFormat(GLenum internalFormat) const {
+		return std::ranges::find(m_CompressedFormats, static_cast<GLint>(internalFormat)) != m_CompressedFormats.end();
+	}
+
+	void GLFunctionTable::CaptureFromGLAD() {
+		std::size_t i = 0;
+#define OORENDERER_CAPTURE_FUNCTION(type, name) m_Functions[i++] = reinterpret_cast<void*>(glad_##name);
+		OORENDERER_GLAD_FUNCTIONS(OORENDERER_CAPTURE_FUNCTION)
+#undef OORENDERER_CAPTURE_FUNCTION
+
+		i = 0;
+#define OORENDERER_CAPTURE_FLAG(name) m_VersionFlags[i++] = name;
+		OORENDERER_GLAD_VERSION_FLAGS(OORENDERER_CAPTURE_FLAG)
+#undef OORENDERER_CAPTURE_FLAG
+
+		m_Version = GLVersion;
+		m_CompressedFormats = QueryCompressedFormats();
+	}
+
+	bool GLFunctionTable::HasSameEntryPoints(const GLFunctionTable& other) const {
+		return m_Functions == other.m_Functions
+			&& m_VersionFlags == other.m_VersionFlags
+			&& m_Version.major == other.m_Version.major
+			&& m_Version.minor == other.m_Version.minor
+			&& m_CompressedFormats == other.m_CompressedFormats;
+	}
+
+} // OORenderer
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "GLFunctionList.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// Snapshot of every GLAD entry point as resolved for a particular OpenGL context.
+	/// GLAD stores its entry points in globals, so switching context means pointing those globals at the
+	/// right table. Contexts whose entry points resolve identically (the usual case) share one table,
+	/// making a switch between them free.
+	/// </summary>
+	class GLFunctionTable {
+	public: // Public static methods
+
+		/// <summary>
+		/// Resolve all entry points for the current context, expensive so do this once per context.
+		/// Returns an existing table if one with identical entry points is already loaded.
+		/// </summary>
+		/// <returns>Table for the current context, nullptr if GLAD failed to load</returns>
+		static std::shared_ptr<const GLFunctionTable> LoadForCurrentContext();
+
+		/// <summary>
+		/// Note that GLAD's globals were loaded by other means, so no table is installed any more
+		/// </summary>
+		static void InvalidateInstalled();
+
+		/// <summary>
+		/// Get how many distinct tables are loaded, more than one means threads can't render to contexts at once as GLAD's globals hold one
+		/// </summary>
+		static std::size_t GetLoadedCount();
+
+		/// <summary>
+		/// Get the table GLAD's globals hold
+		/// </summary>
+		/// <returns>The installed table, nullptr if GLAD was loaded by other means</returns>
+		static const GLFunctionTable* GetInstalled();
+
+		/// <summary>
+		/// Is a compressed internal format supported by the contexts of every table loaded, so by any window open. Safe from any thread, no context needed
+		/// </summary>
+		/// <returns>True if so or no table is loaded yet, false otherwise</returns>
+		static bool SupportsCompressedFormatEverywhere(GLenum internalFormat);
+
+		/// <summary>
+		/// Ask the current context which compressed internal formats it supports, including those core to its version that drivers needn't list
+		/// </summary>
+		static std::vector<GLint> QueryCompressedFormats();
+
+	public: // Public methods
+		GLFunctionTable() = default;
+		~GLFunctionTable();
+
+		GLFunctionTable(const GLFunctionTable&) = delete;
+		GLFunctionTable& operator=(const GLFunctionTable&) = delete;
+
+		/// <summary>
+		/// Point GLAD at this table's entry points, does nothing if already installed
+		/// </summary>
+		void Install() const;
+
+		/// <summary>
+		/// Is a compressed internal format supported by this table's contexts, as listed when the table was loaded
+		/// </summary>
+		bool SupportsCompressedFormat(GLenum internalFormat) const;
+
+	private: // Private methods
+		void CaptureFromGLAD();
+		bool HasSameEntryPoints(const GLFunctionTable& other) const;
+
+	private: // Private static members
+		// Count the entries in the GLAD lists so we can size our tables
+#define OORENDERER_COUNT_ENTRY(...) + 1
+		static constexpr std::size_t sm_NumFunctions = 0 OORENDERER_GLAD_FUNCTIONS(OORENDERER_COUNT_ENTRY);
+		static constexpr std::size_t sm_NumVersionFlags = 0 OORENDERER_GLAD_VERSION_FLAGS(OORENDERER_COUNT_ENTRY);
+#undef OORENDERER_COUNT_ENTRY
+
+		// Table currently held in the GLAD globals
+		inline static const GLFunctionTable* sm_InstalledTable = nullptr;
+
+	private: // Private members
+		std::array<void*, sm_NumFunctions> m_Functions{};
+		std::array<int, sm_NumVersionFlags> m_VersionFlags{};
+		gladGLversionStruct m_Version{};
+
+		// Listed once when loaded, as asking the context means a round trip to the driver
+		std::vector<GLint> m_CompressedFormats;
+	};
+
+} // OORenderer
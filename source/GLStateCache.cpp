@@ -0,0 +1,295 @@
+#include "OORenderer/GLStateCache.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "OORenderer/Window.h"
+#include "OORenderer/ShareGroup.h"
+
+namespace OORenderer {
+
+	// Marks state we don't know, so the next bind is issued whatever it is
+	static constexpr GLuint s_Unknown = ~GLuint{ 0 };
+
+	// Targets tracked, in the order of GLStateCache's arrays. Anything else is always issued
+	static constexpr GLenum s_BufferTargets[] = {
+		GL_ARRAY_BUFFER, GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, GL_DRAW_INDIRECT_BUFFER,
+		GL_UNIFORM_BUFFER, GL_PIXEL_PACK_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_TEXTURE_BUFFER
+	};
+	static constexpr GLenum s_TextureTargets[] = { GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_CUBE_MAP };
+	static constexpr GLenum s_Capabilities[] = {
+		GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_SCISSOR_TEST,
+		GL_STENCIL_TEST, GL_FRAMEBUFFER_SRGB, GL_PRIMITIVE_RESTART, GL_POLYGON_OFFSET_FILL
+	};
+
+	static thread_local GLStateCache* s_CurrentCache = nullptr;
+
+	// Stands in for contexts not created by a Window
+	static thread_local GLStateCache s_ForeignCache;
+
+	template<typename T, std::size_t N>
+	static std::ptrdiff_t IndexOf(const T (&values)[N], T value) {
+		auto it = std::ranges::find(values, value);
+		return it == std::end(values) ? -1 : std::distance(std::begin(values), it);
+	}
+
+	// Count a call, issuing it only if the cached value changes
+	template<typename T, typename TIssue>
+	static void SetCached(T& cached, T value, GLStateCache::Counter& counter, TIssue&& issue) {
+		if (cached == value) {
+			++counter.Skipped;
+			return;
+		}
+		cached = value;
+		++counter.Issued;
+		issue();
+	}
+
+	std::size_t GLStateCache::Stats::GetIssued() const {
+		return Programs.Issued + VertexArrays.Issued + Buffers.Issued + Textures.Issued + Samplers.Issued + Capabilities.Issued;
+	}
+
+	std::size_t GLStateCache::Stats::GetSkipped() const {
+		return Programs.Skipped + VertexArrays.Skipped + Buffers.Skipped + Textures.Skipped + Samplers.Skipped + Capabilities.Skipped;
+	}
+
+	GLStateCache& GLStateCache::Current() {
+		return s_CurrentCache ? *s_CurrentCache : s_ForeignCache;
+	}
+
+	void GLStateCache::ForgetBuffer(GLFWwindow* window, GLuint buffer) {
+		ForgetOnShareGroup(window, buffer, false);
+	}
+
+	void GLStateCache::ForgetTexture(GLFWwindow* window, GLuint texture) {
+		ForgetOnShareGroup(window, texture, true);
+	}
+
+	void GLStateCache::ForgetOnShareGroup(GLFWwindow* window, GLuint name, bool texture) {
+		auto forget = [name, texture](GLStateCache& cache) {
+			if (texture) {
+				cache.ForgetTextureName(name);
+			}
+			else {
+				cache.ForgetBufferName(name);
+			}
+		};
+
+		const ShareGroup* shareGroup = ShareGroup::Of(window);
+		if (!shareGroup) {
+			forget(Current());
+			return;
+		}
+
+		// Only our own cache is safe to change here, others may be in use on render threads
+		GLStateCache& current = Current();
+		for (GLFWwindow* member : shareGroup->GetWindows()) {
+			if (Window* user = static_cast<Window*>(glfwGetWindowUserPointer(member))) {
+				GLStateCache& cache = user->GetStateCache();
+				if (&cache == &current) {
+					forget(cache);
+				}
+				else {
+					cache.QueueForgetName(name, texture);
+				}
+			}
+		}
+	}
+
+	GLStateCache::GLStateCache() {
+		Invalidate();
+	}
+
+	void GLStateCache::UseProgram(GLuint program) {
+		SetCached(m_Program, program, m_Stats.Programs, [program] { glUseProgram(program); });
+	}
+
+	void GLStateCache::BindVertexArray(GLuint vertexArray) {
+		SetCached(m_VertexArray, vertexArray, m_Stats.VertexArrays, [vertexArray] { glBindVertexArray(vertexArray); });
+	}
+
+	void GLStateCache::BindBuffer(GLenum target, GLuint buffer) {
+		std::ptrdiff_t targetIndex = IndexOf(s_BufferTargets, target);
+		if (targetIndex < 0) {
+			++m_Stats.Buffers.Issued;
+			glBindBuffer(target, buffer);
+			return;
+		}
+		SetCached(m_Buffers[targetIndex], buffer, m_Stats.Buffers, [target, buffer] { glBindBuffer(target, buffer); });
+	}
+
+	void GLStateCache::BindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+		BindBufferRange(target, index, buffer, 0, -1);
+	}
+
+	void GLStateCache::BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+		auto issue = [=] {
+			if (size < 0) {
+				glBindBufferBase(target, index, buffer);
+			}
+			else {
+				glBindBufferRange(target, index, buffer, offset, size);
+			}
+		};
+
+		// Both bind the generic binding too
+		if (std::ptrdiff_t targetIndex = IndexOf(s_BufferTargets, target); targetIndex >= 0) {
+			m_Buffers[targetIndex] = buffer;
+		}
+
+		if (target != GL_UNIFORM_BUFFER) {
+			++m_Stats.Buffers.Issued;
+			issue();
+			return;
+		}
+
+		if (index >= m_UniformBuffers.size()) {
+			m_UniformBuffers.resize(index + 1, { s_Unknown, 0, 0 });
+		}
+		IndexedBuffer& bound = m_UniformBuffers[index];
+		if (bound.Buffer == buffer && bound.Offset == offset && bound.Size == size) {
+			++m_Stats.Buffers.Skipped;
+			return;
+		}
+		bound = { buffer, offset, size };
+		++m_Stats.Buffers.Issued;
+		issue();
+	}
+
+	void GLStateCache::BindTexture(GLuint unit, GLenum target, GLuint texture) {
+		std::ptrdiff_t targetIndex = IndexOf(s_TextureTargets, target);
+		if (targetIndex >= 0 && GetUnit(unit).Textures[targetIndex] == texture) {
+			++m_Stats.Textures.Skipped;
+			return;
+		}
+
+		SetActiveUnit(unit);
+		if (targetIndex >= 0) {
+			GetUnit(unit).Textures[targetIndex] = texture;
+		}
+		++m_Stats.Textures.Issued;
+		glBindTexture(target, texture);
+	}
+
+	void GLStateCache::BindTexture(GLenum target, GLuint texture) {
+		// With the active unit unknown, any unit does
+		BindTexture(m_ActiveUnit == s_Unknown ? 0 : m_ActiveUnit, target, texture);
+	}
+
+	void GLStateCache::BindSampler(GLuint unit, GLuint sampler) {
+		SetCached(GetUnit(unit).Sampler, sampler, m_Stats.Samplers, [unit, sampler] { glBindSampler(unit, sampler); });
+	}
+
+	void GLStateCache::SetEnabled(GLenum capability, bool enabled) {
+		auto issue = [capability, enabled] {
+			if (enabled) {
+				glEnable(capability);
+			}
+			else {
+				glDisable(capability);
+			}
+		};
+
+		std::ptrdiff_t capabilityIndex = IndexOf(s_Capabilities, capability);
+		if (capabilityIndex < 0) {
+			++m_Stats.Capabilities.Issued;
+			issue();
+			return;
+		}
+		SetCached(m_Capabilities[capabilityIndex], static_cast<std::int8_t>(enabled), m_Stats.Capabilities, issue);
+	}
+
+	void GLStateCache::Invalidate() {
+		m_Program = s_Unknown;
+		m_VertexArray = s_Unknown;
+		m_Buffers.fill(s_Unknown);
+		m_UniformBuffers.clear();
+		m_ActiveUnit = s_Unknown;
+		m_Units.clear();
+		m_Capabilities.fill(-1);
+	}
+
+	const GLStateCache::Stats& GLStateCache::GetStats() const {
+		return m_Stats;
+	}
+
+	const GLStateCache::Stats& GLStateCache::GetFrameStats() const {
+		return m_FrameStats;
+	}
+
+	void GLStateCache::EndFrame() {
+		m_FrameStats = m_Stats;
+		m_Stats = {};
+	}
+
+	void GLStateCache::ForgetBufferName(GLuint buffer) {
+		for (GLuint& bound : m_Buffers) {
+			if (bound == buffer) {
+				bound = s_Unknown;
+			}
+		}
+		for (IndexedBuffer& bound : m_UniformBuffers) {
+			if (bound.Buffer == buffer) {
+				bound.Buffer = s_Unknown;
+			}
+		}
+	}
+
+	void GLStateCache::ForgetTextureName(GLuint texture) {
+		for (TextureUnit& unit : m_Units) {
+			for (GLuint& bound : unit.Textures) {
+				if (bound == texture) {
+					bound = s_Unknown;
+				}
+			}
+		}
+	}
+
+	void GLStateCache::QueueForgetName(GLuint name, bool texture) {
+		std::lock_guard lock(m_ForgottenMutex);
+		(texture ? m_ForgottenTextures : m_ForgottenBuffers).push_back(name);
+		m_HasForgottenNames.store(true, std::memory_order_release);
+	}
+
+	void GLStateCache::ApplyForgottenNames() {
+		if (!m_HasForgottenNames.load(std::memory_order_acquire)) {
+			return;
+		}
+
+		std::lock_guard lock(m_ForgottenMutex);
+		for (GLuint buffer : m_ForgottenBuffers) {
+			ForgetBufferName(buffer);
+		}
+		for (GLuint texture : m_ForgottenTextures) {
+			ForgetTextureName(texture);
+		}
+		m_ForgottenBuffers.clear();
+		m_ForgottenTextures.clear();
+		m_HasForgottenNames.store(false, std::memory_order_relaxed);
+	}
+
+	void GLStateCache::SetActiveUnit(GLuint unit) {
+		SetCached(m_ActiveUnit, unit, m_Stats.Textures, [unit] { glActiveTexture(GL_TEXTURE0 + unit); });
+	}
+
+	GLStateCache::TextureUnit& GLStateCache::GetUnit(GLuint unit) {
+		if (unit >= m_Units.size()) {
+			TextureUnit unknownUnit;
+			unknownUnit.Textures.fill(s_Unknown);
+			unknownUnit.Sampler = s_Unknown;
+			m_Units.resize(unit + 1, unknownUnit);
+		}
+		return m_Units[unit];
+	}
+
+	void GLStateCache::SetCurrent(GLStateCache* cache) {
+		if (!cache) {
+			s_ForeignCache.Invalidate();
+		}
+		else {
+			cache->ApplyForgottenNames();
+		}
+		s_CurrentCache = cache;
+	}
+
+} // OORenderer
@@ -0,0 +1,104 @@
+#include "OORenderer/GeometryPool.h"
+
+#include <algorithm>
+#include <LoggingAD/LoggingAD.h>
+
+#include "OORenderer/Residency.h"
+#include "OORenderer/GLStateCache.h"
+
+namespace OORenderer {
+
+	GeometryPool::Range GeometryPool::Allocate(GLFWwindow* window, const VertexLayoutDescription& layout, GLenum indexType, std::size_t vertexCount, std::size_t indexCount) {
+		const ShareGroup* shareGroup = ShareGroup::Of(window);
+		std::vector<std::unique_ptr<Block>>& blocks = sm_Blocks[shareGroup->GetID()];
+
+		auto hasRoom = [&](const std::unique_ptr<Block>& block) {
+			return block->Layout == &layout && block->IndexType == indexType
+				&& block->VertexCount + vertexCount <= block->VertexCapacity && block->IndexCount + indexCount <= block->IndexCapacity;
+		};
+
+		auto blockIt = std::ranges::find_if(blocks, hasRoom);
+		if (blockIt == blocks.end()) {
+			std::size_t indexSize = indexType == GL_UNSIGNED_SHORT ? sizeof(std::uint16_t) : sizeof(std::uint32_t);
+
+			auto block = std::make_unique<Block>();
+			block->Layout = &layout;
+			block->IndexType = indexType;
+			block->VertexCapacity = std::max(sm_BlockSize / layout.Stride, vertexCount);
+			block->IndexCapacity = std::max(sm_BlockSize / indexSize, indexCount);
+
+			// Through the copy target, as the element array binding belongs to whatever VAO is bound
+			glGenBuffers(1, &block->VBO);
+			glGenBuffers(1, &block->EBO);
+			GLStateCache& state = GLStateCache::Current();
+			state.BindBuffer(GL_COPY_WRITE_BUFFER, block->VBO);
+			glBufferData(GL_COPY_WRITE_BUFFER, block->VertexCapacity * layout.Stride, NULL, GL_STATIC_DRAW);
+			state.BindBuffer(GL_COPY_WRITE_BUFFER, block->EBO);
+			glBufferData(GL_COPY_WRITE_BUFFER, block->IndexCapacity * indexSize, NULL, GL_STATIC_DRAW);
+
+			block->Tracking = Residency::Track(Residency::Asset::Mesh, shareGroup, block->VertexCapacity * layout.Stride + block->IndexCapacity * indexSize);
+
+			LoggingAD::Trace("[OORenderer::GeometryPool::Allocate] Created block of {} vertices and {} indices, {} blocks in share group {}",
+				block->VertexCapacity, block->IndexCapacity, blocks.size() + 1, shareGroup->GetID());
+
+			blocks.push_back(std::move(block));
+			blockIt = std::prev(blocks.end());
+		}
+
+		Block& block = **blockIt;
+		Range range{ &block, static_cast<std::uint32_t>(block.VertexCount), static_cast<std::uint32_t>(block.IndexCount) };
+		block.VertexCount += vertexCount;
+		block.IndexCount += indexCount;
+		return range;
+	}
+
+	unsigned int GeometryPool::GetVAOID(Block& block, GLFWwindow* window) {
+		auto VAOIDIt = block.WindowVAOIDs.find(window);
+		if (VAOIDIt != block.WindowVAOIDs.end()) {
+			return VAOIDIt->second;
+		}
+
+		// VAOs are containers so never shared, each window needs its own
+		unsigned int VAOID;
+		glGenVertexArrays(1, &VAOID);
+		GLStateCache& state = GLStateCache::Current();
+		state.BindVertexArray(VAOID);
+		state.BindBuffer(GL_ARRAY_BUFFER, block.VBO);
+		state.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, block.EBO);
+
+		for (const VertexLayoutDescription::Attribute& attribute : block.Layout->Attributes) {
+			glEnableVertexAttribArray(attribute.Location);
+			glVertexAttribPointer(attribute.Location, attribute.Components, attribute.Type, attribute.Normalized, block.Layout->Stride, (void*)attribute.Offset);
+		}
+
+		block.WindowVAOIDs[window] = VAOID;
+		return VAOID;
+	}
+
+	void GeometryPool::ForgetWindow(ShareGroup::ID shareGroupID, GLFWwindow* window) {
+		auto blocksIt = sm_Blocks.find(shareGroupID);
+		if (blocksIt == sm_Blocks.end()) {
+			return;
+		}
+		for (const std::unique_ptr<Block>& block : blocksIt->second) {
+			block->WindowVAOIDs.erase(window);
+		}
+	}
+
+	void GeometryPool::ReleaseShareGroup(ShareGroup::ID shareGroupID) {
+		sm_Blocks.erase(shareGroupID);
+	}
+
+	void GeometryPool::SetBlockSize(std::size_t bytes) {
+		sm_BlockSize = bytes;
+	}
+
+	std::size_t GeometryPool::GetBlockCount() {
+		std::size_t blockCount = 0;
+		for (const auto& [shareGroupID, blocks] : sm_Blocks) {
+			blockCount += blocks.size();
+		}
+		return blockCount;
+	}
+
+} // OORenderer
@@ -0,0 +1,215 @@
+#include "KTX2File.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <LoggingAD/LoggingAD.h>
+
+#include "MappedFile.h"
+
+namespace OORenderer {
+
+	static constexpr std::array<std::uint8_t, 12> s_Identifier = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+	// The 64 bit fields sit at 4 byte aligned offsets in the file
+#pragma pack(push, 4)
+	struct KTX2Header {
+		std::uint32_t VkFormat;
+		std::uint32_t TypeSize;
+		std::uint32_t PixelWidth;
+		std::uint32_t PixelHeight;
+		std::uint32_t PixelDepth;
+		std::uint32_t LayerCount;
+		std::uint32_t FaceCount;
+		std::uint32_t LevelCount;
+		std::uint32_t SupercompressionScheme;
+
+		std::uint32_t DFDByteOffset;
+		std::uint32_t DFDByteLength;
+		std::uint32_t KVDByteOffset;
+		std::uint32_t KVDByteLength;
+		std::uint64_t SGDByteOffset;
+		std::uint64_t SGDByteLength;
+	};
+#pragma pack(pop)
+	static_assert(sizeof(KTX2Header) == 68);
+
+	struct KTX2Level {
+		std::uint64_t ByteOffset;
+		std::uint64_t ByteLength;
+		std::uint64_t UncompressedByteLength;
+	};
+
+	struct FormatInfo {
+		BlockFormat Format;
+		std::uint32_t VkFormat;
+		std::uint8_t ColourModel;
+
+		// Data format descriptor samples as channel ID and bit offset
+		std::vector<std::pair<std::uint8_t, std::uint16_t>> Samples;
+	};
+
+	static const std::array<FormatInfo, 5> s_Formats = { {
+		{ BlockFormat::BC1, 131, 128, { { 0, 0 } } },              // VK_FORMAT_BC1_RGB_UNORM_BLOCK, KHR_DF_MODEL_BC1A
+		{ BlockFormat::BC3, 137, 130, { { 15, 0 }, { 0, 64 } } },  // VK_FORMAT_BC3_UNORM_BLOCK, KHR_DF_MODEL_BC3
+		{ BlockFormat::BC4, 139, 131, { { 0, 0 } } },              // VK_FORMAT_BC4_UNORM_BLOCK, KHR_DF_MODEL_BC4
+		{ BlockFormat::BC5, 141, 132, { { 0, 0 }, { 1, 64 } } },   // VK_FORMAT_BC5_UNORM_BLOCK, KHR_DF_MODEL_BC5
+		{ BlockFormat::BC7, 145, 134, { { 0, 0 } } }               // VK_FORMAT_BC7_UNORM_BLOCK, KHR_DF_MODEL_BC7
+	} };
+
+	static std::size_t GetLevelSize(BlockFormat format, std::uint32_t width, std::uint32_t height, std::uint32_t level) {
+		std::size_t levelWidth = std::max(width >> level, 1u);
+		std::size_t levelHeight = std::max(height >> level, 1u);
+		return ((levelWidth + 3) / 4) * ((levelHeight + 3) / 4) * BlockCompression::GetBlockSize(format);
+	}
+
+	static std::vector<std::uint8_t> BuildDataFormatDescriptor(const FormatInfo& formatInfo) {
+		std::vector<std::uint8_t> descriptor;
+		auto put = [&descriptor](std::uint64_t value, int bytes) {
+			for (int i = 0; i < bytes; ++i) {
+				descriptor.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+			}
+		};
+
+		std::uint32_t blockSize = 24 + 16 * static_cast<std::uint32_t>(formatInfo.Samples.size());
+		put(4 + blockSize, 4);              // dfdTotalSize
+		put(0, 4);                          // Khronos vendor, basic descriptor type
+		put(2, 2);                          // Version
+		put(blockSize, 2);
+		put(formatInfo.ColourModel, 1);
+		put(1, 1);                          // BT.709 primaries
+		put(1, 1);                          // Linear transfer
+		put(0, 1);                          // Straight alpha
+		put(3, 1); put(3, 1); put(0, 2);    // 4x4x1x1 texel blocks, each stored minus one
+		put(BlockCompression::GetBlockSize(formatInfo.Format), 1);
+		put(0, 7);                          // Remaining bytesPlane
+
+		std::uint32_t sampleBits = formatInfo.Samples.size() == 1 ? static_cast<std::uint32_t>(BlockCompression::GetBlockSize(formatInfo.Format) * 8) : 64;
+		for (const auto& [channel, bitOffset] : formatInfo.Samples) {
+			put(bitOffset, 2);
+			put(sampleBits - 1, 1);
+			put(channel, 1);
+			put(0, 4);                      // Sample position
+			put(0, 4);                      // Lower
+			put(0xFFFFFFFF, 4);             // Upper
+		}
+		return descriptor;
+	}
+
+	namespace KTX2File {
+
+		bool Write(const std::filesystem::path& path, const CompressedImage& image) {
+			const FormatInfo& formatInfo = *std::ranges::find(s_Formats, image.Format, &FormatInfo::Format);
+			std::vector<std::uint8_t> descriptor = BuildDataFormatDescriptor(formatInfo);
+
+			std::uint32_t levelCount = static_cast<std::uint32_t>(image.Levels.size());
+			KTX2Header header{
+				.VkFormat = formatInfo.VkFormat,
+				.TypeSize = 1,
+				.PixelWidth = static_cast<std::uint32_t>(image.Width),
+				.PixelHeight = static_cast<std::uint32_t>(image.Height),
+				.PixelDepth = 0,
+				.LayerCount = 0,
+				.FaceCount = 1,
+				.LevelCount = levelCount,
+				.SupercompressionScheme = 0,
+				.DFDByteOffset = static_cast<std::uint32_t>(s_Identifier.size() + sizeof(KTX2Header) + levelCount * sizeof(KTX2Level)),
+				.DFDByteLength = static_cast<std::uint32_t>(descriptor.size()),
+				.KVDByteOffset = 0,
+				.KVDByteLength = 0,
+				.SGDByteOffset = 0,
+				.SGDByteLength = 0
+			};
+
+			// Level data is stored smallest first, each aligned to the block size
+			std::size_t alignment = BlockCompression::GetBlockSize(image.Format);
+			std::vector<KTX2Level> levels(levelCount);
+			std::uint64_t offset = header.DFDByteOffset + header.DFDByteLength;
+			for (std::uint32_t i = levelCount; i-- > 0;) {
+				offset = (offset + alignment - 1) / alignment * alignment;
+				levels[i] = { offset, image.Levels[i].size(), image.Levels[i].size() };
+				offset += image.Levels[i].size();
+			}
+
+			std::filesystem::path tempPath = path;
+			tempPath += ".tmp";
+			{
+				std::ofstream file(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+				if (!file.is_open()) {
+					LoggingAD::Warning("[OORenderer::KTX2File::Write] Failed to open {} for writing", tempPath.string());
+					return false;
+				}
+
+				file.write(reinterpret_cast<const char*>(s_Identifier.data()), s_Identifier.size());
+				file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+				file.write(reinterpret_cast<const char*>(levels.data()), levels.size() * sizeof(KTX2Level));
+				file.write(reinterpret_cast<const char*>(descriptor.data()), descriptor.size());
+				for (std::uint32_t i = levelCount; i-- > 0;) {
+					static constexpr char padding[16] = {};
+					file.write(padding, levels[i].ByteOffset - static_cast<std::uint64_t>(file.tellp()));
+					file.write(reinterpret_cast<const char*>(image.Levels[i].data()), image.Levels[i].size());
+				}
+			}
+
+			std::error_code error;
+			std::filesystem::rename(tempPath, path, error);
+			if (error) {
+				LoggingAD::Warning("[OORenderer::KTX2File::Write] Failed to write {}: {}", path.string(), error.message());
+				return false;
+			}
+			return true;
+		}
+
+		std::optional<CompressedImage> Read(const std::filesystem::path& path) {
+			std::shared_ptr<MappedFile> file = MappedFile::Open(path);
+			if (!file) {
+				return std::nullopt;
+			}
+
+			std::span<const std::byte> data = file->GetData();
+			auto invalid = [&path](const char* reason) -> std::optional<CompressedImage> {
+				LoggingAD::Warning("[OORenderer::KTX2File::Read] Ignoring {}: {}", path.string(), reason);
+				return std::nullopt;
+			};
+
+			if (data.size() < s_Identifier.size() + sizeof(KTX2Header) || std::memcmp(data.data(), s_Identifier.data(), s_Identifier.size()) != 0) {
+				return invalid("not a KTX2 file");
+			}
+
+			KTX2Header header;
+			std::memcpy(&header, data.data() + s_Identifier.size(), sizeof(header));
+
+			auto formatIt = std::ranges::find(s_Formats, header.VkFormat, &FormatInfo::VkFormat);
+			if (formatIt == s_Formats.end()) {
+				return invalid("unsupported format");
+			}
+			if (header.PixelWidth == 0 || header.PixelHeight == 0 || header.PixelDepth != 0 || header.LayerCount != 0 || header.FaceCount != 1
+				|| header.LevelCount == 0 || header.LevelCount > 32 || header.SupercompressionScheme != 0) {
+				return invalid("not a plain 2D texture");
+			}
+
+			std::size_t levelIndexOffset = s_Identifier.size() + sizeof(KTX2Header);
+			if (data.size() < levelIndexOffset + header.LevelCount * sizeof(KTX2Level)) {
+				return invalid("truncated level index");
+			}
+
+			CompressedImage image{ .Format = formatIt->Format, .Width = static_cast<int>(header.PixelWidth), .Height = static_cast<int>(header.PixelHeight), .Backing = file, .Levels = {} };
+			for (std::uint32_t i = 0; i < header.LevelCount; ++i) {
+				KTX2Level level;
+				std::memcpy(&level, data.data() + levelIndexOffset + i * sizeof(KTX2Level), sizeof(level));
+
+				if (level.ByteLength != GetLevelSize(image.Format, header.PixelWidth, header.PixelHeight, i)
+					|| level.ByteOffset > data.size() || level.ByteLength > data.size() - level.ByteOffset) {
+					return invalid("level data out of bounds");
+				}
+				image.Levels.push_back(data.subspan(level.ByteOffset, level.ByteLength));
+			}
+
+			return image;
+		}
+
+	} // KTX2File
+
+} // OORenderer
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+
+#include "BlockCompression.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// Minimal KTX2 container support for block compressed 2D textures with mips, no supercompression
+	/// </summary>
+	namespace KTX2File {
+
+		/// <summary>
+		/// Write a compressed image, through a temporary file so a partial write is never picked up
+		/// </summary>
+		/// <returns>True on success</returns>
+		bool Write(const std::filesystem::path& path, const CompressedImage& image);
+
+		/// <summary>
+		/// Map and validate a KTX2 file holding a format we can upload
+		/// </summary>
+		/// <returns>The image viewing into the mapping, nothing if missing or not something we can use</returns>
+		std::optional<CompressedImage> Read(const std::filesystem::path& path);
+
+	} // KTX2File
+
+} // OORenderer
@@ -0,0 +1,93 @@
+#include "MappedFile.h"
+
+#include <LoggingAD/LoggingAD.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace OORenderer {
+
+	std::shared_ptr<MappedFile> MappedFile::Open(const std::filesystem::path& path) {
+		std::shared_ptr<MappedFile> mappedFile{ new MappedFile() };
+
+#ifdef _WIN32
+		HANDLE fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (fileHandle == INVALID_HANDLE_VALUE) {
+			return nullptr;
+		}
+		mappedFile->m_FileHandle = fileHandle;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+			return nullptr;
+		}
+		mappedFile->m_Size = static_cast<std::size_t>(fileSize.QuadPart);
+
+		HANDLE mappingHandle = CreateFileMappingW(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (!mappingHandle) {
+			return nullptr;
+		}
+		mappedFile->m_MappingHandle = mappingHandle;
+
+		mappedFile->m_Data = static_cast<const std::byte*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+#else
+		int fileDescriptor = open(path.c_str(), O_RDONLY);
+		if (fileDescriptor < 0) {
+			return nullptr;
+		}
+
+		struct stat fileStat;
+		if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size == 0) {
+			close(fileDescriptor);
+			return nullptr;
+		}
+		mappedFile->m_Size = static_cast<std::size_t>(fileStat.st_size);
+
+		// The mapping keeps the file alive, we needn't hold the descriptor
+		void* data = mmap(nullptr, mappedFile->m_Size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		close(fileDescriptor);
+		if (data == MAP_FAILED) {
+			return nullptr;
+		}
+		mappedFile->m_Data = static_cast<const std::byte*>(data);
+#endif
+
+		if (!mappedFile->m_Data) {
+			LoggingAD::Warning("[OORenderer::MappedFile] Failed to map file {}", path.string());
+			return nullptr;
+		}
+
+		return mappedFile;
+	}
+
+	MappedFile::~MappedFile() {
+#ifdef _WIN32
+		if (m_Data) {
+			UnmapViewOfFile(m_Data);
+		}
+		if (m_MappingHandle) {
+			CloseHandle(m_MappingHandle);
+		}
+		if (m_FileHandle) {
+			CloseHandle(m_FileHandle);
+		}
+#else
+		if (m_Data) {
+			munmap(const_cast<std::byte*>(m_Data), m_Size);
+		}
+#endif
+	}
+
+	std::span<const std::byte> MappedFile::GetData() const {
+		return { m_Data, m_Size };
+	}
+
+} // OORenderer
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+namespace OORenderer {
+
+	/// <summary>
+	/// A read only memory mapping of a whole file, unmapped on destruction
+	/// </summary>
+	class MappedFile {
+	public: // Public static methods
+
+		/// <summary>
+		/// Map a file into memory
+		/// </summary>
+		/// <param name="path">Path of file to map</param>
+		/// <returns>The mapping, nullptr if the file couldn't be opened or mapped</returns>
+		static std::shared_ptr<MappedFile> Open(const std::filesystem::path& path);
+
+	public: // Public methods
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/// <summary>
+		/// Get the mapped contents of the file
+		/// </summary>
+		/// <returns>View of the whole file</returns>
+		std::span<const std::byte> GetData() const;
+
+	private: // Private methods
+		MappedFile() = default;
+
+	private: // Private members
+		const std::byte* m_Data = nullptr;
+		std::size_t m_Size = 0;
+
+#ifdef _WIN32
+		void* m_FileHandle = nullptr;
+		void* m_MappingHandle = nullptr;
+#endif
+	};
+
+} // OORenderer
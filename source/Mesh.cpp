@@ -2,30 +2,82 @@
 #include "OORenderer/Mesh.h"
 
 #include <iostream>
+#include <limits>
+#include <algorithm>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <LoggingAD/LoggingAD.h>
 
 #include "OORenderer/Window.h"
+#include "OORenderer/Profiler.h"
+#include "OORenderer/GLStateCache.h"
 
 namespace OORenderer {
 
-    Mesh::Mesh(std::vector<Vertex> vertexData, std::vector<unsigned int> indices, std::map<std::string, std::shared_ptr<Texture>> textureBindingMap)
-	    : m_VertexData(vertexData), m_Indices(indices), m_TextureBindingMap(textureBindingMap)
+    using namespace Literals;
+
+    struct Mesh::OwnedData {
+        std::vector<Vertex> VertexData;
+        std::vector<unsigned int> Indices;
+    };
+
+    Mesh::Mesh(std::vector<Vertex> vertexData, std::vector<unsigned int> indices, std::map<std::string, std::shared_ptr<Texture>> textureBindingMap, std::vector<LODLevel> lodLevels)
+        : Mesh(std::make_shared<const OwnedData>(std::move(vertexData), std::move(indices)), textureBindingMap, std::move(lodLevels))
     {}
 
+    Mesh::Mesh(std::shared_ptr<const OwnedData> ownedData, std::map<std::string, std::shared_ptr<Texture>> textureBindingMap, std::vector<LODLevel> lodLevels)
+        : Mesh(ownedData, ownedData->VertexData, ownedData->Indices, textureBindingMap, std::move(lodLevels))
+    {}
+
+    Mesh::Mesh(std::shared_ptr<const void> dataBacking, std::span<const Vertex> vertexData, std::span<const unsigned int> indices, std::map<std::string, std::shared_ptr<Texture>> textureBindingMap, std::vector<LODLevel> lodLevels)
+        : m_LODLevels(std::move(lodLevels)), m_TextureBindingMap(textureBindingMap)
+    {
+        SetData(dataBacking, vertexData, indices);
+        m_VertexCount = vertexData.size();
+        m_IndexCount = indices.size();
+        m_Bounds = Bounds::Of(vertexData);
+        m_PositionBounds = { m_Bounds.Box.Min, m_Bounds.Box.Max };
+
+        if (m_LODLevels.empty()) {
+            m_LODLevels.push_back({ 0, static_cast<std::uint32_t>(m_IndexCount), 0.0f });
+        }
+
+        // Every index is below the vertex count
+        m_IndexType = m_VertexCount <= std::numeric_limits<std::uint16_t>::max() + 1 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+        m_TextureBindingIDs.reserve(m_TextureBindingMap.size());
+        m_TextureLayerIDs.reserve(m_TextureBindingMap.size());
+        for (const auto& [bindingName, texture] : m_TextureBindingMap) {
+            m_TextureBindingIDs.push_back(ShaderProgram::HashUniformName(bindingName));
+            m_TextureLayerIDs.push_back(ShaderProgram::HashUniformName(bindingName + "Layer"));
+        }
+    }
+
     Mesh::Mesh(const Window& window, std::vector<Vertex> vertexData, std::vector<unsigned int> indices, std::map<std::string, std::shared_ptr<Texture>> textureBindingMap)
-        : Mesh(vertexData, indices, textureBindingMap)
+        : Mesh(std::move(vertexData), std::move(indices), textureBindingMap)
     {
         RegisterOnWindow(window);
     }
 
-    void Mesh::Render(ShaderProgram& shader) const {
+    void Mesh::Render(ShaderProgram& shader, std::size_t lodLevel) const {
+        if (shader.IsInstanced()) {
+            LoggingAD::Warning("[OORenderer::Mesh::Render] Shader reads its model matrix per instance, pass the model matrix to render with it.");
+            return;
+        }
+        RenderWithModelMatrix(shader, nullptr, lodLevel);
+    }
+
+    void Mesh::Render(ShaderProgram& shader, const glm::mat4& modelMatrix, std::size_t lodLevel) const {
+        RenderWithModelMatrix(shader, &modelMatrix, lodLevel);
+    }
+
+    void Mesh::RenderWithModelMatrix(ShaderProgram& shader, const glm::mat4* modelMatrix, std::size_t lodLevel) const {
+        OORENDERER_PROFILE_SCOPE("Mesh::Render");
 
         GLFWwindow* renderWindow = shader.GetGLFWWindow();
 
-        auto VAOIDIt = m_WindowVAOIDMap.find(renderWindow);
-        if (VAOIDIt == m_WindowVAOIDMap.end()) {
+        unsigned int VAOID = GetVAOID(renderWindow);
+        if (VAOID == 0) {
             LoggingAD::Warning("[OORenderer::Mesh::Render] Attempting to render mesh using shader registered to a window this mesh hasn't been loaded to.");
             return;
         }
@@ -33,67 +85,340 @@ namespace OORenderer {
         GLFWwindow* oldContext = glfwGetCurrentContext();
         Window::ActivateGLFWWindow(renderWindow);
 
-        // Bind textures
+        BindTextures(shader);
+        SetMeshUniforms(shader);
+
+        if (modelMatrix && shader.IsInstanced()) {
+            // Instance attributes are disabled outside of queued batches, so read these current values for every vertex
+            for (GLuint column = 0; column < 4; ++column) {
+                glVertexAttrib4fv(ShaderProgram::InstanceMatrixLocation + column, glm::value_ptr((*modelMatrix)[column]));
+            }
+            glm::uvec4 textureLayers = GetTextureLayers(renderWindow);
+            glVertexAttribI4ui(ShaderProgram::InstanceTextureLayersLocation, textureLayers.x, textureLayers.y, textureLayers.z, textureLayers.w);
+        }
+        else if (modelMatrix) {
+            shader.SetUniformMatrix4fv(shader.GetUniform("modelMatrix"_uniform), *modelMatrix);
+        }
+
+        GLStateCache::Current().BindVertexArray(VAOID);
+        Draw(renderWindow, lodLevel);
+
+        // Revert context
+        Window::ActivateGLFWWindow(oldContext);
+    }
+
+    void Mesh::EnableGeometryPooling() {
+        sm_PoolGeometry = true;
+    }
+
+    void Mesh::DisableGeometryPooling() {
+        sm_PoolGeometry = false;
+    }
+
+    unsigned int Mesh::GetVAOID(GLFWwindow* window) const {
+        auto VAOIDIt = m_WindowVAOIDMap.find(window);
+        return VAOIDIt == m_WindowVAOIDMap.end() ? 0 : VAOIDIt->second;
+    }
+
+    void Mesh::BindTextures(ShaderProgram& shader) const {
+        GLFWwindow* renderWindow = shader.GetGLFWWindow();
+        GLStateCache& state = GLStateCache::Current();
+
         int i = 0;
         for (const auto& [bindingName, texture] : m_TextureBindingMap) {
-            glActiveTexture(GL_TEXTURE0 + i);
-            shader.SetUniform1i(bindingName.c_str(), i);
-            glBindTexture(GL_TEXTURE_2D, texture->GetTextureID());
+            shader.SetUniform1i(shader.GetUniform(m_TextureBindingIDs[i]), i);
+            if (const TextureArrayPool::Slot* slot = texture->GetArraySlot(renderWindow)) {
+                state.BindTexture(i, GL_TEXTURE_2D_ARRAY, slot->PoolArray->TextureID);
+                state.BindSampler(i, slot->Sampler);
+                TextureArrayPool::PrepareForSampling(*slot->PoolArray);
+            }
+            else {
+                // Textures of their own sample with their own parameters
+                state.BindTexture(i, GL_TEXTURE_2D, texture->GetTextureID(renderWindow));
+                state.BindSampler(i, 0);
+            }
             ++i;
         }
-        glActiveTexture(GL_TEXTURE0);
+    }
 
-        // Submit the mesh to be drawn
-        glBindVertexArray(VAOIDIt->second);
-        glDrawElements(GL_TRIANGLES, m_Indices.size(), GL_UNSIGNED_INT, 0);
-        glBindVertexArray(0);
+    void Mesh::SetMeshUniforms(ShaderProgram& shader) const {
+        // Layers differ between meshes sharing arrays, so are set every draw rather than with the textures
+        GLFWwindow* renderWindow = shader.GetGLFWWindow();
+        int i = 0;
+        for (const auto& [bindingName, texture] : m_TextureBindingMap) {
+            if (const TextureArrayPool::Slot* slot = texture->GetArraySlot(renderWindow)) {
+                ShaderProgram::Uniform layerUniform = shader.GetUniform(m_TextureLayerIDs[i]);
+                if (layerUniform.IsValid()) {
+                    shader.SetUniform1i(layerUniform, slot->Layer);
+                }
+            }
+            ++i;
+        }
 
-        // Revert context
-        Window::ActivateGLFWWindow(oldContext);
+        if (m_VertexLayout->QuantizesPositions) {
+            using namespace Literals;
+            ShaderProgram::Uniform dequantizationUniform = shader.GetUniform("positionDequantization"_uniform);
+            if (dequantizationUniform.IsValid()) {
+                shader.SetUniformMatrix4fv(dequantizationUniform, GetPositionDequantization());
+            }
+        }
+    }
+
+    Mesh::DrawRange Mesh::GetDrawRange(GLFWwindow* window, std::size_t lodLevel) const {
+        // Levels of detail are ranges of the one index buffer
+        const LODLevel& level = m_LODLevels[std::min(lodLevel, m_LODLevels.size() - 1)];
+        DrawRange range{ static_cast<GLsizei>(level.IndexCount), level.FirstIndex, 0 };
+
+        if (!m_WindowPoolRanges.empty()) {
+            auto poolRangeIt = m_WindowPoolRanges.find(window);
+            if (poolRangeIt != m_WindowPoolRanges.end()) {
+                range.FirstIndex += poolRangeIt->second.FirstIndex;
+                range.BaseVertex = static_cast<GLint>(poolRangeIt->second.BaseVertex);
+            }
+        }
+        return range;
+    }
+
+    bool Mesh::IsPooledOn(GLFWwindow* window) const {
+        return m_WindowPoolRanges.contains(window);
+    }
+
+    std::uint64_t Mesh::GetMaterialKey(GLFWwindow* window) const {
+        std::uint64_t materialKey = FNV1a64OffsetBasis;
+        int i = 0;
+        for (const auto& [bindingName, texture] : m_TextureBindingMap) {
+            const TextureArrayPool::Slot* slot = texture->GetArraySlot(window);
+            const void* bound = slot ? static_cast<const void*>(slot->PoolArray) : static_cast<const void*>(texture.get());
+            GLuint sampler = slot ? slot->Sampler : 0;
+            materialKey = HashFNV1a64(&m_TextureBindingIDs[i], sizeof(ShaderProgram::UniformID), materialKey);
+            materialKey = HashFNV1a64(&bound, sizeof(bound), materialKey);
+            materialKey = HashFNV1a64(&sampler, sizeof(sampler), materialKey);
+            ++i;
+        }
+        return materialKey;
+    }
+
+    glm::uvec4 Mesh::GetTextureLayers(GLFWwindow* window) const {
+        glm::uvec4 layers{ 0 };
+        int i = 0;
+        for (const auto& [bindingName, texture] : m_TextureBindingMap) {
+            if (i == 4) {
+                break;
+            }
+            if (const TextureArrayPool::Slot* slot = texture->GetArraySlot(window)) {
+                layers[i] = static_cast<unsigned int>(slot->Layer);
+            }
+            ++i;
+        }
+        return layers;
+    }
+
+    void Mesh::Draw(GLFWwindow* window, std::size_t lodLevel, GLsizei instanceCount) const {
+        DrawRange range = GetDrawRange(window, lodLevel);
+        std::size_t indexSize = m_IndexType == GL_UNSIGNED_SHORT ? sizeof(std::uint16_t) : sizeof(std::uint32_t);
+        void* indexOffset = (void*)(range.FirstIndex * indexSize);
+
+        if (range.BaseVertex != 0) {
+            glDrawElementsInstancedBaseVertex(GL_TRIANGLES, range.IndexCount, m_IndexType, indexOffset, instanceCount, range.BaseVertex);
+        }
+        else if (instanceCount == 1) {
+            glDrawElements(GL_TRIANGLES, range.IndexCount, m_IndexType, indexOffset);
+        }
+        else {
+            glDrawElementsInstanced(GL_TRIANGLES, range.IndexCount, m_IndexType, indexOffset, instanceCount);
+        }
     }
 
     void Mesh::RegisterOnGLFWWindow(GLFWwindow* window) {
+        if (m_WindowVAOIDMap.contains(window)) {
+            return;
+        }
+
+        const ShareGroup* shareGroup = ShareGroup::Of(window);
+        if (!shareGroup) {
+            LoggingAD::Error("[OORenderer::Mesh::Register] Meshes may only be registered on windows created by a Window.");
+            return;
+        }
+
+        if (NeedsDataFor(window) && !IsDataResident()) {
+            LoggingAD::Error("[OORenderer::Mesh::Register] Mesh data was dropped after upload, it can't be registered on a new share group.");
+            return;
+        }
+
         // Mesh is a OpenGL object so needs to be bound on the correct window
         GLFWwindow* oldContext = glfwGetCurrentContext();
         Window::ActivateGLFWWindow(window);
 
-        unsigned int VAOID;
+        // Buffers are shared across the group, so only the first window of a group uploads anything
+        auto [groupBuffersIt, firstInGroup] = m_GroupBuffers.try_emplace(shareGroup->GetID());
+        GroupBuffers& buffers = groupBuffersIt->second;
+        std::size_t indexSize = m_IndexType == GL_UNSIGNED_SHORT ? sizeof(std::uint16_t) : sizeof(std::uint32_t);
+        if (firstInGroup && sm_PoolGeometry) {
+            buffers.Pooled = GeometryPool::Allocate(window, *m_VertexLayout, m_IndexType, m_VertexCount, m_IndexCount);
+            UploadData(buffers.Pooled.PoolBlock->VBO, buffers.Pooled.BaseVertex, buffers.Pooled.PoolBlock->EBO, buffers.Pooled.FirstIndex);
+        }
+        else if (firstInGroup) {
+            glGenBuffers(1, &buffers.VBO);
+            glGenBuffers(1, &buffers.EBO);
+            buffers.Tracking = Residency::Track(Residency::Asset::Mesh, shareGroup, m_VertexCount * m_VertexLayout->Stride + m_IndexCount * indexSize);
 
-        glGenVertexArrays(1, &VAOID);
+            GLStateCache& state = GLStateCache::Current();
+            state.BindBuffer(GL_COPY_WRITE_BUFFER, buffers.VBO);
+            glBufferData(GL_COPY_WRITE_BUFFER, m_VertexCount * m_VertexLayout->Stride, NULL, GL_STATIC_DRAW);
+            state.BindBuffer(GL_COPY_WRITE_BUFFER, buffers.EBO);
+            glBufferData(GL_COPY_WRITE_BUFFER, m_IndexCount * indexSize, NULL, GL_STATIC_DRAW);
+            UploadData(buffers.VBO, 0, buffers.EBO, 0);
+        }
 
-        unsigned int VBO, EBO;
-        glGenBuffers(1, &VBO);
-        glGenBuffers(1, &EBO);
+        // Pooled meshes share their block's VAO
+        if (buffers.Pooled.PoolBlock) {
+            m_WindowVAOIDMap[window] = GeometryPool::GetVAOID(*buffers.Pooled.PoolBlock, window);
+            m_WindowPoolRanges[window] = buffers.Pooled;
+        }
+        else {
+            // VAOs are containers so never shared, each window needs its own
+            unsigned int VAOID;
 
-        glBindVertexArray(VAOID);
-        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+            glGenVertexArrays(1, &VAOID);
 
-        glBufferData(GL_ARRAY_BUFFER, m_VertexData.size() * sizeof(Vertex), &m_VertexData[0], GL_STATIC_DRAW);
+            GLStateCache& state = GLStateCache::Current();
+            state.BindVertexArray(VAOID);
+            state.BindBuffer(GL_ARRAY_BUFFER, buffers.VBO);
+            state.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers.EBO);
 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_Indices.size() * sizeof(unsigned int), &m_Indices[0], GL_STATIC_DRAW);
+            // Positions, normals, then tex coords
+            for (const VertexLayoutDescription::Attribute& attribute : m_VertexLayout->Attributes) {
+                glEnableVertexAttribArray(attribute.Location);
+                glVertexAttribPointer(attribute.Location, attribute.Components, attribute.Type, attribute.Normalized, m_VertexLayout->Stride, (void*)attribute.Offset);
+            }
 
-        // Positions
-        glEnableVertexAttribArray(0);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Position));
+            m_WindowVAOIDMap[window] = VAOID;
+        }
 
-        // Normals
-        glEnableVertexAttribArray(1);
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Normal));
+        Window::ActivateGLFWWindow(oldContext);
 
-        // Tex Coords
-        glEnableVertexAttribArray(2);
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
+        if (firstInGroup && GetResidencyPolicy() != ResidencyPolicy::Keep) {
+            DropData();
+        }
+    }
 
-        glBindVertexArray(0);
+    void Mesh::RegisterOnWindow(const Window& window) {
+        RegisterOnGLFWWindow(window.GetGLFWWindow());
+    }
 
-        m_WindowVAOIDMap[window] = VAOID;
+    std::span<const Mesh::Vertex> Mesh::GetVertexData() const {
+        return m_VertexData;
+    }
 
-        Window::ActivateGLFWWindow(oldContext);
+    std::span<const unsigned int> Mesh::GetIndices() const {
+        return m_Indices;
     }
 
-    void Mesh::RegisterOnWindow(const Window& window) {
-        RegisterOnGLFWWindow(window.GetGLFWWindow());
+    const std::map<std::string, std::shared_ptr<Texture>>& Mesh::GetTextureBindingMap() const {
+        return m_TextureBindingMap;
+    }
+
+    const std::vector<Mesh::LODLevel>& Mesh::GetLODLevels() const {
+        return m_LODLevels;
+    }
+
+    void Mesh::SetResidencyPolicy(ResidencyPolicy policy) {
+        m_ResidencyPolicy = policy;
+
+        // Already uploaded somewhere, nothing more to wait for
+        if (policy != ResidencyPolicy::Keep && !m_GroupBuffers.empty()) {
+            DropData();
+        }
+    }
+
+    ResidencyPolicy Mesh::GetResidencyPolicy() const {
+        return m_ResidencyPolicy.value_or(Residency::GetDefaultPolicy());
+    }
+
+    bool Mesh::IsDataResident() const {
+        return m_DataBacking != nullptr;
+    }
+
+    bool Mesh::NeedsDataFor(GLFWwindow* window) const {
+        const ShareGroup* shareGroup = ShareGroup::Of(window);
+        return !shareGroup || !m_GroupBuffers.contains(shareGroup->GetID());
+    }
+
+    void Mesh::SetVertexLayout(const VertexLayoutDescription& layout) {
+        if (!m_GroupBuffers.empty()) {
+            LoggingAD::Warning("[OORenderer::Mesh::Layout] Vertex layout must be chosen before registering on a window, ignoring.");
+            return;
+        }
+        m_VertexLayout = &layout;
+    }
+
+    const Bounds& Mesh::GetBounds() const {
+        return m_Bounds;
+    }
+
+    const PositionBounds& Mesh::GetPositionBounds() const {
+        return m_PositionBounds;
+    }
+
+    glm::mat4 Mesh::GetPositionDequantization() const {
+        if (!m_VertexLayout->QuantizesPositions) {
+            return glm::mat4{ 1.0f };
+        }
+
+        // Scale [0, 1] up to the bounds, then move to their minimum
+        glm::mat4 dequantization{ 1.0f };
+        dequantization[0][0] = m_PositionBounds.Max.x - m_PositionBounds.Min.x;
+        dequantization[1][1] = m_PositionBounds.Max.y - m_PositionBounds.Min.y;
+        dequantization[2][2] = m_PositionBounds.Max.z - m_PositionBounds.Min.z;
+        dequantization[3] = glm::vec4{ m_PositionBounds.Min, 1.0f };
+        return dequantization;
+    }
+
+    void Mesh::RestoreData(std::shared_ptr<const void> dataBacking, std::span<const Vertex> vertexData, std::span<const unsigned int> indices) {
+        if (vertexData.size() != m_VertexCount || indices.size() != m_IndexCount) {
+            LoggingAD::Error("[OORenderer::Mesh::Restore] Restored data doesn't match the mesh, expected {} vertices and {} indices, got {} and {}.",
+                m_VertexCount, m_IndexCount, vertexData.size(), indices.size());
+            return;
+        }
+        SetData(dataBacking, vertexData, indices);
+    }
+
+    void Mesh::SetData(std::shared_ptr<const void> dataBacking, std::span<const Vertex> vertexData, std::span<const unsigned int> indices) {
+        m_DataBacking = dataBacking;
+        m_VertexData = vertexData;
+        m_Indices = indices;
+        m_DataTracking = Residency::Track(Residency::Asset::Mesh, nullptr, vertexData.size_bytes() + indices.size_bytes());
+    }
+
+    void Mesh::UploadData(unsigned int VBO, std::size_t baseVertex, unsigned int EBO, std::size_t firstIndex) const {
+        // Through the copy target, as the element array binding belongs to whatever VAO is bound
+        GLStateCache& state = GLStateCache::Current();
+        state.BindBuffer(GL_COPY_WRITE_BUFFER, VBO);
+        std::size_t vertexOffset = baseVertex * m_VertexLayout->Stride;
+        if (m_VertexLayout == &StandardVertexLayout::Describe()) {
+            glBufferSubData(GL_COPY_WRITE_BUFFER, vertexOffset, m_VertexData.size_bytes(), m_VertexData.data());
+        }
+        else {
+            std::vector<std::byte> encodedVertices(m_VertexData.size() * m_VertexLayout->Stride);
+            m_VertexLayout->Encode(m_VertexData, m_PositionBounds, encodedVertices.data());
+            glBufferSubData(GL_COPY_WRITE_BUFFER, vertexOffset, encodedVertices.size(), encodedVertices.data());
+        }
+
+        state.BindBuffer(GL_COPY_WRITE_BUFFER, EBO);
+        if (m_IndexType == GL_UNSIGNED_SHORT) {
+            std::vector<std::uint16_t> shortIndices(m_Indices.begin(), m_Indices.end());
+            glBufferSubData(GL_COPY_WRITE_BUFFER, firstIndex * sizeof(std::uint16_t), shortIndices.size() * sizeof(std::uint16_t), shortIndices.data());
+        }
+        else {
+            glBufferSubData(GL_COPY_WRITE_BUFFER, firstIndex * sizeof(std::uint32_t), m_Indices.size_bytes(), m_Indices.data());
+        }
+    }
+
+    void Mesh::DropData() {
+        m_DataBacking.reset();
+        m_VertexData = {};
+        m_Indices = {};
+        m_DataTracking.reset();
     }
 
 } // OORenderer
@@ -0,0 +1,459 @@
+#include "MeshCache.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <LoggingAD/LoggingAD.h>
+
+#include "OORenderer/Hash.h"
+
+namespace OORenderer {
+
+	// Bump if the file layout or Mesh::Vertex changes, old files then fail validation and are rebuilt
+	static constexpr std::uint32_t s_FileMagic = 0x4F4F4D43; // "OOMC"
+	static constexpr std::uint32_t s_FileVersion = 3;
+
+	// Blobs are aligned so views into the mapping are suitably aligned for their element type
+	static constexpr std::size_t s_BlobAlignment = 16;
+
+	struct MeshCacheHeader {
+		std::uint32_t Magic;
+		std::uint32_t Version;
+		std::uint32_t VertexStride;
+		std::uint32_t MeshCount;
+		std::uint64_t FileSize;
+
+		// Stamp of the source file and the material libraries it names, total size and combined write times are a cheap check,
+		// the hash of their contents catches touched but unchanged files
+		std::uint64_t SourceSize;
+		std::uint64_t SourceWriteTimes;
+		std::uint64_t SourceHash;
+
+		// Material libraries the source file names, so their stamp may be checked without parsing it again
+		std::uint64_t MaterialLibraryTableOffset;
+		std::uint64_t MaterialLibraryCount;
+
+		std::uint64_t MeshTableOffset;
+		std::uint64_t BindingTableOffset;
+		std::uint32_t BindingCount;
+		std::uint32_t LODCount;
+		std::uint64_t LODTableOffset;
+		std::uint64_t StringTableOffset;
+		std::uint64_t StringTableSize;
+
+		// Import options the meshes were produced with
+		std::uint64_t ImportKey;
+	};
+
+	struct MeshCacheMeshRecord {
+		std::uint64_t VertexOffset;
+		std::uint64_t VertexCount;
+		std::uint64_t IndexOffset;
+		std::uint64_t IndexCount;
+		std::uint32_t FirstBinding;
+		std::uint32_t BindingCount;
+		std::uint32_t FirstLOD;
+		std::uint32_t LODCount;
+	};
+
+	struct MeshCacheLODRecord {
+		std::uint32_t FirstIndex;
+		std::uint32_t IndexCount;
+		float Error;
+	};
+
+	struct MeshCacheBindingRecord {
+		std::uint32_t NameOffset;
+		std::uint32_t NameLength;
+		std::uint32_t PathOffset;
+		std::uint32_t PathLength;
+	};
+
+	struct MeshCacheMaterialLibraryRecord {
+		std::uint32_t PathOffset;
+		std::uint32_t PathLength;
+	};
+
+	struct SourceStamp {
+		std::uint64_t Size = 0;
+		std::uint64_t WriteTimes = FNV1a64OffsetBasis;
+	};
+
+	// Material libraries named by a Wavefront .obj, other formats keep their materials in the model file itself
+	static std::vector<std::filesystem::path> FindMaterialLibraries(const std::filesystem::path& sourcePath) {
+		std::vector<std::filesystem::path> materialLibraries;
+
+		std::string extension = sourcePath.extension().string();
+		std::ranges::transform(extension, extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		if (extension != ".obj") {
+			return materialLibraries;
+		}
+
+		auto isSpace = [](unsigned char c) { return std::isspace(c) != 0; };
+		std::ifstream file(sourcePath);
+		std::string line;
+		while (std::getline(file, line)) {
+			std::string_view statement = line;
+			while (!statement.empty() && isSpace(statement.front())) {
+				statement.remove_prefix(1);
+			}
+			if (!statement.starts_with("mtllib") || statement.size() == 6 || !isSpace(statement[6])) {
+				continue;
+			}
+
+			// The rest of the line is the library's path, relative to the model
+			statement.remove_prefix(6);
+			while (!statement.empty() && isSpace(statement.front())) {
+				statement.remove_prefix(1);
+			}
+			while (!statement.empty() && isSpace(statement.back())) {
+				statement.remove_suffix(1);
+			}
+			if (!statement.empty()) {
+				materialLibraries.push_back(sourcePath.parent_path() / std::string(statement));
+			}
+		}
+		return materialLibraries;
+	}
+
+	// Missing material libraries are stamped as such, so one appearing makes the cache stale
+	static std::optional<SourceStamp> StampSourceFiles(const std::filesystem::path& sourcePath, const std::vector<std::filesystem::path>& materialLibraries) {
+		SourceStamp stamp;
+		auto addFile = [&stamp](const std::filesystem::path& path) {
+			std::error_code error;
+			std::uint64_t size = std::filesystem::file_size(path, error);
+			std::int64_t writeTime = 0;
+			if (!error) {
+				writeTime = std::filesystem::last_write_time(path, error).time_since_epoch().count();
+			}
+			if (error) {
+				size = 0;
+				writeTime = -1;
+			}
+			stamp.Size += size;
+			stamp.WriteTimes = HashFNV1a64(&writeTime, sizeof(writeTime), stamp.WriteTimes);
+			return !error;
+		};
+
+		if (!addFile(sourcePath)) {
+			return std::nullopt;
+		}
+		for (const std::filesystem::path& materialLibrary : materialLibraries) {
+			addFile(materialLibrary);
+		}
+		return stamp;
+	}
+
+	static std::size_t AlignBlobOffset(std::size_t offset) {
+		return (offset + s_BlobAlignment - 1) / s_BlobAlignment * s_BlobAlignment;
+	}
+
+	void MeshCache::Enable(std::filesystem::path directory) {
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+		if (error) {
+			LoggingAD::Error("[OORenderer::MeshCache] Failed to create cache directory {}: {}", directory.string(), error.message());
+			return;
+		}
+
+		LoggingAD::Trace("[OORenderer::MeshCache] Caching imported models in {}", directory.string());
+		sm_Directory = directory;
+	}
+
+	void MeshCache::Disable() {
+		sm_Directory.reset();
+	}
+
+	bool MeshCache::IsEnabled() {
+		return sm_Directory.has_value();
+	}
+
+	std::optional<MeshCache::CachedModel> MeshCache::Load(const std::filesystem::path& sourcePath, std::uint64_t importKey) {
+		if (!sm_Directory) {
+			return std::nullopt;
+		}
+
+		std::shared_ptr<MappedFile> file = MappedFile::Open(PathForSource(sourcePath));
+		if (!file) {
+			return std::nullopt;
+		}
+
+		std::span<const std::byte> data = file->GetData();
+		auto invalid = [&sourcePath](const char* reason) -> std::optional<CachedModel> {
+			LoggingAD::Warning("[OORenderer::MeshCache::Load] Ignoring cache of {}: {}", sourcePath.string(), reason);
+			return std::nullopt;
+		};
+
+		// Validate everything before trusting any offsets
+		if (data.size() < sizeof(MeshCacheHeader)) {
+			return invalid("truncated header");
+		}
+		MeshCacheHeader header;
+		std::memcpy(&header, data.data(), sizeof(header));
+		if (header.Magic != s_FileMagic || header.Version != s_FileVersion || header.VertexStride != sizeof(Mesh::Vertex)) {
+			return invalid("written by a different version");
+		}
+		if (header.FileSize != data.size()) {
+			return invalid("truncated file");
+		}
+
+		if (header.ImportKey != importKey) {
+			LoggingAD::Trace("[OORenderer::MeshCache::Load] Cache of {} was imported with different options.", sourcePath.string());
+			return std::nullopt;
+		}
+
+		auto inBounds = [&data](std::uint64_t offset, std::uint64_t size) {
+			return offset <= data.size() && size <= data.size() - offset;
+		};
+		if (!inBounds(header.MeshTableOffset, header.MeshCount * sizeof(MeshCacheMeshRecord))
+			|| !inBounds(header.BindingTableOffset, header.BindingCount * sizeof(MeshCacheBindingRecord))
+			|| !inBounds(header.LODTableOffset, header.LODCount * sizeof(MeshCacheLODRecord))
+			|| header.MaterialLibraryCount > data.size() / sizeof(MeshCacheMaterialLibraryRecord)
+			|| !inBounds(header.MaterialLibraryTableOffset, header.MaterialLibraryCount * sizeof(MeshCacheMaterialLibraryRecord))
+			|| !inBounds(header.StringTableOffset, header.StringTableSize)) {
+			return invalid("tables out of bounds");
+		}
+
+		const char* strings = reinterpret_cast<const char*>(data.data() + header.StringTableOffset);
+		auto readString = [&](std::uint32_t offset, std::uint32_t length) -> std::optional<std::string> {
+			if (offset > header.StringTableSize || length > header.StringTableSize - offset) {
+				return std::nullopt;
+			}
+			return std::string(strings + offset, length);
+		};
+
+		std::vector<std::filesystem::path> materialLibraries;
+		for (std::uint64_t i = 0; i < header.MaterialLibraryCount; ++i) {
+			MeshCacheMaterialLibraryRecord libraryRecord;
+			std::memcpy(&libraryRecord, data.data() + header.MaterialLibraryTableOffset + i * sizeof(MeshCacheMaterialLibraryRecord), sizeof(libraryRecord));
+			std::optional<std::string> path = readString(libraryRecord.PathOffset, libraryRecord.PathLength);
+			if (!path) {
+				return invalid("material library out of bounds");
+			}
+			materialLibraries.emplace_back(*path);
+		}
+
+		std::optional<SourceStamp> stamp = StampSourceFiles(sourcePath, materialLibraries);
+		if (!stamp) {
+			return invalid("source file unreadable");
+		}
+		if (stamp->Size != header.SourceSize || stamp->WriteTimes != header.SourceWriteTimes) {
+			if (stamp->Size != header.SourceSize || HashSourceContents(sourcePath, materialLibraries) != header.SourceHash) {
+				LoggingAD::Trace("[OORenderer::MeshCache::Load] Cache of {} is stale.", sourcePath.string());
+				return std::nullopt;
+			}
+		}
+
+		CachedModel cachedModel{ .File = file, .Meshes = {} };
+		cachedModel.Meshes.reserve(header.MeshCount);
+		for (std::uint32_t i = 0; i < header.MeshCount; ++i) {
+			MeshCacheMeshRecord meshRecord;
+			std::memcpy(&meshRecord, data.data() + header.MeshTableOffset + i * sizeof(MeshCacheMeshRecord), sizeof(meshRecord));
+
+			if (!inBounds(meshRecord.VertexOffset, meshRecord.VertexCount * sizeof(Mesh::Vertex))
+				|| !inBounds(meshRecord.IndexOffset, meshRecord.IndexCount * sizeof(unsigned int))
+				|| meshRecord.VertexOffset % s_BlobAlignment != 0 || meshRecord.IndexOffset % s_BlobAlignment != 0
+				|| meshRecord.FirstBinding > header.BindingCount || meshRecord.BindingCount > header.BindingCount - meshRecord.FirstBinding
+				|| meshRecord.FirstLOD > header.LODCount || meshRecord.LODCount > header.LODCount - meshRecord.FirstLOD) {
+				return invalid("mesh data out of bounds");
+			}
+
+			MeshEntry& entry = cachedModel.Meshes.emplace_back();
+			entry.VertexData = { reinterpret_cast<const Mesh::Vertex*>(data.data() + meshRecord.VertexOffset), meshRecord.VertexCount };
+			entry.Indices = { reinterpret_cast<const unsigned int*>(data.data() + meshRecord.IndexOffset), meshRecord.IndexCount };
+
+			for (std::uint32_t j = 0; j < meshRecord.LODCount; ++j) {
+				MeshCacheLODRecord lodRecord;
+				std::memcpy(&lodRecord, data.data() + header.LODTableOffset + (meshRecord.FirstLOD + j) * sizeof(MeshCacheLODRecord), sizeof(lodRecord));
+				if (lodRecord.FirstIndex > meshRecord.IndexCount || lodRecord.IndexCount > meshRecord.IndexCount - lodRecord.FirstIndex) {
+					return invalid("level of detail out of bounds");
+				}
+				entry.LODLevels.push_back({ lodRecord.FirstIndex, lodRecord.IndexCount, lodRecord.Error });
+			}
+
+			for (std::uint32_t j = 0; j < meshRecord.BindingCount; ++j) {
+				MeshCacheBindingRecord bindingRecord;
+				std::memcpy(&bindingRecord, data.data() + header.BindingTableOffset + (meshRecord.FirstBinding + j) * sizeof(MeshCacheBindingRecord), sizeof(bindingRecord));
+
+				std::optional<std::string> name = readString(bindingRecord.NameOffset, bindingRecord.NameLength);
+				std::optional<std::string> path = readString(bindingRecord.PathOffset, bindingRecord.PathLength);
+				if (!name || !path) {
+					return invalid("texture binding out of bounds");
+				}
+				entry.TextureBindings.emplace_back(*name, std::filesystem::path{ *path });
+			}
+		}
+
+		LoggingAD::Trace("[OORenderer::MeshCache::Load] Loaded {} meshes for {} from cache.", cachedModel.Meshes.size(), sourcePath.string());
+		return cachedModel;
+	}
+
+	void MeshCache::Store(const std::filesystem::path& sourcePath, const std::vector<Mesh>& meshes, std::uint64_t importKey) {
+		if (!sm_Directory) {
+			return;
+		}
+
+		std::vector<std::filesystem::path> materialLibraries = FindMaterialLibraries(sourcePath);
+		std::optional<SourceStamp> stamp = StampSourceFiles(sourcePath, materialLibraries);
+		if (!stamp) {
+			LoggingAD::Warning("[OORenderer::MeshCache::Store] Failed to stamp cache of {}, source file unreadable", sourcePath.string());
+			return;
+		}
+
+		// Offsets and counts of the tables are filled in as they're laid out
+		MeshCacheHeader header{
+			.Magic = s_FileMagic,
+			.Version = s_FileVersion,
+			.VertexStride = sizeof(Mesh::Vertex),
+			.MeshCount = static_cast<std::uint32_t>(meshes.size()),
+			.FileSize = 0,
+			.SourceSize = stamp->Size,
+			.SourceWriteTimes = stamp->WriteTimes,
+			.SourceHash = HashSourceContents(sourcePath, materialLibraries),
+			.MaterialLibraryTableOffset = 0,
+			.MaterialLibraryCount = materialLibraries.size(),
+			.MeshTableOffset = 0,
+			.BindingTableOffset = 0,
+			.BindingCount = 0,
+			.LODCount = 0,
+			.LODTableOffset = 0,
+			.StringTableOffset = 0,
+			.StringTableSize = 0,
+			.ImportKey = importKey
+		};
+
+		// Lay out the tables and strings
+		std::vector<MeshCacheMeshRecord> meshRecords;
+		std::vector<MeshCacheBindingRecord> bindingRecords;
+		std::vector<MeshCacheLODRecord> lodRecords;
+		std::vector<MeshCacheMaterialLibraryRecord> libraryRecords;
+		std::string stringTable;
+		auto addString = [&stringTable](const std::string& value) {
+			std::uint32_t offset = static_cast<std::uint32_t>(stringTable.size());
+			stringTable += value;
+			return offset;
+		};
+
+		for (const std::filesystem::path& materialLibrary : materialLibraries) {
+			std::string libraryPath = materialLibrary.string();
+			libraryRecords.push_back({
+				.PathOffset = addString(libraryPath),
+				.PathLength = static_cast<std::uint32_t>(libraryPath.size())
+			});
+		}
+
+		for (const Mesh& mesh : meshes) {
+			MeshCacheMeshRecord& meshRecord = meshRecords.emplace_back();
+			meshRecord.VertexCount = mesh.GetVertexData().size();
+			meshRecord.IndexCount = mesh.GetIndices().size();
+			meshRecord.FirstBinding = static_cast<std::uint32_t>(bindingRecords.size());
+			meshRecord.BindingCount = static_cast<std::uint32_t>(mesh.GetTextureBindingMap().size());
+			meshRecord.FirstLOD = static_cast<std::uint32_t>(lodRecords.size());
+			meshRecord.LODCount = static_cast<std::uint32_t>(mesh.GetLODLevels().size());
+
+			for (const Mesh::LODLevel& level : mesh.GetLODLevels()) {
+				lodRecords.push_back({ level.FirstIndex, level.IndexCount, level.Error });
+			}
+
+			for (const auto& [bindingName, texture] : mesh.GetTextureBindingMap()) {
+				std::string texturePath = texture->GetTexturePath().string();
+				bindingRecords.push_back({
+					.NameOffset = addString(bindingName),
+					.NameLength = static_cast<std::uint32_t>(bindingName.size()),
+					.PathOffset = addString(texturePath),
+					.PathLength = static_cast<std::uint32_t>(texturePath.size())
+				});
+			}
+		}
+
+		header.MeshTableOffset = sizeof(MeshCacheHeader);
+		header.BindingTableOffset = header.MeshTableOffset + meshRecords.size() * sizeof(MeshCacheMeshRecord);
+		header.BindingCount = static_cast<std::uint32_t>(bindingRecords.size());
+		header.LODTableOffset = header.BindingTableOffset + bindingRecords.size() * sizeof(MeshCacheBindingRecord);
+		header.LODCount = static_cast<std::uint32_t>(lodRecords.size());
+		header.MaterialLibraryTableOffset = header.LODTableOffset + lodRecords.size() * sizeof(MeshCacheLODRecord);
+		header.StringTableOffset = header.MaterialLibraryTableOffset + libraryRecords.size() * sizeof(MeshCacheMaterialLibraryRecord);
+		header.StringTableSize = stringTable.size();
+
+		// Then the blobs, each aligned
+		std::size_t offset = header.StringTableOffset + header.StringTableSize;
+		for (std::size_t i = 0; i < meshes.size(); ++i) {
+			meshRecords[i].VertexOffset = offset = AlignBlobOffset(offset);
+			offset += meshes[i].GetVertexData().size_bytes();
+			meshRecords[i].IndexOffset = offset = AlignBlobOffset(offset);
+			offset += meshes[i].GetIndices().size_bytes();
+		}
+		header.FileSize = offset;
+
+		// Write then rename so a crash part way never leaves a file that looks complete
+		std::filesystem::path path = PathForSource(sourcePath);
+		std::filesystem::path tempPath = path;
+		tempPath += ".tmp";
+		{
+			std::ofstream file(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!file.is_open()) {
+				LoggingAD::Warning("[OORenderer::MeshCache::Store] Failed to open cache file {} for writing", tempPath.string());
+				return;
+			}
+
+			auto writeAt = [&file](std::uint64_t offset, const void* data, std::size_t size) {
+				// Pad up to the offset, blobs are aligned
+				static constexpr char padding[s_BlobAlignment] = {};
+				file.write(padding, offset - static_cast<std::uint64_t>(file.tellp()));
+				file.write(static_cast<const char*>(data), size);
+			};
+
+			writeAt(0, &header, sizeof(header));
+			writeAt(header.MeshTableOffset, meshRecords.data(), meshRecords.size() * sizeof(MeshCacheMeshRecord));
+			writeAt(header.BindingTableOffset, bindingRecords.data(), bindingRecords.size() * sizeof(MeshCacheBindingRecord));
+			writeAt(header.LODTableOffset, lodRecords.data(), lodRecords.size() * sizeof(MeshCacheLODRecord));
+			writeAt(header.MaterialLibraryTableOffset, libraryRecords.data(), libraryRecords.size() * sizeof(MeshCacheMaterialLibraryRecord));
+			writeAt(header.StringTableOffset, stringTable.data(), stringTable.size());
+			for (std::size_t i = 0; i < meshes.size(); ++i) {
+				writeAt(meshRecords[i].VertexOffset, meshes[i].GetVertexData().data(), meshes[i].GetVertexData().size_bytes());
+				writeAt(meshRecords[i].IndexOffset, meshes[i].GetIndices().data(), meshes[i].GetIndices().size_bytes());
+			}
+		}
+
+		std::error_code error;
+		std::filesystem::rename(tempPath, path, error);
+		if (error) {
+			LoggingAD::Warning("[OORenderer::MeshCache::Store] Failed to write cache file {}: {}", path.string(), error.message());
+			return;
+		}
+
+		LoggingAD::Trace("[OORenderer::MeshCache::Store] Cached {} meshes for {} in {}", meshes.size(), sourcePath.string(), path.string());
+	}
+
+	std::filesystem::path MeshCache::PathForSource(const std::filesystem::path& sourcePath) {
+		std::error_code error;
+		std::filesystem::path canonicalPath = std::filesystem::weakly_canonical(sourcePath, error);
+
+		std::ostringstream fileName;
+		fileName << sourcePath.stem().string() << "_" << std::hex << std::setw(16) << std::setfill('0') << HashFNV1a64(canonicalPath.generic_string()) << ".oomc";
+		return *sm_Directory / fileName.str();
+	}
+
+	std::uint64_t MeshCache::HashSourceContents(const std::filesystem::path& sourcePath, const std::vector<std::filesystem::path>& materialLibraries) {
+		std::uint64_t hash = HashFileContents(sourcePath, FNV1a64OffsetBasis);
+		for (const std::filesystem::path& materialLibrary : materialLibraries) {
+			hash = HashFileContents(materialLibrary, hash);
+		}
+		return hash;
+	}
+
+	std::uint64_t MeshCache::HashFileContents(const std::filesystem::path& path, std::uint64_t hash) {
+		std::ifstream file(path, std::ios::in | std::ios::binary);
+
+		std::vector<char> chunk(1 << 16);
+		while (file) {
+			file.read(chunk.data(), chunk.size());
+			hash = HashFNV1a64(chunk.data(), static_cast<std::size_t>(file.gcount()), hash);
+		}
+		return hash;
+	}
+
+} // OORenderer
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "OORenderer/Mesh.h"
+#include "MappedFile.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// On disk cache of imported models. Each source model gets one file holding its meshes' final vertex and index data,
+	/// laid out exactly as uploaded, plus the textures each mesh binds. Loading maps the file and hands out views into it.
+	/// </summary>
+	class MeshCache {
+	public: // Public objects
+		struct MeshEntry {
+			std::span<const Mesh::Vertex> VertexData;
+			std::span<const unsigned int> Indices;
+			std::vector<Mesh::LODLevel> LODLevels;
+
+			// Sampler name and texture path pairs
+			std::vector<std::pair<std::string, std::filesystem::path>> TextureBindings;
+		};
+
+		struct CachedModel {
+			// The mapping every MeshEntry views into
+			std::shared_ptr<MappedFile> File;
+			std::vector<MeshEntry> Meshes;
+		};
+
+	public: // Public static methods
+
+		/// <summary>
+		/// Start caching imported models in the given directory, it is created if needed
+		/// </summary>
+		static void Enable(std::filesystem::path directory);
+
+		/// <summary>
+		/// Stop using the cache, existing files are left as they are
+		/// </summary>
+		static void Disable();
+
+		static bool IsEnabled();
+
+		/// <summary>
+		/// Load the cached import of a model, if there is one and it is still up to date with the source file and any material libraries it names
+		/// </summary>
+		/// <param name="sourcePath">Path to the source model file</param>
+		/// <param name="importKey">Describes the import options the meshes should have been produced with, caches stored with another are stale</param>
+		/// <returns>The cached model, nothing if missing, stale, or invalid</returns>
+		static std::optional<CachedModel> Load(const std::filesystem::path& sourcePath, std::uint64_t importKey);
+
+		/// <summary>
+		/// Write the imported meshes of a model to the cache
+		/// </summary>
+		/// <param name="sourcePath">Path to the source model file</param>
+		/// <param name="meshes">Meshes imported from that file</param>
+		/// <param name="importKey">Describes the import options the meshes were produced with</param>
+		static void Store(const std::filesystem::path& sourcePath, const std::vector<Mesh>& meshes, std::uint64_t importKey);
+
+	private: // Private static methods
+		static std::filesystem::path PathForSource(const std::filesystem::path& sourcePath);
+		static std::uint64_t HashSourceContents(const std::filesystem::path& sourcePath, const std::vector<std::filesystem::path>& materialLibraries);
+		static std::uint64_t HashFileContents(const std::filesystem::path& path, std::uint64_t hash);
+
+	private: // Private static members
+		inline static std::optional<std::filesystem::path> sm_Directory{};
+	};
+
+} // OORenderer
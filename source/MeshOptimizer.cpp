@@ -0,0 +1,601 @@
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+namespace OORenderer {
+
+	namespace MeshOptimizer {
+
+		// Forsyth's tuning, see "Linear-Speed Vertex Cache Optimisation"
+		static constexpr int s_ScoringCacheSize = 32;
+		static constexpr float s_CacheDecayPower = 1.5f;
+		static constexpr float s_LastTriangleScore = 0.75f;
+		static constexpr float s_ValenceBoostScale = 2.0f;
+		static constexpr float s_ValenceBoostPower = 0.5f;
+
+		// Simplification tuning, borders are weighted well above the surface so outlines hold
+		static constexpr double s_BorderWeight = 10.0;
+		static constexpr double s_MinFlipCosine = 0.25;
+
+		// Symmetric quadric of squared distances to a set of planes, weighted by area
+		struct Quadric {
+			double A00 = 0.0, A01 = 0.0, A02 = 0.0, A11 = 0.0, A12 = 0.0, A22 = 0.0;
+			double B0 = 0.0, B1 = 0.0, B2 = 0.0;
+			double C = 0.0;
+			double Weight = 0.0;
+
+			static Quadric FromPlane(const glm::dvec3& normal, double distance, double weight) {
+				Quadric quadric;
+				quadric.A00 = weight * normal.x * normal.x;
+				quadric.A01 = weight * normal.x * normal.y;
+				quadric.A02 = weight * normal.x * normal.z;
+				quadric.A11 = weight * normal.y * normal.y;
+				quadric.A12 = weight * normal.y * normal.z;
+				quadric.A22 = weight * normal.z * normal.z;
+				quadric.B0 = weight * normal.x * distance;
+				quadric.B1 = weight * normal.y * distance;
+				quadric.B2 = weight * normal.z * distance;
+				quadric.C = weight * distance * distance;
+				quadric.Weight = weight;
+				return quadric;
+			}
+
+			Quadric operator+(const Quadric& other) const {
+				return {
+					A00 + other.A00, A01 + other.A01, A02 + other.A02, A11 + other.A11, A12 + other.A12, A22 + other.A22,
+					B0 + other.B0, B1 + other.B1, B2 + other.B2,
+					C + other.C,
+					Weight + other.Weight
+				};
+			}
+
+			// Mean squared distance of a point from the planes
+			double Evaluate(const glm::dvec3& p) const {
+				if (Weight <= 0.0) {
+					return 0.0;
+				}
+				double error = A00 * p.x * p.x + A11 * p.y * p.y + A22 * p.z * p.z
+					+ 2.0 * (A01 * p.x * p.y + A02 * p.x * p.z + A12 * p.y * p.z)
+					+ 2.0 * (B0 * p.x + B1 * p.y + B2 * p.z)
+					+ C;
+				return std::max(error, 0.0) / Weight;
+			}
+		};
+
+		static float ScoreVertex(int cachePosition, int remainingTriangles) {
+			if (remainingTriangles == 0) {
+				return -1.0f;
+			}
+
+			float score = 0.0f;
+			if (cachePosition >= 0) {
+				if (cachePosition < 3) {
+					// Used by the last triangle, a fixed score stops it being too keen to reuse just those
+					score = s_LastTriangleScore;
+				}
+				else {
+					float scaler = 1.0f / (s_ScoringCacheSize - 3);
+					score = std::pow(1.0f - (cachePosition - 3) * scaler, s_CacheDecayPower);
+				}
+			}
+
+			// Favour vertices with few triangles left so they're finished off rather than left stranded
+			score += s_ValenceBoostScale * std::pow(static_cast<float>(remainingTriangles), -s_ValenceBoostPower);
+			return score;
+		}
+
+		VertexCacheStats AnalyzeVertexCache(const std::vector<unsigned int>& indices, std::size_t vertexCount, std::size_t cacheSize) {
+			if (indices.empty() || vertexCount == 0) {
+				return {};
+			}
+
+			// FIFO, as most hardware behaves closer to that than to LRU
+			std::vector<std::size_t> insertedAt(vertexCount, 0);
+			std::vector<bool> used(vertexCount, false);
+			std::size_t misses = 0;
+			std::size_t usedCount = 0;
+			for (unsigned int index : indices) {
+				if (!used[index]) {
+					used[index] = true;
+					++usedCount;
+				}
+
+				// Timestamps of cache insertions, a vertex is cached if inserted within the last cacheSize misses
+				if (insertedAt[index] == 0 || misses - insertedAt[index] + 1 > cacheSize) {
+					++misses;
+					insertedAt[index] = misses;
+				}
+			}
+
+			return {
+				.ACMR = static_cast<float>(misses) / (indices.size() / 3),
+				.ATVR = static_cast<float>(misses) / usedCount
+			};
+		}
+
+		void OptimizeVertexCache(std::vector<unsigned int>& indices, std::size_t vertexCount) {
+			std::size_t triangleCount = indices.size() / 3;
+			if (triangleCount == 0) {
+				return;
+			}
+
+			// Triangles using each vertex, as offsets into one flat list
+			std::vector<int> remainingTriangles(vertexCount, 0);
+			for (unsigned int index : indices) {
+				++remainingTriangles[index];
+			}
+			std::vector<std::size_t> adjacencyOffsets(vertexCount + 1, 0);
+			for (std::size_t v = 0; v < vertexCount; ++v) {
+				adjacencyOffsets[v + 1] = adjacencyOffsets[v] + remainingTriangles[v];
+			}
+			std::vector<unsigned int> adjacency(indices.size());
+			std::vector<std::size_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+			for (std::size_t t = 0; t < triangleCount; ++t) {
+				for (int corner = 0; corner < 3; ++corner) {
+					adjacency[fill[indices[t * 3 + corner]]++] = static_cast<unsigned int>(t);
+				}
+			}
+
+			std::vector<int> cachePositions(vertexCount, -1);
+			std::vector<float> vertexScores(vertexCount);
+			for (std::size_t v = 0; v < vertexCount; ++v) {
+				vertexScores[v] = ScoreVertex(-1, remainingTriangles[v]);
+			}
+
+			std::vector<float> triangleScores(triangleCount);
+			std::vector<bool> emitted(triangleCount, false);
+			for (std::size_t t = 0; t < triangleCount; ++t) {
+				triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+			}
+
+			// Simulated LRU cache, with room for one triangle's vertices to be pushed past the end
+			std::vector<unsigned int> cache;
+			cache.reserve(s_ScoringCacheSize + 3);
+
+			std::vector<unsigned int> optimized;
+			optimized.reserve(indices.size());
+
+			std::size_t bestTriangle = std::distance(triangleScores.begin(), std::max_element(triangleScores.begin(), triangleScores.end()));
+			std::size_t scanPosition = 0;
+			while (true) {
+				emitted[bestTriangle] = true;
+
+				// Emit, and move its vertices to the front of the cache
+				std::array<unsigned int, 3> triangle = { indices[bestTriangle * 3], indices[bestTriangle * 3 + 1], indices[bestTriangle * 3 + 2] };
+				std::vector<unsigned int> nextCache(triangle.begin(), triangle.end());
+				for (unsigned int vertex : cache) {
+					if (std::ranges::find(triangle, vertex) == triangle.end()) {
+						nextCache.push_back(vertex);
+					}
+				}
+
+				for (unsigned int vertex : triangle) {
+					optimized.push_back(vertex);
+
+					// Remove the triangle from this vertex's remaining list
+					std::size_t begin = adjacencyOffsets[vertex];
+					std::size_t end = begin + remainingTriangles[vertex];
+					auto triangleIt = std::find(adjacency.begin() + begin, adjacency.begin() + end, static_cast<unsigned int>(bestTriangle));
+					std::iter_swap(triangleIt, adjacency.begin() + end - 1);
+					--remainingTriangles[vertex];
+				}
+
+				// Rescore everything in, or just pushed out of, the cache and their triangles
+				for (std::size_t i = 0; i < nextCache.size(); ++i) {
+					unsigned int vertex = nextCache[i];
+					cachePositions[vertex] = i < s_ScoringCacheSize ? static_cast<int>(i) : -1;
+					vertexScores[vertex] = ScoreVertex(cachePositions[vertex], remainingTriangles[vertex]);
+				}
+
+				float bestScore = -1.0f;
+				bestTriangle = triangleCount;
+				for (unsigned int vertex : nextCache) {
+					for (std::size_t i = 0; i < static_cast<std::size_t>(remainingTriangles[vertex]); ++i) {
+						unsigned int t = adjacency[adjacencyOffsets[vertex] + i];
+						triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+						if (triangleScores[t] > bestScore) {
+							bestScore = triangleScores[t];
+							bestTriangle = t;
+						}
+					}
+				}
+
+				if (nextCache.size() > s_ScoringCacheSize) {
+					nextCache.resize(s_ScoringCacheSize);
+				}
+				cache = std::move(nextCache);
+
+				// Nothing left touching the cache, carry on from the next triangle in the original order
+				if (bestTriangle == triangleCount) {
+					while (scanPosition < triangleCount && emitted[scanPosition]) {
+						++scanPosition;
+					}
+					if (scanPosition == triangleCount) {
+						break;
+					}
+					bestTriangle = scanPosition;
+				}
+			}
+
+			indices = std::move(optimized);
+		}
+
+		void OptimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<StandardVertex>& vertices, float threshold) {
+			std::size_t triangleCount = indices.size() / 3;
+			if (triangleCount < 2) {
+				return;
+			}
+
+			// Split into clusters where the cache restarts, i.e. at triangles missing on every vertex
+			std::vector<std::size_t> clusterStarts;
+			{
+				static constexpr std::size_t cacheSize = 16;
+				std::vector<std::size_t> insertedAt(vertices.size(), 0);
+				std::size_t misses = 0;
+				for (std::size_t t = 0; t < triangleCount; ++t) {
+					int triangleMisses = 0;
+					for (int corner = 0; corner < 3; ++corner) {
+						unsigned int index = indices[t * 3 + corner];
+						if (insertedAt[index] == 0 || misses - insertedAt[index] + 1 > cacheSize) {
+							++misses;
+							++triangleMisses;
+							insertedAt[index] = misses;
+						}
+					}
+					if (t == 0 || triangleMisses == 3) {
+						clusterStarts.push_back(t);
+					}
+				}
+			}
+			if (clusterStarts.size() < 2) {
+				return;
+			}
+
+			glm::vec3 meshCentroid{ 0.0f };
+			for (const StandardVertex& vertex : vertices) {
+				meshCentroid += vertex.Position / static_cast<float>(vertices.size());
+			}
+
+			// Clusters facing away from the mesh centre are drawn first, they're the likeliest to occlude the rest
+			struct Cluster {
+				std::size_t FirstTriangle;
+				std::size_t TriangleCount;
+				float SortKey;
+			};
+			std::vector<Cluster> clusters;
+			clusters.reserve(clusterStarts.size());
+			for (std::size_t c = 0; c < clusterStarts.size(); ++c) {
+				std::size_t first = clusterStarts[c];
+				std::size_t end = c + 1 < clusterStarts.size() ? clusterStarts[c + 1] : triangleCount;
+
+				glm::vec3 centroid{ 0.0f };
+				glm::vec3 normal{ 0.0f };
+				float area = 0.0f;
+				for (std::size_t t = first; t < end; ++t) {
+					const glm::vec3& p0 = vertices[indices[t * 3]].Position;
+					const glm::vec3& p1 = vertices[indices[t * 3 + 1]].Position;
+					const glm::vec3& p2 = vertices[indices[t * 3 + 2]].Position;
+
+					// Area weighted
+					glm::vec3 triangleNormal = glm::cross(p1 - p0, p2 - p0);
+					float triangleArea = glm::length(triangleNormal);
+					centroid += (p0 + p1 + p2) / 3.0f * triangleArea;
+					normal += triangleNormal;
+					area += triangleArea;
+				}
+				if (area > 0.0f) {
+					centroid /= area;
+				}
+				float normalLength = glm::length(normal);
+
+				float sortKey = normalLength > 0.0f ? glm::dot(centroid - meshCentroid, normal / normalLength) : 0.0f;
+				clusters.push_back({ first, end - first, sortKey });
+			}
+
+			std::ranges::stable_sort(clusters, std::ranges::greater{}, &Cluster::SortKey);
+
+			std::vector<unsigned int> reordered;
+			reordered.reserve(indices.size());
+			for (const Cluster& cluster : clusters) {
+				auto begin = indices.begin() + cluster.FirstTriangle * 3;
+				reordered.insert(reordered.end(), begin, begin + cluster.TriangleCount * 3);
+			}
+
+			// Keep the new order only if it doesn't cost too much vertex cache efficiency
+			float before = AnalyzeVertexCache(indices, vertices.size()).ACMR;
+			float after = AnalyzeVertexCache(reordered, vertices.size()).ACMR;
+			if (after <= before * threshold) {
+				indices = std::move(reordered);
+			}
+		}
+
+		void OptimizeVertexFetch(std::vector<StandardVertex>& vertices, std::vector<unsigned int>& indices) {
+			static constexpr unsigned int unassigned = ~0u;
+
+			std::vector<unsigned int> remap(vertices.size(), unassigned);
+			std::vector<StandardVertex> reordered;
+			reordered.reserve(vertices.size());
+
+			for (unsigned int& index : indices) {
+				if (remap[index] == unassigned) {
+					remap[index] = static_cast<unsigned int>(reordered.size());
+					reordered.push_back(vertices[index]);
+				}
+				index = remap[index];
+			}
+
+			vertices = std::move(reordered);
+		}
+
+		std::vector<unsigned int> Simplify(const std::vector<unsigned int>& indices, const std::vector<StandardVertex>& vertices, std::size_t targetIndexCount, float& resultError) {
+			resultError = 0.0f;
+			std::vector<unsigned int> simplified = indices;
+			if (indices.size() <= targetIndexCount) {
+				return simplified;
+			}
+
+			// Vertices sharing a position are wedges of one corner, differing only in their attributes
+			std::vector<unsigned int> positionIDs(vertices.size());
+			std::vector<glm::dvec3> positions;
+			{
+				struct PositionHash {
+					std::size_t operator()(const glm::vec3& position) const {
+						// Adding zero folds -0 into 0, as they compare equal
+						std::uint64_t hash = 0xcbf29ce484222325ull;
+						for (int i = 0; i < 3; ++i) {
+							hash = (hash ^ std::bit_cast<std::uint32_t>(position[i] + 0.0f)) * 0x100000001b3ull;
+						}
+						return hash;
+					}
+				};
+				std::unordered_map<glm::vec3, unsigned int, PositionHash> ids;
+				for (std::size_t v = 0; v < vertices.size(); ++v) {
+					auto [idIt, inserted] = ids.try_emplace(vertices[v].Position, static_cast<unsigned int>(positions.size()));
+					if (inserted) {
+						positions.emplace_back(vertices[v].Position);
+					}
+					positionIDs[v] = idIt->second;
+				}
+			}
+			std::size_t positionCount = positions.size();
+
+			std::vector<std::size_t> wedgeOffsets(positionCount + 1, 0);
+			for (unsigned int id : positionIDs) {
+				++wedgeOffsets[id + 1];
+			}
+			std::partial_sum(wedgeOffsets.begin(), wedgeOffsets.end(), wedgeOffsets.begin());
+			std::vector<unsigned int> wedges(vertices.size());
+			{
+				std::vector<std::size_t> fill(wedgeOffsets.begin(), wedgeOffsets.end() - 1);
+				for (std::size_t v = 0; v < vertices.size(); ++v) {
+					wedges[fill[positionIDs[v]]++] = static_cast<unsigned int>(v);
+				}
+			}
+
+			// Each position starts with the planes of the triangles around it
+			std::vector<Quadric> quadrics(positionCount);
+			std::unordered_map<std::uint64_t, std::pair<unsigned int, std::size_t>> edgeUses; // Triangle count, and the first triangle
+			for (std::size_t t = 0; t < indices.size() / 3; ++t) {
+				std::array<unsigned int, 3> corners = { positionIDs[indices[t * 3]], positionIDs[indices[t * 3 + 1]], positionIDs[indices[t * 3 + 2]] };
+				glm::dvec3 normal = glm::cross(positions[corners[1]] - positions[corners[0]], positions[corners[2]] - positions[corners[0]]);
+				double length = glm::length(normal);
+				if (length > 0.0) {
+					normal /= length;
+					Quadric plane = Quadric::FromPlane(normal, -glm::dot(normal, positions[corners[0]]), length * 0.5);
+					for (unsigned int corner : corners) {
+						quadrics[corner] = quadrics[corner] + plane;
+					}
+				}
+
+				for (int e = 0; e < 3; ++e) {
+					unsigned int a = std::min(corners[e], corners[(e + 1) % 3]);
+					unsigned int b = std::max(corners[e], corners[(e + 1) % 3]);
+					auto [useIt, inserted] = edgeUses.try_emplace((static_cast<std::uint64_t>(a) << 32) | b, 0, t);
+					++useIt->second.first;
+				}
+			}
+
+			// Border edges have one triangle, planes through them perpendicular to it keep them from moving inwards
+			for (const auto& [edge, use] : edgeUses) {
+				if (use.first != 1) {
+					continue;
+				}
+				unsigned int a = static_cast<unsigned int>(edge >> 32);
+				unsigned int b = static_cast<unsigned int>(edge & 0xFFFFFFFF);
+				std::size_t t = use.second;
+				glm::dvec3 p0 = positions[positionIDs[indices[t * 3]]];
+				glm::dvec3 triangleNormal = glm::cross(positions[positionIDs[indices[t * 3 + 1]]] - p0, positions[positionIDs[indices[t * 3 + 2]]] - p0);
+				glm::dvec3 edgeVector = positions[b] - positions[a];
+				glm::dvec3 normal = glm::cross(edgeVector, triangleNormal);
+				double length = glm::length(normal);
+				if (length == 0.0) {
+					continue;
+				}
+				normal /= length;
+				Quadric plane = Quadric::FromPlane(normal, -glm::dot(normal, positions[a]), glm::dot(edgeVector, edgeVector) * s_BorderWeight);
+				quadrics[a] = quadrics[a] + plane;
+				quadrics[b] = quadrics[b] + plane;
+			}
+
+			struct Collapse {
+				unsigned int From;
+				unsigned int To;
+				double Error;
+			};
+
+			std::vector<std::size_t> adjacencyOffsets(positionCount + 1);
+			std::vector<unsigned int> adjacency;
+			std::vector<bool> referenced(vertices.size());
+			std::vector<bool> locked(positionCount);
+			std::vector<unsigned int> vertexRemap(vertices.size());
+			std::vector<Collapse> candidates;
+			double largestError = 0.0;
+
+			// Collapse in passes of independent edges, cheapest first, rebuilding adjacency between passes
+			while (simplified.size() > targetIndexCount) {
+				std::size_t triangleCount = simplified.size() / 3;
+
+				std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+				std::fill(referenced.begin(), referenced.end(), false);
+				for (unsigned int index : simplified) {
+					++adjacencyOffsets[positionIDs[index] + 1];
+					referenced[index] = true;
+				}
+				std::partial_sum(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+				adjacency.resize(simplified.size());
+				{
+					std::vector<std::size_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+					for (std::size_t i = 0; i < simplified.size(); ++i) {
+						adjacency[fill[positionIDs[simplified[i]]]++] = static_cast<unsigned int>(i / 3);
+					}
+				}
+
+				candidates.clear();
+				for (std::size_t t = 0; t < triangleCount; ++t) {
+					for (int e = 0; e < 3; ++e) {
+						unsigned int a = positionIDs[simplified[t * 3 + e]];
+						unsigned int b = positionIDs[simplified[t * 3 + (e + 1) % 3]];
+						Quadric combined = quadrics[a] + quadrics[b];
+						candidates.push_back({ a, b, combined.Evaluate(positions[b]) });
+						candidates.push_back({ b, a, combined.Evaluate(positions[a]) });
+					}
+				}
+				std::ranges::sort(candidates, {}, [](const Collapse& collapse) { return std::pair{ collapse.From, collapse.To }; });
+				auto duplicates = std::ranges::unique(candidates, {}, [](const Collapse& collapse) { return std::pair{ collapse.From, collapse.To }; });
+				candidates.erase(duplicates.begin(), duplicates.end());
+				std::ranges::sort(candidates, {}, &Collapse::Error);
+
+				// Each collapse removes two triangles on a closed surface
+				std::size_t collapsesWanted = (triangleCount - targetIndexCount / 3) / 2 + 1;
+
+				// Stay close to a global cheapest first order, unless that leaves nothing to do. Locking passes over most
+				// candidates, so the limit is never drawn from too few of them
+				std::size_t limitCandidate = std::min(candidates.size(), std::max(collapsesWanted * 2, candidates.size() / 8));
+				double errorLimit = candidates.empty() ? 0.0 : candidates[limitCandidate - 1].Error * 1.5;
+				std::size_t applied = 0;
+				for (double limit : { errorLimit, std::numeric_limits<double>::infinity() }) {
+					std::fill(locked.begin(), locked.end(), false);
+					std::iota(vertexRemap.begin(), vertexRemap.end(), 0u);
+
+					for (const Collapse& collapse : candidates) {
+						if (applied >= collapsesWanted || collapse.Error > limit) {
+							break;
+						}
+						if (locked[collapse.From] || locked[collapse.To]) {
+							continue;
+						}
+
+						auto fromTriangles = std::span(adjacency).subspan(adjacencyOffsets[collapse.From], adjacencyOffsets[collapse.From + 1] - adjacencyOffsets[collapse.From]);
+
+						// Every wedge must have an edge to a wedge at the destination to take its attributes from
+						bool valid = true;
+						for (std::size_t w = wedgeOffsets[collapse.From]; valid && w < wedgeOffsets[collapse.From + 1]; ++w) {
+							unsigned int vertex = wedges[w];
+							if (!referenced[vertex]) {
+								continue;
+							}
+
+							unsigned int destination = ~0u;
+							for (unsigned int t : fromTriangles) {
+								const unsigned int* triangle = &simplified[t * 3];
+								if (triangle[0] != vertex && triangle[1] != vertex && triangle[2] != vertex) {
+									continue;
+								}
+								for (int corner = 0; corner < 3; ++corner) {
+									if (positionIDs[triangle[corner]] == collapse.To) {
+										destination = triangle[corner];
+									}
+								}
+								if (destination != ~0u) {
+									break;
+								}
+							}
+
+							valid = destination != ~0u;
+							vertexRemap[vertex] = destination;
+						}
+
+						// Triangles that don't disappear must not flip or fold over
+						for (std::size_t i = 0; valid && i < fromTriangles.size(); ++i) {
+							std::array<glm::dvec3, 3> before;
+							std::array<glm::dvec3, 3> after;
+							bool removed = false;
+							for (int corner = 0; corner < 3; ++corner) {
+								unsigned int id = positionIDs[simplified[fromTriangles[i] * 3 + corner]];
+								removed |= id == collapse.To;
+								before[corner] = positions[id];
+								after[corner] = id == collapse.From ? positions[collapse.To] : positions[id];
+							}
+							if (removed) {
+								continue;
+							}
+
+							glm::dvec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+							glm::dvec3 normalAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+							valid = glm::dot(normalBefore, normalAfter) > s_MinFlipCosine * glm::length(normalBefore) * glm::length(normalAfter);
+						}
+
+						if (!valid) {
+							for (std::size_t w = wedgeOffsets[collapse.From]; w < wedgeOffsets[collapse.From + 1]; ++w) {
+								vertexRemap[wedges[w]] = wedges[w];
+							}
+							continue;
+						}
+
+						// Lock the neighbourhood, later collapses this pass were checked against it as it was
+						locked[collapse.From] = true;
+						locked[collapse.To] = true;
+						for (unsigned int t : fromTriangles) {
+							for (int corner = 0; corner < 3; ++corner) {
+								locked[positionIDs[simplified[t * 3 + corner]]] = true;
+							}
+						}
+
+						quadrics[collapse.To] = quadrics[collapse.To] + quadrics[collapse.From];
+						largestError = std::max(largestError, collapse.Error);
+						++applied;
+					}
+
+					if (applied > 0) {
+						break;
+					}
+				}
+
+				if (applied == 0) {
+					break;
+				}
+
+				// Apply the pass, dropping triangles that collapsed to an edge
+				std::size_t kept = 0;
+				for (std::size_t t = 0; t < triangleCount; ++t) {
+					unsigned int i0 = vertexRemap[simplified[t * 3]];
+					unsigned int i1 = vertexRemap[simplified[t * 3 + 1]];
+					unsigned int i2 = vertexRemap[simplified[t * 3 + 2]];
+					unsigned int p0 = positionIDs[i0];
+					unsigned int p1 = positionIDs[i1];
+					unsigned int p2 = positionIDs[i2];
+					if (p0 == p1 || p1 == p2 || p0 == p2) {
+						continue;
+					}
+					simplified[kept * 3] = i0;
+					simplified[kept * 3 + 1] = i1;
+					simplified[kept * 3 + 2] = i2;
+					++kept;
+				}
+				simplified.resize(kept * 3);
+			}
+
+			resultError = static_cast<float>(std::sqrt(largestError));
+			return simplified;
+		}
+
+	} // MeshOptimizer
+
+} // OORenderer
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "OORenderer/VertexLayout.h"
+
+namespace OORenderer {
+
+	/// <summary>
+	/// Post import reordering of triangle meshes for faster rendering, none of it changes what is drawn
+	/// </summary>
+	namespace MeshOptimizer {
+
+		struct VertexCacheStats {
+			float ACMR = 0.0f; // Average cache miss ratio, vertex shader runs per triangle. 0.5 is ideal for large regular meshes, 3 the worst
+			float ATVR = 0.0f; // Average transform to vertex ratio, vertex shader runs per vertex. 1 is ideal
+		};
+
+		/// <summary>
+		/// Simulate a FIFO post transform vertex cache over an index list
+		/// </summary>
+		VertexCacheStats AnalyzeVertexCache(const std::vector<unsigned int>& indices, std::size_t vertexCount, std::size_t cacheSize = 16);
+
+		/// <summary>
+		/// Reorder triangles for post transform vertex cache locality using Forsyth's linear speed algorithm
+		/// </summary>
+		void OptimizeVertexCache(std::vector<unsigned int>& indices, std::size_t vertexCount);
+
+		/// <summary>
+		/// Reorder clusters of triangles so outward facing ones are drawn first, cutting overdraw.
+		/// Expects indices already optimized for the vertex cache, clusters are kept intact to preserve most of that
+		/// </summary>
+		/// <param name="threshold">Largest ACMR increase allowed as a ratio, e.g. 1.05, else the order is left as it was</param>
+		void OptimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<StandardVertex>& vertices, float threshold = 1.05f);
+
+		/// <summary>
+		/// Reorder vertices into the order indices first use them, for memory locality of vertex fetch. Unused vertices are dropped
+		/// </summary>
+		void OptimizeVertexFetch(std::vector<StandardVertex>& vertices, std::vector<unsigned int>& indices);
+
+		/// <summary>
+		/// Simplify a mesh by quadric error edge collapse, towards a target index count. The result indexes the same vertices.
+		/// Borders are kept in place and attribute seams are only collapsed along themselves, so UVs and normals don't smear
+		/// </summary>
+		/// <param name="targetIndexCount">Index count to simplify down to, the result may stop short where nothing more can collapse</param>
+		/// <param name="resultError">Set to roughly how far, in model space, the simplified surface strays from the original</param>
+		/// <returns>Indices of the simplified mesh</returns>
+		std::vector<unsigned int> Simplify(const std::vector<unsigned int>& indices, const std::vector<StandardVertex>& vertices, std::size_t targetIndexCount, float& resultError);
+
+	} // MeshOptimizer
+
+} // OORenderer
@@ -3,20 +3,92 @@
 #include <iostream>
 #include <ranges>
 #include <algorithm>
+#include <bit>
 #include <LoggingAD/LoggingAD.h>
 
+#include "OORenderer/TextureCache.h"
+#include "OORenderer/Profiler.h"
+
+#include "MeshCache.h"
+#include "MeshOptimizer.h"
+
 namespace OORenderer {
 
+	Model::ImportOptions Model::sm_ImportOptions{};
+
 	Model::Model(std::filesystem::path path) {
 		LoadFromPath(path);
 	}
 
-	void Model::Render(ShaderProgram& shader) {
+	void Model::Render(ShaderProgram& shader, std::size_t lodLevel, const Frustum* frustum) {
+		OORENDERER_PROFILE_SCOPE("Model::Render");
+		UploadDecodedTextures();
+
+		for (const auto& mesh : m_Meshes) {
+			if (frustum && !frustum->Intersects(mesh.GetBounds().Sphere)) {
+				continue;
+			}
+			mesh.Render(shader, lodLevel);
+		}
+	}
+
+	void Model::Render(ShaderProgram& shader, const glm::mat4& modelMatrix, std::size_t lodLevel, const Frustum* frustum) {
+		OORENDERER_PROFILE_SCOPE("Model::Render");
+		UploadDecodedTextures();
+
+		for (const auto& mesh : m_Meshes) {
+			if (frustum && !frustum->Intersects(mesh.GetBounds().Sphere)) {
+				continue;
+			}
+			mesh.Render(shader, modelMatrix, lodLevel);
+		}
+	}
+
+	void Model::Submit(RenderQueue& queue, ShaderProgram& shader, const glm::mat4& modelMatrix, std::size_t lodLevel, const Frustum* frustum, RenderPass pass) {
+		UploadDecodedTextures();
+
+		for (const auto& mesh : m_Meshes) {
+			if (frustum && !frustum->Intersects(mesh.GetBounds().Sphere)) {
+				continue;
+			}
+			queue.Submit(mesh, shader, modelMatrix, lodLevel, pass);
+		}
+	}
+
+	void Model::Record(CommandList& commands, ShaderProgram& shader, const glm::mat4& modelMatrix, std::size_t lodLevel, const Frustum* frustum, RenderPass pass) {
+		if (m_TexturesPending) {
+			commands.UploadTextures(*this);
+		}
+
 		for (const auto& mesh : m_Meshes) {
-			mesh.Render(shader);
+			if (frustum && !frustum->Intersects(mesh.GetBounds().Sphere)) {
+				continue;
+			}
+			commands.Draw(mesh, shader, modelMatrix, lodLevel, pass);
 		}
 	}
 
+	bool Model::UploadDecodedTextures() {
+		// Lists replay this for every object of ours they recorded, so once all is uploaded it must cost nothing
+		if (!m_TexturesPending) {
+			return true;
+		}
+
+		bool allUploaded = true;
+		for (auto& texture : m_Textures) {
+			allUploaded &= texture->UploadDecodedTexture();
+		}
+		m_TexturesPending = !allUploaded;
+		return allUploaded;
+	}
+
+	void Model::WaitForTextures() {
+		for (auto& texture : m_Textures) {
+			texture->WaitForDecode();
+		}
+		UploadDecodedTextures();
+	}
+
 	void Model::RegisterOnGLFWWindow(GLFWwindow* window) {
 
 		if (!m_RegisteredWindows.empty()) {
@@ -27,8 +99,16 @@ namespace OORenderer {
 		}
 		m_RegisteredWindows.push_back(window);
 
-		// Register textures on correct context
-		for (auto& texture : sm_LoadedTextures) {
+		// A new share group needs mesh data that may have been dropped after an earlier upload
+		bool needsMeshData = std::ranges::any_of(m_Meshes, [window](const Mesh& mesh) {
+			return mesh.NeedsDataFor(window) && !mesh.IsDataResident();
+		});
+		if (needsMeshData) {
+			ReloadMeshData();
+		}
+
+		// Register our textures on correct context, a no-op for any already in this window's share group
+		for (auto& texture : m_Textures) {
 			texture->BindToWindow(window);
 		}
 		
@@ -42,37 +122,198 @@ namespace OORenderer {
 		RegisterOnGLFWWindow(window.GetGLFWWindow());
 	}
 
+	void Model::EnableMeshCache(std::filesystem::path directory) {
+		MeshCache::Enable(directory);
+	}
+
+	void Model::DisableMeshCache() {
+		MeshCache::Disable();
+	}
+
+	void Model::EnableMeshOptimization() {
+		sm_ImportOptions.Optimize = true;
+	}
+
+	void Model::DisableMeshOptimization() {
+		sm_ImportOptions.Optimize = false;
+	}
+
+	void Model::EnableLODGeneration(std::size_t levelCount, float reduction) {
+		if (reduction <= 0.0f || reduction >= 1.0f) {
+			LoggingAD::Warning("[OORenderer::Model::LOD] Level of detail reduction must be between 0 and 1, got {}. Ignoring.", reduction);
+			return;
+		}
+		sm_ImportOptions.LODCount = std::max<std::size_t>(levelCount, 1);
+		sm_ImportOptions.LODReduction = reduction;
+	}
+
+	void Model::DisableLODGeneration() {
+		sm_ImportOptions.LODCount = 1;
+	}
+
+	std::size_t Model::GetLODCount() const {
+		return std::max<std::size_t>(m_LODErrors.size(), 1);
+	}
+
+	float Model::GetLODError(std::size_t lodLevel) const {
+		if (m_LODErrors.empty()) {
+			return 0.0f;
+		}
+		return m_LODErrors[std::min(lodLevel, m_LODErrors.size() - 1)];
+	}
+
+	const Bounds& Model::GetBounds() const {
+		return m_Bounds;
+	}
+
+	std::uint64_t Model::ImportOptions::GetCacheKey() const {
+		std::uint64_t key = Optimize ? 1 : 0;
+		if (LODCount > 1) {
+			key |= static_cast<std::uint64_t>(std::min<std::size_t>(LODCount, 0xFF)) << 8;
+			key |= static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(LODReduction)) << 32;
+		}
+		return key;
+	}
+
+	void Model::SetResidencyPolicy(ResidencyPolicy policy) {
+		for (auto& mesh : m_Meshes) {
+			mesh.SetResidencyPolicy(policy);
+		}
+		for (auto& texture : m_Textures) {
+			texture->SetResidencyPolicy(policy);
+		}
+	}
+
 	void Model::LoadFromPath(std::filesystem::path path) {
+		OORENDERER_PROFILE_SCOPE("Model::LoadFromPath");
 		LoggingAD::Trace("[OORenderer::Model::Load] Loading model from path: {}", path.string());
+		m_ModelPath = path;
+		m_ImportOptions = sm_ImportOptions;
+
+		if (MeshCache::IsEnabled() && LoadFromMeshCache(path)) {
+			return;
+		}
 
 		Assimp::Importer import;
+		const aiScene* scene = ImportASSIMPScene(import, path);
+		if (!scene) {
+			return;
+		}
+		m_ModelDirectory = path.parent_path();
 
-		const aiScene* scene = import.ReadFile(path.string(), aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_CalcTangentSpace);
+		std::vector<aiMesh*> meshes;
+		CollectASSIMPMeshes(scene->mRootNode, scene, meshes);
+		for (aiMesh* mesh : meshes) {
+			ProcessASSIMPMesh(mesh, scene);
+		}
 
-		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-			LoggingAD::Error("[OORenderer::Model::Load::assimp] Assimp error when loading model from path: {}. Error string: {}", path.string(), import.GetErrorString());
+		MeshCache::Store(path, m_Meshes, m_ImportOptions.GetCacheKey());
+	}
+
+	void Model::ReloadMeshData() {
+		LoggingAD::Trace("[OORenderer::Model::Load] Reloading mesh data for model: {}", m_ModelPath.string());
+
+		// Mapping the cache is cheap, importing again is not
+		std::optional<MeshCache::CachedModel> cachedModel = MeshCache::Load(m_ModelPath, m_ImportOptions.GetCacheKey());
+		if (cachedModel && cachedModel->Meshes.size() == m_Meshes.size()) {
+			for (std::size_t i = 0; i < m_Meshes.size(); ++i) {
+				if (!m_Meshes[i].IsDataResident()) {
+					m_Meshes[i].RestoreData(cachedModel->File, cachedModel->Meshes[i].VertexData, cachedModel->Meshes[i].Indices);
+				}
+			}
 			return;
 		}
+
+		Assimp::Importer import;
+		const aiScene* scene = ImportASSIMPScene(import, m_ModelPath);
+		if (!scene) {
+			return;
+		}
+
+		std::vector<aiMesh*> meshes;
+		CollectASSIMPMeshes(scene->mRootNode, scene, meshes);
+		if (meshes.size() != m_Meshes.size()) {
+			LoggingAD::Error("[OORenderer::Model::Load] Model {} changed on disk since it was loaded, can't reload its mesh data.", m_ModelPath.string());
+			return;
+		}
+
+		for (std::size_t i = 0; i < m_Meshes.size(); ++i) {
+			if (!m_Meshes[i].IsDataResident()) {
+				auto geometry = std::make_shared<ASSIMPGeometry>(ExtractASSIMPGeometry(meshes[i], m_ImportOptions));
+				m_Meshes[i].RestoreData(geometry, geometry->Vertices, geometry->Indices);
+			}
+		}
+	}
+
+	bool Model::LoadFromMeshCache(const std::filesystem::path& path) {
+		std::optional<MeshCache::CachedModel> cachedModel = MeshCache::Load(path, m_ImportOptions.GetCacheKey());
+		if (!cachedModel) {
+			return false;
+		}
 		m_ModelDirectory = path.parent_path();
 
-		ProcessASSIMPNode(scene->mRootNode, scene);
+		m_Meshes.reserve(cachedModel->Meshes.size());
+		for (const MeshCache::MeshEntry& entry : cachedModel->Meshes) {
+			std::map<std::string, std::shared_ptr<Texture>> textureBindingMap;
+			for (const auto& [bindingName, texturePath] : entry.TextureBindings) {
+				if (std::shared_ptr<Texture> texture = TextureCache::Acquire(texturePath)) {
+					textureBindingMap[bindingName] = texture;
+				}
+			}
+
+			// Meshes view straight into the mapping, which lives as long as any of them
+			AddMesh(Mesh(cachedModel->File, entry.VertexData, entry.Indices, textureBindingMap, entry.LODLevels));
+		}
+
+		return true;
+	}
+
+	void Model::AddMesh(Mesh mesh) {
+		m_Bounds = m_Meshes.empty() ? mesh.GetBounds() : Bounds::Merge(m_Bounds, mesh.GetBounds());
+
+		// Meshes with fewer levels keep drawing their least detailed one at the levels they lack
+		const std::vector<Mesh::LODLevel>& levels = mesh.GetLODLevels();
+		if (levels.size() > m_LODErrors.size()) {
+			m_LODErrors.resize(levels.size(), m_LODErrors.empty() ? 0.0f : m_LODErrors.back());
+		}
+		for (std::size_t i = 0; i < m_LODErrors.size(); ++i) {
+			m_LODErrors[i] = std::max(m_LODErrors[i], levels[std::min(i, levels.size() - 1)].Error);
+		}
+
+		for (const auto& [bindingName, texture] : mesh.GetTextureBindingMap()) {
+			if (std::ranges::find(m_Textures, texture) == m_Textures.end()) {
+				m_Textures.push_back(texture);
+				m_TexturesPending |= texture->IsDecodePending();
+			}
+		}
+
+		m_Meshes.push_back(std::move(mesh));
+	}
+
+	const aiScene* Model::ImportASSIMPScene(Assimp::Importer& import, const std::filesystem::path& path) {
+		const aiScene* scene = import.ReadFile(path.string(), aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_CalcTangentSpace);
+
+		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+			LoggingAD::Error("[OORenderer::Model::Load::assimp] Assimp error when loading model from path: {}. Error string: {}", path.string(), import.GetErrorString());
+			return nullptr;
+		}
+		return scene;
 	}
 
-	void Model::ProcessASSIMPNode(aiNode* node, const aiScene* scene) {
+	void Model::CollectASSIMPMeshes(aiNode* node, const aiScene* scene, std::vector<aiMesh*>& meshes) {
 		
 		for (unsigned int i = 0; i < node->mNumMeshes; ++i) {
-			aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-			ProcessASSIMPMesh(mesh, scene);
+			meshes.push_back(scene->mMeshes[node->mMeshes[i]]);
 		}
 
 		//  Cover the children
 		for (unsigned int i = 0; i < node->mNumChildren; i++) {
-			ProcessASSIMPNode(node->mChildren[i], scene);
+			CollectASSIMPMeshes(node->mChildren[i], scene, meshes);
 		}
 	}
 
-	void Model::ProcessASSIMPMesh(aiMesh* mesh, const aiScene* scene) {
-		
+	Model::ASSIMPGeometry Model::ExtractASSIMPGeometry(aiMesh* mesh, const ImportOptions& options) {
+
 		// Get vertex data
 		std::vector<Mesh::Vertex> vertices;
 		vertices.reserve(mesh->mNumVertices);
@@ -93,6 +334,62 @@ namespace OORenderer {
 			}
 		}
 
+		ASSIMPGeometry geometry{ std::move(vertices), std::move(indices), {} };
+		PostProcessASSIMPGeometry(geometry, options, mesh->mName.C_Str());
+		return geometry;
+	}
+
+	void Model::PostProcessASSIMPGeometry(ASSIMPGeometry& geometry, const ImportOptions& options, const std::string& meshName) {
+		std::size_t vertexCount = geometry.Vertices.size();
+
+		if (options.Optimize) {
+			MeshOptimizer::VertexCacheStats before = MeshOptimizer::AnalyzeVertexCache(geometry.Indices, vertexCount);
+			MeshOptimizer::OptimizeVertexCache(geometry.Indices, vertexCount);
+			MeshOptimizer::OptimizeOverdraw(geometry.Indices, geometry.Vertices);
+			MeshOptimizer::VertexCacheStats after = MeshOptimizer::AnalyzeVertexCache(geometry.Indices, vertexCount);
+			LoggingAD::Trace("[OORenderer::Model::Load::Optimize] Mesh {}: ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}", meshName, before.ACMR, after.ACMR, before.ATVR, after.ATVR);
+		}
+
+		// Each level simplifies the one before, a level that barely simplifies ends the chain
+		geometry.LODLevels = { { 0, static_cast<std::uint32_t>(geometry.Indices.size()), 0.0f } };
+		std::vector<std::vector<unsigned int>> levelIndices;
+		for (std::size_t level = 1; level < options.LODCount; ++level) {
+			const std::vector<unsigned int>& previous = levelIndices.empty() ? geometry.Indices : levelIndices.back();
+			std::size_t targetIndexCount = static_cast<std::size_t>(previous.size() / 3 * options.LODReduction) * 3;
+
+			float error = 0.0f;
+			std::vector<unsigned int> simplified = MeshOptimizer::Simplify(previous, geometry.Vertices, targetIndexCount, error);
+			if (simplified.empty() || simplified.size() * 20 > previous.size() * 19) {
+				break;
+			}
+			if (options.Optimize) {
+				MeshOptimizer::OptimizeVertexCache(simplified, vertexCount);
+			}
+
+			// Errors compound as each level starts from the last
+			geometry.LODLevels.push_back({ 0, static_cast<std::uint32_t>(simplified.size()), geometry.LODLevels.back().Error + error });
+			levelIndices.push_back(std::move(simplified));
+		}
+
+		// Levels share the vertices, their indices follow the full detail ones
+		for (std::size_t i = 0; i < levelIndices.size(); ++i) {
+			geometry.LODLevels[i + 1].FirstIndex = static_cast<std::uint32_t>(geometry.Indices.size());
+			geometry.Indices.insert(geometry.Indices.end(), levelIndices[i].begin(), levelIndices[i].end());
+		}
+		if (options.LODCount > 1) {
+			LoggingAD::Trace("[OORenderer::Model::Load::LOD] Mesh {}: {} levels of detail, {} down to {} triangles",
+				meshName, geometry.LODLevels.size(), geometry.LODLevels.front().IndexCount / 3, geometry.LODLevels.back().IndexCount / 3);
+		}
+
+		// Last, as it renumbers vertices for every level at once
+		if (options.Optimize) {
+			MeshOptimizer::OptimizeVertexFetch(geometry.Vertices, geometry.Indices);
+		}
+	}
+
+	void Model::ProcessASSIMPMesh(aiMesh* mesh, const aiScene* scene) {
+		ASSIMPGeometry geometry = ExtractASSIMPGeometry(mesh, m_ImportOptions);
+
 		// Get material data 
 		// Build name-shader pair set
 		std::map<std::string, std::shared_ptr<Texture>> textureBindingMap;
@@ -105,7 +402,7 @@ namespace OORenderer {
 			BuildTextureBindingMapFromMaterial(textureBindingMap, material, aiTextureType_HEIGHT, "HeightTexture");
 		}
 
-		m_Meshes.emplace_back(vertices, indices, textureBindingMap);
+		AddMesh(Mesh(std::move(geometry.Vertices), std::move(geometry.Indices), textureBindingMap, std::move(geometry.LODLevels)));
 	}
 
 	std::vector<std::shared_ptr<Texture>> Model::LoadMaterialTextures(aiMaterial* material, aiTextureType type) const {
@@ -123,25 +420,9 @@ namespace OORenderer {
 				texturePath = m_ModelDirectory / texturePath;
 			}
 
-			if (!std::filesystem::exists(texturePath)) {
-				LoggingAD::Warning("[OORenderer::Model::Texture] Failure to load texture at path {}. File not found.", texturePath.string());
-				continue;
-			}
-
-			auto alreadyLoadedIterator = std::ranges::find_if(sm_LoadedTextures,
-				[&texturePath](std::shared_ptr<Texture> texture) -> bool {
-					return texture->GetTexturePath() == texturePath;
-				});
-
-			if (alreadyLoadedIterator != sm_LoadedTextures.end()) { // Texture already loaded, so just copy the pointer to that object
-				textures.push_back(*alreadyLoadedIterator);
-				continue;
+			if (std::shared_ptr<Texture> texture = TextureCache::Acquire(texturePath)) {
+				textures.push_back(texture);
 			}
-
-			 // Load and keep track of the texture
-			auto newlyLoadedTexture = std::make_shared<Texture>(texturePath);
-			sm_LoadedTextures.push_back(newlyLoadedTexture);
-			textures.push_back(newlyLoadedTexture);
 		}
 
 		textures.resize(textures.size());
@@ -162,16 +443,4 @@ namespace OORenderer {
 		}
 	}
 
-	bool Model::TextureAlreadyLoaded(std::filesystem::path path) {
-
-		// Can't do iterators and stl algorithms because references
-		for (const std::shared_ptr<Texture> texture : sm_LoadedTextures) {
-			if (texture->GetTexturePath() == path) {
-				return true;
-			}
-		}
-
-		return false;
-	}
-
 } // OORenderer
@@ -0,0 +1,245 @@
+#include "OORenderer/Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <LoggingAD/LoggingAD.h>
+
+namespace OORenderer {
+
+	// Timings each thread's ring holds, a power of two
+	static constexpr std::size_t s_RingCapacity = std::size_t{ 1 } << 15;
+
+	static const std::chrono::steady_clock::time_point s_Epoch = std::chrono::steady_clock::now();
+
+	struct ProfilerEvent {
+		const char* Name;
+		std::uint64_t Start;
+		std::uint64_t Duration;
+		GLFWwindow* GPUContext; // Null for CPU timings
+	};
+
+	// Written only by its own thread, read by exports racing it
+	struct ProfilerRing {
+		std::array<ProfilerEvent, s_RingCapacity> Events;
+		std::atomic<std::uint64_t> Written{ 0 };
+		std::size_t ThreadIndex = 0;
+		std::string Name; // Guarded by s_RingsMutex
+	};
+
+	struct PendingGPUTimer {
+		GLuint Query;
+		const char* Name;
+		std::uint64_t Start;
+	};
+
+	// Query objects aren't shared between contexts, so each has its own
+	struct ContextGPUTimers {
+		std::deque<PendingGPUTimer> Pending;
+		std::vector<GLuint> FreeQueries;
+		bool Running = false;
+		std::uint64_t LastEnd = 0;
+	};
+
+	// Rings outlive their threads so exports still see what finished threads recorded
+	static std::mutex s_RingsMutex;
+	static std::vector<std::unique_ptr<ProfilerRing>> s_Rings;
+	static thread_local ProfilerRing* s_ThreadRing = nullptr;
+
+	static std::mutex s_GPUTimersMutex;
+	static std::map<GLFWwindow*, ContextGPUTimers> s_GPUTimers;
+
+	static ProfilerRing& GetThreadRing() {
+		if (!s_ThreadRing) {
+			std::scoped_lock lock(s_RingsMutex);
+			auto ring = std::make_unique<ProfilerRing>();
+			ring->ThreadIndex = s_Rings.size();
+			ring->Name = "Thread " + std::to_string(ring->ThreadIndex);
+			s_ThreadRing = ring.get();
+			s_Rings.push_back(std::move(ring));
+		}
+		return *s_ThreadRing;
+	}
+
+	static ContextGPUTimers& GetGPUTimers(GLFWwindow* window) {
+		std::scoped_lock lock(s_GPUTimersMutex);
+		return s_GPUTimers[window];
+	}
+
+	static std::string EscapeJSON(const std::string& text) {
+		std::string escaped;
+		escaped.reserve(text.size());
+		for (char c : text) {
+			if (c == '"' || c == '\\') {
+				escaped += '\\';
+			}
+			escaped += static_cast<unsigned char>(c) < 0x20 ? ' ' : c;
+		}
+		return escaped;
+	}
+
+	Profiler::CPUScope::CPUScope(const char* name)
+		: m_Name(name), m_Start(GetTime())
+	{}
+
+	Profiler::CPUScope::~CPUScope() {
+		RecordEvent(m_Name, m_Start, GetTime() - m_Start, nullptr);
+	}
+
+	Profiler::GPUScope::GPUScope(GLFWwindow* window, const char* name)
+		: m_Window(window), m_Started(BeginGPUTimer(window, name))
+	{}
+
+	Profiler::GPUScope::~GPUScope() {
+		if (m_Started) {
+			EndGPUTimer(m_Window);
+		}
+	}
+
+	void Profiler::SetThreadName(const std::string& name) {
+		ProfilerRing& ring = GetThreadRing();
+		std::scoped_lock lock(s_RingsMutex);
+		ring.Name = name;
+	}
+
+	bool Profiler::BeginGPUTimer(GLFWwindow* window, const char* name) {
+		ContextGPUTimers& timers = GetGPUTimers(window);
+
+		// Read back whatever has finished, in issue order as later queries can't finish first
+		while (!timers.Pending.empty()) {
+			PendingGPUTimer& pending = timers.Pending.front();
+			GLint available = GL_FALSE;
+			glGetQueryObjectiv(pending.Query, GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available) {
+				break;
+			}
+
+			GLuint64 elapsed = 0;
+			glGetQueryObjectui64v(pending.Query, GL_QUERY_RESULT, &elapsed);
+
+			// Only the duration is measured, so start once issued and no earlier than the last timing on this context ended
+			std::uint64_t start = std::max(pending.Start, timers.LastEnd);
+			timers.LastEnd = start + elapsed;
+			RecordEvent(pending.Name, start, elapsed, window);
+
+			timers.FreeQueries.push_back(pending.Query);
+			timers.Pending.pop_front();
+		}
+
+		if (timers.Running) {
+			return false;
+		}
+
+		GLuint query;
+		if (timers.FreeQueries.empty()) {
+			glGenQueries(1, &query);
+		}
+		else {
+			query = timers.FreeQueries.back();
+			timers.FreeQueries.pop_back();
+		}
+
+		glBeginQuery(GL_TIME_ELAPSED, query);
+		timers.Pending.push_back({ query, name, GetTime() });
+		timers.Running = true;
+		return true;
+	}
+
+	void Profiler::EndGPUTimer(GLFWwindow* window) {
+		ContextGPUTimers& timers = GetGPUTimers(window);
+		if (timers.Running) {
+			glEndQuery(GL_TIME_ELAPSED);
+			timers.Running = false;
+		}
+	}
+
+	void Profiler::ReleaseContext(GLFWwindow* window) {
+		// The queries go with the context
+		std::scoped_lock lock(s_GPUTimersMutex);
+		s_GPUTimers.erase(window);
+	}
+
+	bool Profiler::WriteChromeTrace(const std::filesystem::path& path) {
+		std::ofstream file(path, std::ios::out | std::ios::trunc);
+		if (!file) {
+			LoggingAD::Error("[OORenderer::Profiler::WriteChromeTrace] Failed to open {} for writing.", path.string());
+			return false;
+		}
+
+		std::scoped_lock lock(s_RingsMutex);
+
+		// GPU tracks follow the threads', one per context in the order first seen
+		std::map<GLFWwindow*, std::size_t> gpuTracks;
+		std::size_t eventCount = 0;
+		bool first = true;
+		auto separate = [&]() -> std::ofstream& {
+			if (!first) {
+				file << ",\n";
+			}
+			first = false;
+			return file;
+		};
+
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		for (const auto& ring : s_Rings) {
+			separate() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << ring->ThreadIndex
+				<< ",\"args\":{\"name\":\"" << EscapeJSON(ring->Name) << "\"}}";
+
+			// Copy out what the ring holds, then drop whatever its thread may have overwritten meanwhile
+			std::uint64_t written = ring->Written.load(std::memory_order_acquire);
+			std::uint64_t begin = written > s_RingCapacity ? written - s_RingCapacity : 0;
+			std::vector<ProfilerEvent> events;
+			events.reserve(written - begin);
+			for (std::uint64_t i = begin; i < written; ++i) {
+				events.push_back(ring->Events[i & (s_RingCapacity - 1)]);
+			}
+			std::uint64_t writtenAfter = ring->Written.load(std::memory_order_acquire);
+			// Its thread may be part way through writing event writtenAfter, whose slot is that of writtenAfter - s_RingCapacity
+			std::uint64_t firstIntact = writtenAfter + 1 > s_RingCapacity ? writtenAfter + 1 - s_RingCapacity : 0;
+			std::size_t skipped = static_cast<std::size_t>(std::min(std::max(firstIntact, begin) - begin, written - begin));
+
+			for (std::size_t i = skipped; i < events.size(); ++i) {
+				const ProfilerEvent& event = events[i];
+				std::size_t track = ring->ThreadIndex;
+				const char* category = "cpu";
+				if (event.GPUContext) {
+					track = gpuTracks.try_emplace(event.GPUContext, gpuTracks.size()).first->second + s_Rings.size();
+					category = "gpu";
+				}
+
+				// Microseconds, as Chrome traces count in
+				separate() << "{\"name\":\"" << EscapeJSON(event.Name) << "\",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << track
+					<< ",\"ts\":" << event.Start / 1000.0 << ",\"dur\":" << event.Duration / 1000.0 << "}";
+				++eventCount;
+			}
+		}
+
+		for (const auto& [context, track] : gpuTracks) {
+			separate() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << track + s_Rings.size()
+				<< ",\"args\":{\"name\":\"GPU " << static_cast<const void*>(context) << "\"}}";
+		}
+		file << "\n]}\n";
+
+		LoggingAD::Trace("[OORenderer::Profiler::WriteChromeTrace] Wrote {} timings from {} threads and {} contexts to {}", eventCount, s_Rings.size(), gpuTracks.size(), path.string());
+		return static_cast<bool>(file);
+	}
+
+	std::uint64_t Profiler::GetTime() {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_Epoch).count();
+	}
+
+	void Profiler::RecordEvent(const char* name, std::uint64_t start, std::uint64_t duration, GLFWwindow* gpuContext) {
+		ProfilerRing& ring = GetThreadRing();
+		std::uint64_t index = ring.Written.load(std::memory_order_relaxed);
+		ring.Events[index & (s_RingCapacity - 1)] = { name, start, duration, gpuContext };
+		ring.Written.store(index + 1, std::memory_order_release);
+	}
+
+} // OORenderer
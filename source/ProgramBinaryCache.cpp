@@ -0,0 +1,144 @@
+#include "ProgramBinaryCache.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <LoggingAD/LoggingAD.h>
+
+#include "OORenderer/Hash.h"
+
+namespace OORenderer {
+
+	// Bump if the file layout changes, old files then fail validation and are rebuilt
+	static constexpr std::uint32_t s_FileMagic = 0x4F4F5042; // "OOPB"
+	static constexpr std::uint32_t s_FileVersion = 1;
+
+	struct ProgramBinaryFileHeader {
+		std::uint32_t Magic;
+		std::uint32_t Version;
+		std::uint64_t Key;
+		std::uint32_t Format;
+		std::uint32_t Length;
+		std::uint64_t DataHash;
+	};
+
+	void ProgramBinaryCache::Enable(std::filesystem::path directory) {
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+		if (error) {
+			LoggingAD::Error("[OORenderer::ProgramBinaryCache] Failed to create cache directory {}: {}", directory.string(), error.message());
+			return;
+		}
+
+		LoggingAD::Trace("[OORenderer::ProgramBinaryCache] Caching program binaries in {}", directory.string());
+		sm_Directory = directory;
+	}
+
+	void ProgramBinaryCache::Disable() {
+		sm_Directory.reset();
+	}
+
+	bool ProgramBinaryCache::IsEnabled() {
+		return sm_Directory.has_value();
+	}
+
+	bool ProgramBinaryCache::IsUsableOnCurrentContext() {
+		return sm_Directory && IsSupportedOnCurrentContext();
+	}
+
+	bool ProgramBinaryCache::IsSupportedOnCurrentContext() {
+		if (!GLAD_GL_VERSION_4_1) {
+			return false;
+		}
+
+		GLint numFormats = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+		return numFormats > 0;
+	}
+
+	std::uint64_t ProgramBinaryCache::BuildKey(const std::map<int, std::string>& sources) {
+		std::uint64_t key = FNV1a64OffsetBasis;
+
+		// Any change of driver invalidates every binary
+		for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+			const char* value = reinterpret_cast<const char*>(glGetString(name));
+			key = HashFNV1a64(value ? value : "", key);
+		}
+
+		for (const auto& [type, source] : sources) {
+			key = HashFNV1a64(std::to_string(type), key);
+			key = HashFNV1a64(source, key);
+		}
+
+		return key;
+	}
+
+	std::optional<ProgramBinaryCache::Binary> ProgramBinaryCache::Load(std::uint64_t key) {
+		if (!sm_Directory) {
+			return std::nullopt;
+		}
+
+		std::ifstream file(PathForKey(key), std::ios::in | std::ios::binary);
+		if (!file.is_open()) {
+			return std::nullopt;
+		}
+
+		ProgramBinaryFileHeader header{};
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+		if (!file || header.Magic != s_FileMagic || header.Version != s_FileVersion || header.Key != key) {
+			LoggingAD::Warning("[OORenderer::ProgramBinaryCache::Load] Ignoring invalid cache file {}", PathForKey(key).string());
+			return std::nullopt;
+		}
+
+		Binary binary{ .Format = header.Format, .Data = std::vector<char>(header.Length) };
+		file.read(binary.Data.data(), binary.Data.size());
+		if (!file || HashFNV1a64(binary.Data.data(), binary.Data.size()) != header.DataHash) {
+			LoggingAD::Warning("[OORenderer::ProgramBinaryCache::Load] Ignoring truncated or corrupt cache file {}", PathForKey(key).string());
+			return std::nullopt;
+		}
+
+		return binary;
+	}
+
+	void ProgramBinaryCache::Store(std::uint64_t key, const Binary& binary) {
+		if (!sm_Directory) {
+			return;
+		}
+
+		ProgramBinaryFileHeader header{
+			.Magic = s_FileMagic,
+			.Version = s_FileVersion,
+			.Key = key,
+			.Format = binary.Format,
+			.Length = static_cast<std::uint32_t>(binary.Data.size()),
+			.DataHash = HashFNV1a64(binary.Data.data(), binary.Data.size())
+		};
+
+		// Write then rename so a crash part way never leaves a file that looks complete
+		std::filesystem::path path = PathForKey(key);
+		std::filesystem::path tempPath = path;
+		tempPath += ".tmp";
+		{
+			std::ofstream file(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!file.is_open()) {
+				LoggingAD::Warning("[OORenderer::ProgramBinaryCache::Store] Failed to open cache file {} for writing", tempPath.string());
+				return;
+			}
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			file.write(binary.Data.data(), binary.Data.size());
+		}
+
+		std::error_code error;
+		std::filesystem::rename(tempPath, path, error);
+		if (error) {
+			LoggingAD::Warning("[OORenderer::ProgramBinaryCache::Store] Failed to write cache file {}: {}", path.string(), error.message());
+		}
+	}
+
+	std::filesystem::path ProgramBinaryCache::PathForKey(std::uint64_t key) {
+		std::ostringstream fileName;
+		fileName << std::hex << std::setw(16) << std::setfill('0') << key << ".oopb";
+		return *sm_Directory / fileName.str();
+	}
+
+} // OORenderer
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace OORenderer {
+
+	/// <summary>
+	/// On disk cache of linked program binaries, keyed by the stage sources and the driver that produced them.
+	/// Binaries are only valid for the driver that made them so the key changes with any driver update.
+	/// </summary>
+	class ProgramBinaryCache {
+	public: // Public objects
+		struct Binary {
+			GLenum Format = GL_NONE;
+			std::vector<char> Data;
+		};
+
+	public: // Public static methods
+
+		/// <summary>
+		/// Start caching program binaries in the given directory, it is created if needed
+		/// </summary>
+		static void Enable(std::filesystem::path directory);
+
+		/// <summary>
+		/// Stop using the cache, existing files are left as they are
+		/// </summary>
+		static void Disable();
+
+		/// <summary>
+		/// Is caching enabled? Doesn't need a context.
+		/// </summary>
+		static bool IsEnabled();
+
+		/// <summary>
+		/// Is caching enabled, and does the current context support retrieving program binaries?
+		/// </summary>
+		static bool IsUsableOnCurrentContext();
+
+		/// <summary>
+		/// Does the current context support retrieving program binaries, whether or not caching is enabled?
+		/// </summary>
+		static bool IsSupportedOnCurrentContext();
+
+		/// <summary>
+		/// Build the cache key for a set of stage sources on the current context
+		/// </summary>
+		/// <param name="sources">Map from shader type to source</param>
+		/// <returns>Cache key</returns>
+		static std::uint64_t BuildKey(const std::map<int, std::string>& sources);
+
+		/// <summary>
+		/// Load a binary from the cache, validating it against the key
+		/// </summary>
+		/// <param name="key">Cache key</param>
+		/// <returns>The binary, or nothing if not cached or the file is invalid</returns>
+		static std::optional<Binary> Load(std::uint64_t key);
+
+		/// <summary>
+		/// Store a binary in the cache
+		/// </summary>
+		/// <param name="key">Cache key</param>
+		/// <param name="binary">Binary to store</param>
+		static void Store(std::uint64_t key, const Binary& binary);
+
+	private: // Private static methods
+		static std::filesystem::path PathForKey(std::uint64_t key);
+
+	private: // Private static members
+		inline static std::optional<std::filesystem::path> sm_Directory{};
+	};
+
+} // OORenderer
@@ -1,9 +1,35 @@
 
 #include "OORenderer/RenderObject.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
 #include <LoggingAD/LoggingAD.h>
 
 namespace OORenderer {
 
+	using namespace Literals;
+
+	// World spheres of a batch of objects and which of them are in view
+	struct CulledObjects {
+		std::vector<BoundingSphere> WorldSpheres;
+		std::vector<std::uint32_t> VisibleIndices;
+	};
+
+	static const CulledObjects& CullObjects(std::span<RenderObject> objects, const Camera& camera) {
+		// Reused between calls as this runs every frame, per thread as workers may each cull a share
+		thread_local CulledObjects culled;
+		culled.WorldSpheres.clear();
+		culled.VisibleIndices.clear();
+
+		culled.WorldSpheres.reserve(objects.size());
+		for (const RenderObject& object : objects) {
+			culled.WorldSpheres.push_back(object.GetWorldBounds().Sphere);
+		}
+		Frustum(camera.GetPVMatrix()).Cull(culled.WorldSpheres, culled.VisibleIndices);
+		return culled;
+	}
+
 	RenderObject::RenderObject(std::shared_ptr<Model> model, std::shared_ptr<ShaderProgram> shaderProgram)
 		: m_Model(model), m_ShaderProgram(shaderProgram)
 	{}
@@ -14,9 +40,202 @@ namespace OORenderer {
 		LoadModel(filePath);
 	}
 
+	RenderObject::RenderObject(const RenderObject& other)
+		: m_ShaderProgram(other.m_ShaderProgram), m_Model(other.m_Model), m_ModelMatrix(other.m_ModelMatrix), m_LODLevel(other.m_LODLevel), m_RenderPass(other.m_RenderPass)
+	{
+		if (other.m_SpatialIndex) {
+			AddToSpatialIndex(other.m_SpatialIndex);
+		}
+	}
+
+	RenderObject::RenderObject(RenderObject&& other) noexcept
+		: m_ShaderProgram(std::move(other.m_ShaderProgram)), m_Model(std::move(other.m_Model)), m_ModelMatrix(other.m_ModelMatrix), m_LODLevel(other.m_LODLevel), m_RenderPass(other.m_RenderPass),
+		m_SpatialIndex(std::move(other.m_SpatialIndex)), m_SpatialProxy(std::exchange(other.m_SpatialProxy, SpatialIndex::NullProxy))
+	{
+		if (m_SpatialIndex) {
+			m_SpatialIndex->SetObject(m_SpatialProxy, this);
+		}
+	}
+
+	RenderObject& RenderObject::operator=(RenderObject other) noexcept {
+		RemoveFromSpatialIndex();
+
+		m_ShaderProgram = std::move(other.m_ShaderProgram);
+		m_Model = std::move(other.m_Model);
+		m_ModelMatrix = other.m_ModelMatrix;
+		m_LODLevel = other.m_LODLevel;
+		m_RenderPass = other.m_RenderPass;
+		m_SpatialIndex = std::move(other.m_SpatialIndex);
+		m_SpatialProxy = std::exchange(other.m_SpatialProxy, SpatialIndex::NullProxy);
+		if (m_SpatialIndex) {
+			m_SpatialIndex->SetObject(m_SpatialProxy, this);
+		}
+		return *this;
+	}
+
+	RenderObject::~RenderObject() {
+		RemoveFromSpatialIndex();
+	}
+
 	void RenderObject::Render() const {
-		m_ShaderProgram->SetUniformMatrix4fv("modelMatrix", m_ModelMatrix);
-		m_Model->Render(*m_ShaderProgram);
+		m_Model->Render(*m_ShaderProgram, m_ModelMatrix, m_LODLevel);
+	}
+
+	void RenderObject::Render(const Camera& camera, RenderQueue* queue) {
+		if (queue) {
+			queue->SetView(camera);
+		}
+
+		BoundingSphere worldSphere = GetWorldBounds().Sphere;
+		if (Frustum(camera.GetPVMatrix()).Intersects(worldSphere)) {
+			RenderVisible(camera, worldSphere, queue);
+		}
+	}
+
+	void RenderObject::SetRenderPass(RenderPass pass) {
+		m_RenderPass = pass;
+	}
+
+	RenderPass RenderObject::GetRenderPass() const {
+		return m_RenderPass;
+	}
+
+	std::size_t RenderObject::RenderAll(std::span<RenderObject> objects, const Camera& camera, RenderQueue* queue) {
+		const CulledObjects& culled = CullObjects(objects, camera);
+
+		if (queue) {
+			queue->SetView(camera);
+		}
+		for (std::uint32_t index : culled.VisibleIndices) {
+			objects[index].RenderVisible(camera, culled.WorldSpheres[index], queue);
+		}
+		return culled.VisibleIndices.size();
+	}
+
+	std::size_t RenderObject::RecordAll(std::span<RenderObject> objects, const Camera& camera, CommandList& commands) {
+		const CulledObjects& culled = CullObjects(objects, camera);
+
+		commands.SetView(camera.GetViewMatrix());
+		for (std::uint32_t index : culled.VisibleIndices) {
+			objects[index].RecordVisible(camera, culled.WorldSpheres[index], commands);
+		}
+		return culled.VisibleIndices.size();
+	}
+
+	std::size_t RenderObject::RenderAll(const SpatialIndex& spatialIndex, const Camera& camera, RenderQueue* queue) {
+		thread_local std::vector<RenderObject*> candidates;
+		candidates.clear();
+
+		// The tree tests fat boxes, the spheres trim what that lets through
+		Frustum frustum(camera.GetPVMatrix());
+		spatialIndex.Query(frustum, candidates);
+
+		if (queue) {
+			queue->SetView(camera);
+		}
+		std::size_t rendered = 0;
+		for (RenderObject* object : candidates) {
+			BoundingSphere worldSphere = object->GetWorldBounds().Sphere;
+			if (frustum.Intersects(worldSphere)) {
+				object->RenderVisible(camera, worldSphere, queue);
+				++rendered;
+			}
+		}
+		return rendered;
+	}
+
+	Bounds RenderObject::GetWorldBounds() const {
+		return m_Model->GetBounds().Transformed(m_ModelMatrix);
+	}
+
+	void RenderObject::AddToSpatialIndex(std::shared_ptr<SpatialIndex> spatialIndex) {
+		RemoveFromSpatialIndex();
+		m_SpatialIndex = std::move(spatialIndex);
+		UpdateSpatialIndex();
+	}
+
+	void RenderObject::RemoveFromSpatialIndex() {
+		if (m_SpatialIndex && m_SpatialProxy != SpatialIndex::NullProxy) {
+			m_SpatialIndex->Remove(m_SpatialProxy);
+		}
+		m_SpatialIndex.reset();
+		m_SpatialProxy = SpatialIndex::NullProxy;
+	}
+
+	void RenderObject::UpdateSpatialIndex() {
+		if (!m_SpatialIndex || !m_Model) {
+			return;
+		}
+
+		// Objects added before they had a model join once they have one
+		if (m_SpatialProxy == SpatialIndex::NullProxy) {
+			m_SpatialProxy = m_SpatialIndex->Insert(GetWorldBounds().Box, this);
+			return;
+		}
+		m_SpatialIndex->Update(m_SpatialProxy, GetWorldBounds().Box);
+	}
+
+	std::size_t RenderObject::GetLODLevel() const {
+		return m_LODLevel;
+	}
+
+	void RenderObject::SetLODThreshold(float screenError) {
+		sm_LODThreshold = screenError;
+	}
+
+	void RenderObject::SetLODHysteresis(float margin) {
+		sm_LODHysteresis = glm::clamp(margin, 0.0f, 0.99f);
+	}
+
+	void RenderObject::RenderVisible(const Camera& camera, const BoundingSphere& worldSphere, RenderQueue* queue) {
+		SelectLODLevel(camera, worldSphere);
+
+		// Meshes of the model are culled in its own space
+		Frustum modelFrustum(camera.GetPVMatrix() * m_ModelMatrix);
+		if (queue) {
+			m_Model->Submit(*queue, *m_ShaderProgram, m_ModelMatrix, m_LODLevel, &modelFrustum, m_RenderPass);
+			return;
+		}
+
+		m_Model->Render(*m_ShaderProgram, m_ModelMatrix, m_LODLevel, &modelFrustum);
+	}
+
+	void RenderObject::RecordVisible(const Camera& camera, const BoundingSphere& worldSphere, CommandList& commands) {
+		SelectLODLevel(camera, worldSphere);
+
+		Frustum modelFrustum(camera.GetPVMatrix() * m_ModelMatrix);
+		m_Model->Record(commands, *m_ShaderProgram, m_ModelMatrix, m_LODLevel, &modelFrustum, m_RenderPass);
+	}
+
+	void RenderObject::SelectLODLevel(const Camera& camera, const BoundingSphere& worldSphere) {
+		std::size_t lodCount = m_Model->GetLODCount();
+		m_LODLevel = std::min(m_LODLevel, lodCount - 1);
+		if (lodCount == 1) {
+			return;
+		}
+
+		float worldScale = std::max({ glm::length(glm::vec3{ m_ModelMatrix[0] }), glm::length(glm::vec3{ m_ModelMatrix[1] }), glm::length(glm::vec3{ m_ModelMatrix[2] }) });
+
+		// Viewport heights per model space unit at the nearest point of the sphere, NDC spans two
+		glm::mat4 projection = camera.GetProjectionMatrix();
+		float screenScale = projection[1][1] * 0.5f * worldScale;
+		bool perspective = projection[3][3] == 0.0f;
+		if (perspective) {
+			float depth = -(camera.GetViewMatrix() * glm::vec4{ worldSphere.Center, 1.0f }).z - worldSphere.Radius;
+			if (depth <= 0.0f) {
+				m_LODLevel = 0;
+				return;
+			}
+			screenScale /= depth;
+		}
+
+		// Refine once the current level is clearly too coarse, coarsen once the next is clearly fine enough
+		while (m_LODLevel > 0 && m_Model->GetLODError(m_LODLevel) * screenScale > sm_LODThreshold * (1.0f + sm_LODHysteresis)) {
+			--m_LODLevel;
+		}
+		while (m_LODLevel + 1 < lodCount && m_Model->GetLODError(m_LODLevel + 1) * screenScale <= sm_LODThreshold * (1.0f - sm_LODHysteresis)) {
+			++m_LODLevel;
+		}
 	}
 
 	void RenderObject::LoadModel(std::filesystem::path filePath) {
@@ -30,6 +249,7 @@ namespace OORenderer {
 			LoggingAD::Trace("[OORenderer::RenderObject::LoadModel] Model already loaded, loading from cache.");
 			m_Model = sm_LoadedModels[filePath];
 		}
+		UpdateSpatialIndex();
 	}
 
 	void RenderObject::AssignShaderProgram(std::shared_ptr<ShaderProgram> shaderProgram) {
@@ -37,7 +257,7 @@ namespace OORenderer {
 	}
 
 	void RenderObject::SetPVMatrix(const glm::mat4& pvMatrix, bool transpose) {
-		m_ShaderProgram->SetUniformMatrix4fv("pvMatrix", pvMatrix, transpose);
+		m_ShaderProgram->SetUniformMatrix4fv(m_ShaderProgram->GetUniform("pvMatrix"_uniform), pvMatrix, transpose);
 	}
 
 	void RenderObject::RegisterOnGLFWWindow(GLFWwindow* window) {
@@ -50,10 +270,12 @@ namespace OORenderer {
 
 	void RenderObject::Move(glm::vec3 vec) {
 		m_ModelMatrix = glm::translate(m_ModelMatrix, vec);
+		UpdateSpatialIndex();
 	}
 
 	void RenderObject::Rotate(float angle, glm::vec3 axis) {
 		m_ModelMatrix = glm::rotate(m_ModelMatrix, angle, axis);
+		UpdateSpatialIndex();
 	}
 
 	void RenderObject::Scale(float scaleFactor) {
@@ -62,6 +284,7 @@ namespace OORenderer {
 
 	void RenderObject::Scale(glm::vec3 scaleFactors) {
 		m_ModelMatrix = glm::scale(m_ModelMatrix, scaleFactors);
+		UpdateSpatialIndex();
 	}
 
 } // OORenderer
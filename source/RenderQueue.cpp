@@ -0,0 +1,514 @@
+#include "OORenderer/RenderQueue.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <LoggingAD/LoggingAD.h>
+
+#include "OORenderer/Window.h"
+#include "OORenderer/Profiler.h"
+#include "OORenderer/GLStateCache.h"
+
+namespace OORenderer {
+
+	using namespace Literals;
+
+	// Key fields, most significant first. Window and pass lead for both passes, then opaques group by state, with
+	// draws of a mesh at one level together so they may be instanced, and go front to back within equal state.
+	// Transparents must go back to front before anything else
+	static constexpr unsigned int s_WindowBits = 4;
+	static constexpr unsigned int s_PassBits = 2;
+	static constexpr unsigned int s_ShaderBits = 12;
+	static constexpr unsigned int s_MaterialBits = 16;
+	static constexpr unsigned int s_OpaqueVAOBits = 12;
+	static constexpr unsigned int s_OpaqueLODBits = 3;
+	static constexpr unsigned int s_OpaqueDepthBits = 15;
+	static constexpr unsigned int s_TransparentDepthBits = 24;
+	static constexpr unsigned int s_TransparentVAOBits = 6;
+
+	static_assert(s_WindowBits + s_PassBits + s_ShaderBits + s_MaterialBits + s_OpaqueVAOBits + s_OpaqueLODBits + s_OpaqueDepthBits == 64);
+	static_assert(s_WindowBits + s_PassBits + s_TransparentDepthBits + s_ShaderBits + s_MaterialBits + s_TransparentVAOBits == 64);
+
+	// Appends fields to a key from its most significant bits down
+	class KeyPacker {
+	public:
+		KeyPacker& Add(std::uint64_t value, unsigned int bits) {
+			m_Key = (m_Key << bits) | (value & ((std::uint64_t{ 1 } << bits) - 1));
+			return *this;
+		}
+
+		std::uint64_t Get() const { return m_Key; }
+
+	private:
+		std::uint64_t m_Key = 0;
+	};
+
+	// GPU timings of each pass, by RenderPass
+	[[maybe_unused]] static constexpr const char* s_PassNames[] = { "RenderQueue Opaque", "RenderQueue Transparent" };
+
+	// Bytes each window's ring buffer starts with per frame, rings are replaced with bigger ones as needed
+	static constexpr std::size_t s_InitialRingFrameSize = 1024 * 1024;
+
+	// Positive floats order the same as their bits, so the top bits are a quantized depth needing no depth range
+	static std::uint32_t QuantizeDepth(float depth, unsigned int bits) {
+		return std::bit_cast<std::uint32_t>(std::max(depth, 0.0f)) >> (31 - bits);
+	}
+
+	// Version of a window's own context, whichever context's entry points GLAD holds
+	static bool HasContextVersion(GLFWwindow* window, int major, int minor) {
+		const Window* user = static_cast<const Window*>(glfwGetWindowUserPointer(window));
+		return user && user->HasContextVersion(major, minor);
+	}
+
+	void RenderQueue::SetView(const Camera& camera) {
+		SetView(camera.GetViewMatrix());
+	}
+
+	void RenderQueue::SetView(const glm::mat4& viewMatrix) {
+		m_ViewMatrix = viewMatrix;
+	}
+
+	void RenderQueue::Submit(const Mesh& mesh, ShaderProgram& shader, const glm::mat4& modelMatrix, std::size_t lodLevel, RenderPass pass) {
+		unsigned int VAOID = mesh.GetVAOID(shader.GetGLFWWindow());
+		if (VAOID == 0) {
+			LoggingAD::Warning("[OORenderer::RenderQueue::Submit] Attempting to queue mesh using shader registered to a window this mesh hasn't been loaded to.");
+			return;
+		}
+
+		// Depth of the mesh's centre along the view direction
+		glm::vec4 center = m_ViewMatrix * (modelMatrix * glm::vec4{ mesh.GetBounds().Sphere.Center, 1.0f });
+		float depth = -center.z;
+
+		m_Packets.push_back({ &mesh, &shader, modelMatrix, lodLevel, VAOID, pass, mesh.GetMaterialKey(shader.GetGLFWWindow()) });
+		m_SortEntries.push_back({ MakeKey(m_Packets.back(), depth), static_cast<std::uint32_t>(m_Packets.size() - 1) });
+	}
+
+	RenderQueue::~RenderQueue() {
+		// Ensure we delete each buffer on the correct context
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		for (const auto& [window, windowBuffers] : m_WindowBuffers) {
+			Window::ActivateGLFWWindow(window);
+			GLStateCache::ForgetBuffer(window, windowBuffers.Instances.BufferID);
+			GLStateCache::ForgetBuffer(window, windowBuffers.Commands.BufferID);
+			glDeleteBuffers(1, &windowBuffers.Instances.BufferID);
+			glDeleteBuffers(1, &windowBuffers.Commands.BufferID);
+		}
+		Window::ActivateGLFWWindow(oldContext);
+	}
+
+	std::size_t RenderQueue::Flush() {
+		OORENDERER_PROFILE_SCOPE("RenderQueue::Flush");
+		m_Stats = {};
+		RadixSort(m_SortEntries, m_SortScratch);
+		BuildBatches();
+		BuildMultiDraws();
+
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+
+		// What is bound, per the draws so far. Nothing is assumed on entering a window
+		GLFWwindow* window = nullptr;
+		RenderPass pass = RenderPass::Opaque;
+		ShaderProgram* shader = nullptr;
+		std::uint64_t materialKey = 0;
+		bool materialBound = false;
+		unsigned int VAOID = 0;
+
+		auto setPass = [&pass](RenderPass newPass) {
+			if (newPass == pass) {
+				return;
+			}
+			if (newPass == RenderPass::Transparent) {
+				GLStateCache::Current().SetEnabled(GL_BLEND, true);
+				glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+				glDepthMask(GL_FALSE);
+			}
+			else {
+				GLStateCache::Current().SetEnabled(GL_BLEND, false);
+				glDepthMask(GL_TRUE);
+			}
+			pass = newPass;
+		};
+
+		auto leaveWindow = [&]() {
+			if (window) {
+				OORENDERER_PROFILE_GPU_END(window);
+				setPass(RenderPass::Opaque);
+
+				// Fence what this window's draws read, later flushes write elsewhere until it passes
+				if (RingBuffer* ring = m_WindowBuffers[window].Ring.get()) {
+					ring->NextFrame();
+				}
+			}
+		};
+
+		for (std::size_t batchIndex = 0; batchIndex < m_Batches.size(); batchIndex += m_Batches[batchIndex].MultiDrawCount) {
+			const Batch& batch = m_Batches[batchIndex];
+			const DrawPacket& packet = m_Packets[m_SortEntries[batch.FirstEntry].Packet];
+
+			GLFWwindow* packetWindow = packet.Shader->GetGLFWWindow();
+			if (packetWindow != window) {
+				leaveWindow();
+				Window::ActivateGLFWWindow(packetWindow);
+				window = packetWindow;
+				shader = nullptr;
+				materialBound = false;
+				VAOID = 0;
+				++m_Stats.ContextSwitches;
+
+				UploadWindowData(window, batchIndex);
+				OORENDERER_PROFILE_GPU_BEGIN(window, s_PassNames[static_cast<std::size_t>(packet.Pass)]);
+			}
+			else if (packet.Pass != pass) {
+				OORENDERER_PROFILE_GPU_END(window);
+				OORENDERER_PROFILE_GPU_BEGIN(window, s_PassNames[static_cast<std::size_t>(packet.Pass)]);
+			}
+
+			setPass(packet.Pass);
+
+			// Sampler uniforms belong to the program, so a new program needs the textures set again
+			if (packet.Shader != shader) {
+				shader = packet.Shader;
+				shader->UseProgram();
+				materialBound = false;
+				++m_Stats.ProgramBinds;
+			}
+
+			if (!shader->IsInstanced()) {
+				shader->SetUniformMatrix4fv(shader->GetUniform("modelMatrix"_uniform), packet.ModelMatrix);
+			}
+
+			if (!materialBound || packet.MaterialKey != materialKey) {
+				packet.DrawnMesh->BindTextures(*shader);
+				materialKey = packet.MaterialKey;
+				materialBound = true;
+				++m_Stats.TextureBinds;
+			}
+			packet.DrawnMesh->SetMeshUniforms(*shader);
+
+			if (packet.VAOID != VAOID) {
+				GLStateCache::Current().BindVertexArray(packet.VAOID);
+				VAOID = packet.VAOID;
+				++m_Stats.VAOBinds;
+			}
+
+			++m_Stats.Draws;
+			if (batch.MultiDrawCount > 1) {
+				// Base instances are relative to the window's first instance
+				BindInstances(m_WindowFirstInstance);
+				GLStateCache::Current().BindBuffer(GL_DRAW_INDIRECT_BUFFER, m_WindowCommands.BufferID);
+				std::size_t commandOffset = m_WindowCommands.Offset + (batch.FirstCommand - m_WindowFirstCommand) * sizeof(DrawElementsIndirectCommand);
+				glMultiDrawElementsIndirect(GL_TRIANGLES, packet.DrawnMesh->m_IndexType, (void*)commandOffset, static_cast<GLsizei>(batch.MultiDrawCount), 0);
+				UnbindInstances();
+
+				++m_Stats.MultiDraws;
+				for (std::uint32_t i = 0; i < batch.MultiDrawCount; ++i) {
+					m_Stats.Instances += m_Batches[batchIndex + i].EntryCount;
+				}
+				continue;
+			}
+
+			if (shader->IsInstanced()) {
+				BindInstances(batch.FirstInstance);
+			}
+			packet.DrawnMesh->Draw(window, packet.LODLevel, static_cast<GLsizei>(batch.EntryCount));
+			if (shader->IsInstanced()) {
+				UnbindInstances();
+			}
+			m_Stats.Instances += batch.EntryCount;
+		}
+		leaveWindow();
+
+		// Revert context
+		Window::ActivateGLFWWindow(oldContext);
+
+		Clear();
+		return m_Stats.Draws;
+	}
+
+	void RenderQueue::Clear() {
+		m_Packets.clear();
+		m_SortEntries.clear();
+		m_Batches.clear();
+		m_Instances.clear();
+		m_IndirectCommands.clear();
+
+		// No key refers to the IDs anymore, so any that ran out may start again
+		if (m_DenseIDsExhausted) {
+			m_WindowIDs.clear();
+			m_ShaderIDs.clear();
+			m_MaterialIDs.clear();
+			m_OpaqueVAOIDs.clear();
+			m_TransparentVAOIDs.clear();
+			m_DenseIDsExhausted = false;
+		}
+	}
+
+	std::size_t RenderQueue::GetSize() const {
+		return m_Packets.size();
+	}
+
+	const RenderQueue::Stats& RenderQueue::GetStats() const {
+		return m_Stats;
+	}
+
+	std::uint64_t RenderQueue::MakeKey(const DrawPacket& packet, float depth) {
+		std::uint32_t windowID = GetDenseID(m_WindowIDs, reinterpret_cast<std::uintptr_t>(packet.Shader->GetGLFWWindow()), s_WindowBits);
+		std::uint32_t shaderID = GetDenseID(m_ShaderIDs, reinterpret_cast<std::uintptr_t>(packet.Shader), s_ShaderBits);
+		std::uint32_t materialID = GetDenseID(m_MaterialIDs, packet.MaterialKey, s_MaterialBits);
+
+		KeyPacker key;
+		key.Add(windowID, s_WindowBits).Add(static_cast<std::uint64_t>(packet.Pass), s_PassBits);
+		if (packet.Pass == RenderPass::Transparent) {
+			std::uint32_t maxDepth = (1u << s_TransparentDepthBits) - 1;
+			key.Add(maxDepth - QuantizeDepth(depth, s_TransparentDepthBits), s_TransparentDepthBits)
+				.Add(shaderID, s_ShaderBits)
+				.Add(materialID, s_MaterialBits)
+				.Add(GetDenseID(m_TransparentVAOIDs, packet.VAOID, s_TransparentVAOBits), s_TransparentVAOBits);
+		}
+		else {
+			key.Add(shaderID, s_ShaderBits)
+				.Add(materialID, s_MaterialBits)
+				.Add(GetDenseID(m_OpaqueVAOIDs, packet.VAOID, s_OpaqueVAOBits), s_OpaqueVAOBits)
+				.Add(packet.LODLevel, s_OpaqueLODBits)
+				.Add(QuantizeDepth(depth, s_OpaqueDepthBits), s_OpaqueDepthBits);
+		}
+		return key.Get();
+	}
+
+	void RenderQueue::BuildBatches() {
+		m_Batches.clear();
+		m_Instances.clear();
+		m_IndirectCommands.clear();
+
+		// Sorting put draws of the same mesh, level, program and pass next to each other, instanced programs draw each run at once
+		auto sameDraw = [](const DrawPacket& first, const DrawPacket& next) {
+			return first.DrawnMesh == next.DrawnMesh && first.Shader == next.Shader && first.LODLevel == next.LODLevel && first.Pass == next.Pass;
+		};
+
+		std::uint32_t entryCount = static_cast<std::uint32_t>(m_SortEntries.size());
+		for (std::uint32_t entry = 0; entry < entryCount;) {
+			const DrawPacket& first = m_Packets[m_SortEntries[entry].Packet];
+			Batch batch{ entry, 1, static_cast<std::uint32_t>(m_Instances.size()), 0 };
+
+			if (first.Shader->IsInstanced()) {
+				while (entry + batch.EntryCount < entryCount && sameDraw(first, m_Packets[m_SortEntries[entry + batch.EntryCount].Packet])) {
+					++batch.EntryCount;
+				}
+				// Layers are the same for every instance of a mesh, but not across the meshes of a multi draw
+				glm::uvec4 textureLayers = first.DrawnMesh->GetTextureLayers(first.Shader->GetGLFWWindow());
+				for (std::uint32_t i = 0; i < batch.EntryCount; ++i) {
+					m_Instances.push_back({ m_Packets[m_SortEntries[entry + i].Packet].ModelMatrix, textureLayers });
+				}
+			}
+
+			m_Batches.push_back(batch);
+			entry += batch.EntryCount;
+		}
+	}
+
+	void RenderQueue::BuildMultiDraws() {
+		// Each multi draw must need no state changes between its draws, nor uniforms particular to a mesh
+		auto canMultiDraw = [](const DrawPacket& packet) {
+			return packet.Shader->IsInstanced() && packet.DrawnMesh->IsPooledOn(packet.Shader->GetGLFWWindow()) && !packet.DrawnMesh->m_VertexLayout->QuantizesPositions;
+		};
+		auto sameState = [](const DrawPacket& first, const DrawPacket& next) {
+			return first.Shader == next.Shader && first.Pass == next.Pass && first.VAOID == next.VAOID
+				&& first.MaterialKey == next.MaterialKey;
+		};
+		auto packetOf = [this](const Batch& batch) -> const DrawPacket& {
+			return m_Packets[m_SortEntries[batch.FirstEntry].Packet];
+		};
+
+		GLFWwindow* window = nullptr;
+		std::uint32_t windowFirstInstance = 0;
+		bool windowMultiDraws = false;
+		for (std::size_t batchIndex = 0; batchIndex < m_Batches.size(); batchIndex += m_Batches[batchIndex].MultiDrawCount) {
+			Batch& batch = m_Batches[batchIndex];
+			const DrawPacket& first = packetOf(batch);
+			batch.FirstCommand = static_cast<std::uint32_t>(m_IndirectCommands.size());
+
+			if (first.Shader->GetGLFWWindow() != window) {
+				window = first.Shader->GetGLFWWindow();
+				windowFirstInstance = batch.FirstInstance;
+
+				// Contexts may differ in version, and no context is current yet to ask GLAD
+				windowMultiDraws = HasContextVersion(window, 4, 3);
+			}
+			if (!windowMultiDraws || !canMultiDraw(first)) {
+				continue;
+			}
+
+			std::size_t runEnd = batchIndex + 1;
+			while (runEnd < m_Batches.size() && canMultiDraw(packetOf(m_Batches[runEnd])) && sameState(first, packetOf(m_Batches[runEnd]))) {
+				++runEnd;
+			}
+			if (runEnd - batchIndex < 2) {
+				continue;
+			}
+
+			for (std::size_t i = batchIndex; i < runEnd; ++i) {
+				const Batch& drawn = m_Batches[i];
+				const DrawPacket& packet = packetOf(drawn);
+				Mesh::DrawRange range = packet.DrawnMesh->GetDrawRange(window, packet.LODLevel);
+				m_IndirectCommands.push_back({ static_cast<std::uint32_t>(range.IndexCount), drawn.EntryCount, range.FirstIndex, range.BaseVertex, drawn.FirstInstance - windowFirstInstance });
+			}
+			batch.MultiDrawCount = static_cast<std::uint32_t>(runEnd - batchIndex);
+		}
+	}
+
+	void RenderQueue::UploadWindowData(GLFWwindow* window, std::size_t firstBatch) {
+		// Windows lead the key, so a window's instances and commands are one run of each
+		std::size_t firstInstance = m_Batches[firstBatch].FirstInstance;
+		std::size_t endInstance = firstInstance;
+		std::size_t firstCommand = m_Batches[firstBatch].FirstCommand;
+		std::size_t endCommand = firstCommand;
+		for (std::size_t batchIndex = firstBatch; batchIndex < m_Batches.size(); ++batchIndex) {
+			const Batch& batch = m_Batches[batchIndex];
+			const DrawPacket& packet = m_Packets[m_SortEntries[batch.FirstEntry].Packet];
+			if (packet.Shader->GetGLFWWindow() != window) {
+				break;
+			}
+			if (packet.Shader->IsInstanced()) {
+				endInstance = batch.FirstInstance + batch.EntryCount;
+			}
+			if (batch.MultiDrawCount > 1) {
+				endCommand = batch.FirstCommand + batch.MultiDrawCount;
+			}
+		}
+
+		m_WindowFirstInstance = firstInstance;
+		m_WindowFirstCommand = firstCommand;
+
+		WindowBuffers& windowBuffers = m_WindowBuffers[window];
+		std::size_t instanceSize = (endInstance - firstInstance) * sizeof(InstanceData);
+		std::size_t commandSize = (endCommand - firstCommand) * sizeof(DrawElementsIndirectCommand);
+
+		if (HasContextVersion(window, 4, 4)) {
+			// Each Flush is a frame of the ring, replaced rather than overrun if this one outgrows it. Buffers deleted while in use live on until the GPU is done
+			std::size_t frameSize = instanceSize + commandSize + 2 * alignof(InstanceData);
+			if (!windowBuffers.Ring || windowBuffers.Ring->GetFrameSize() < frameSize) {
+				std::size_t ringFrameSize = windowBuffers.Ring ? windowBuffers.Ring->GetFrameSize() : s_InitialRingFrameSize;
+				while (ringFrameSize < frameSize) {
+					ringFrameSize *= 2;
+				}
+				windowBuffers.Ring = std::make_unique<RingBuffer>(window, ringFrameSize);
+			}
+
+			if (instanceSize) {
+				RingBuffer::Allocation instances = windowBuffers.Ring->Allocate(instanceSize, alignof(InstanceData));
+				std::memcpy(instances.Data, m_Instances.data() + firstInstance, instanceSize);
+				m_WindowInstances = { instances.BufferID, instances.Offset };
+			}
+			if (commandSize) {
+				RingBuffer::Allocation commands = windowBuffers.Ring->Allocate(commandSize, alignof(DrawElementsIndirectCommand));
+				std::memcpy(commands.Data, m_IndirectCommands.data() + firstCommand, commandSize);
+				m_WindowCommands = { commands.BufferID, commands.Offset };
+			}
+
+			windowBuffers.Ring->Commit();
+			return;
+		}
+
+		if (instanceSize) {
+			Upload(windowBuffers.Instances, GL_ARRAY_BUFFER, m_Instances.data() + firstInstance, instanceSize);
+		}
+		if (commandSize) {
+			Upload(windowBuffers.Commands, GL_DRAW_INDIRECT_BUFFER, m_IndirectCommands.data() + firstCommand, commandSize);
+		}
+		m_WindowInstances = { windowBuffers.Instances.BufferID, 0 };
+		m_WindowCommands = { windowBuffers.Commands.BufferID, 0 };
+	}
+
+	void RenderQueue::BindInstances(std::size_t firstInstance) {
+		// Attribute pointers are VAO state, so each batch points the bound VAO at its own matrices
+		std::size_t offset = m_WindowInstances.Offset + (firstInstance - m_WindowFirstInstance) * sizeof(InstanceData);
+		GLStateCache::Current().BindBuffer(GL_ARRAY_BUFFER, m_WindowInstances.BufferID);
+		for (GLuint column = 0; column < 4; ++column) {
+			GLuint location = ShaderProgram::InstanceMatrixLocation + column;
+			glEnableVertexAttribArray(location);
+			glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(offset + offsetof(InstanceData, ModelMatrix) + column * sizeof(glm::vec4)));
+			glVertexAttribDivisor(location, 1);
+		}
+
+		GLuint layersLocation = ShaderProgram::InstanceTextureLayersLocation;
+		glEnableVertexAttribArray(layersLocation);
+		glVertexAttribIPointer(layersLocation, 4, GL_UNSIGNED_INT, sizeof(InstanceData), (void*)(offset + offsetof(InstanceData, TextureLayers)));
+		glVertexAttribDivisor(layersLocation, 1);
+	}
+
+	void RenderQueue::UnbindInstances() {
+		// The VAO is the mesh's own, so draws outside the queue must not fetch from our stream buffer
+		for (GLuint location = ShaderProgram::InstanceTextureLayersLocation; location < ShaderProgram::InstanceMatrixLocation + 4; ++location) {
+			glDisableVertexAttribArray(location);
+		}
+	}
+
+	void RenderQueue::Upload(StreamBuffer& buffer, GLenum target, const void* data, std::size_t size) {
+		if (buffer.BufferID == 0) {
+			glGenBuffers(1, &buffer.BufferID);
+		}
+
+		// Respecifying the whole buffer lets the driver hand us fresh memory rather than wait on last frame's draws
+		buffer.Size = std::max(buffer.Size, size);
+		GLStateCache::Current().BindBuffer(target, buffer.BufferID);
+		glBufferData(target, buffer.Size, nullptr, GL_STREAM_DRAW);
+		glBufferSubData(target, 0, size, data);
+	}
+
+	std::uint32_t RenderQueue::GetDenseID(std::unordered_map<std::uint64_t, std::uint32_t>& ids, std::uint64_t value, unsigned int bits) {
+		auto idIt = ids.find(value);
+		if (idIt != ids.end()) {
+			return idIt->second;
+		}
+
+		// Out of IDs, the rest share the last until the IDs are handed out again once this queue is cleared.
+		// Only sorting suffers, binds are still skipped by comparing what is actually bound
+		std::uint32_t lastID = (std::uint32_t{ 1 } << bits) - 1;
+		if (ids.size() == lastID) {
+			m_DenseIDsExhausted = true;
+			return lastID;
+		}
+		std::uint32_t id = static_cast<std::uint32_t>(ids.size());
+		ids.emplace(value, id);
+		return id;
+	}
+
+	void RenderQueue::RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch) {
+		scratch.resize(entries.size());
+
+		// Histograms of every byte in one read of the keys
+		std::array<std::array<std::size_t, 256>, 8> counts{};
+		for (const SortEntry& entry : entries) {
+			for (unsigned int byte = 0; byte < 8; ++byte) {
+				++counts[byte][(entry.Key >> (byte * 8)) & 0xFF];
+			}
+		}
+
+		// Least significant byte first, each pass a stable counting sort. Bytes every key shares are skipped,
+		// with few windows, programs and materials the high bytes often are
+		for (unsigned int byte = 0; byte < 8; ++byte) {
+			std::array<std::size_t, 256>& offsets = counts[byte];
+			if (std::ranges::find(offsets, entries.size()) != offsets.end()) {
+				continue;
+			}
+
+			std::size_t offset = 0;
+			for (std::size_t& count : offsets) {
+				std::size_t bucketSize = count;
+				count = offset;
+				offset += bucketSize;
+			}
+			unsigned int shift = byte * 8;
+			for (const SortEntry& entry : entries) {
+				scratch[offsets[(entry.Key >> shift) & 0xFF]++] = entry;
+			}
+			entries.swap(scratch);
+		}
+	}
+
+} // OORenderer
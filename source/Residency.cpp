@@ -0,0 +1,72 @@
+#include "OORenderer/Residency.h"
+
+#include <LoggingAD/LoggingAD.h>
+
+namespace OORenderer {
+
+	std::size_t ResidencyStats::GetCPUBytes() const {
+		return MeshCPU.Bytes + TextureCPU.Bytes;
+	}
+
+	std::size_t ResidencyStats::GetGPUBytes() const {
+		std::size_t bytes = 0;
+		for (const auto& [shareGroup, usage] : MeshGPU) {
+			bytes += usage.Bytes;
+		}
+		for (const auto& [shareGroup, usage] : TextureGPU) {
+			bytes += usage.Bytes;
+		}
+		return bytes;
+	}
+
+	void Residency::SetDefaultPolicy(ResidencyPolicy policy) {
+		sm_DefaultPolicy.store(policy, std::memory_order_relaxed);
+	}
+
+	ResidencyPolicy Residency::GetDefaultPolicy() {
+		return sm_DefaultPolicy.load(std::memory_order_relaxed);
+	}
+
+	ResidencyStats Residency::GetStats() {
+		std::scoped_lock lock(sm_Mutex);
+		return sm_Stats;
+	}
+
+	void Residency::LogStats() {
+		ResidencyStats stats = GetStats();
+		LoggingAD::Trace("[OORenderer::Residency] CPU: {} bytes in {} meshes, {} bytes in {} textures",
+			stats.MeshCPU.Bytes, stats.MeshCPU.Count, stats.TextureCPU.Bytes, stats.TextureCPU.Count);
+
+		for (const auto& [shareGroup, usage] : stats.MeshGPU) {
+			LoggingAD::Trace("[OORenderer::Residency] Share group {}: {} bytes in {} mesh buffers", static_cast<const void*>(shareGroup), usage.Bytes, usage.Count);
+		}
+		for (const auto& [shareGroup, usage] : stats.TextureGPU) {
+			LoggingAD::Trace("[OORenderer::Residency] Share group {}: {} bytes in {} textures", static_cast<const void*>(shareGroup), usage.Bytes, usage.Count);
+		}
+	}
+
+	std::shared_ptr<void> Residency::Track(Asset asset, const ShareGroup* shareGroup, std::size_t bytes) {
+		{
+			std::scoped_lock lock(sm_Mutex);
+			ResidencyStats::Usage& usage = GetUsage(asset, shareGroup);
+			usage.Bytes += bytes;
+			usage.Count += 1;
+		}
+
+		// Nothing to own, the deleter is the point
+		return std::shared_ptr<void>(nullptr, [asset, shareGroup, bytes](void*) {
+			std::scoped_lock lock(sm_Mutex);
+			ResidencyStats::Usage& usage = GetUsage(asset, shareGroup);
+			usage.Bytes -= bytes;
+			usage.Count -= 1;
+		});
+	}
+
+	ResidencyStats::Usage& Residency::GetUsage(Asset asset, const ShareGroup* shareGroup) {
+		if (!shareGroup) {
+			return asset == Asset::Mesh ? sm_Stats.MeshCPU : sm_Stats.TextureCPU;
+		}
+		return asset == Asset::Mesh ? sm_Stats.MeshGPU[shareGroup] : sm_Stats.TextureGPU[shareGroup];
+	}
+
+} // OORenderer
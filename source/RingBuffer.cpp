@@ -0,0 +1,155 @@
+#include "OORenderer/RingBuffer.h"
+
+#include <algorithm>
+#include <utility>
+#include <LoggingAD/LoggingAD.h>
+
+#include "OORenderer/GLStateCache.h"
+
+namespace OORenderer {
+
+	static std::size_t AlignUp(std::size_t value, std::size_t alignment) {
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	RingBuffer::RingBuffer(const Window& window, std::size_t frameSize, unsigned int framesInFlight)
+		: RingBuffer(window.GetGLFWWindow(), frameSize, framesInFlight)
+	{}
+
+	RingBuffer::RingBuffer(GLFWwindow* window, std::size_t frameSize, unsigned int framesInFlight)
+		: m_Window(window), m_Fences(std::max(framesInFlight, 1u), nullptr)
+	{
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		Window::ActivateGLFWWindow(m_Window);
+
+		GLint uniformAlignment = 0;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+		m_UniformAlignment = std::max<std::size_t>(uniformAlignment, 16);
+
+		// Regions start uniform aligned, so alignments within a region hold in every region
+		m_FrameSize = AlignUp(frameSize, m_UniformAlignment);
+		std::size_t size = m_FrameSize * m_Fences.size();
+
+		GLStateCache& state = GLStateCache::Current();
+		glGenBuffers(1, &m_BufferID);
+		state.BindBuffer(GL_COPY_WRITE_BUFFER, m_BufferID);
+		if (GLAD_GL_VERSION_4_4) {
+			GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glBufferStorage(GL_COPY_WRITE_BUFFER, size, NULL, flags);
+			m_Mapped = static_cast<std::byte*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags));
+			if (!m_Mapped) {
+				LoggingAD::Warning("[OORenderer::RingBuffer] Failed to map buffer {} persistently, committing writes instead.", m_BufferID);
+				GLStateCache::ForgetBuffer(m_Window, m_BufferID);
+				glDeleteBuffers(1, &m_BufferID);
+				glGenBuffers(1, &m_BufferID);
+				state.BindBuffer(GL_COPY_WRITE_BUFFER, m_BufferID);
+			}
+		}
+		if (!m_Mapped) {
+			glBufferData(GL_COPY_WRITE_BUFFER, size, NULL, GL_STREAM_DRAW);
+			m_Staging.resize(size);
+		}
+
+		LoggingAD::Trace("[OORenderer::RingBuffer] Created {} ring buffer {} of {} frames of {} bytes on window {:#010x}",
+			m_Mapped ? "persistent" : "committed", m_BufferID, m_Fences.size(), m_FrameSize, reinterpret_cast<std::uintptr_t>(m_Window));
+
+		Window::ActivateGLFWWindow(oldContext);
+	}
+
+	RingBuffer::~RingBuffer() {
+		// Ensure we delete the correct buffer on the correct context
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		Window::ActivateGLFWWindow(m_Window);
+
+		for (GLsync fence : m_Fences) {
+			if (fence) {
+				glDeleteSync(fence);
+			}
+		}
+		if (m_Mapped) {
+			GLStateCache::Current().BindBuffer(GL_COPY_WRITE_BUFFER, m_BufferID);
+			glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+		}
+		GLStateCache::ForgetBuffer(m_Window, m_BufferID);
+		glDeleteBuffers(1, &m_BufferID);
+
+		Window::ActivateGLFWWindow(oldContext);
+	}
+
+	RingBuffer::Allocation RingBuffer::Allocate(std::size_t size, std::size_t alignment) {
+		std::size_t offset = AlignUp(m_Offset, alignment);
+		if (offset + size > m_FrameSize) {
+			return {};
+		}
+		m_Offset = offset + size;
+
+		std::size_t bufferOffset = m_Frame * m_FrameSize + offset;
+		std::byte* base = m_Mapped ? m_Mapped : m_Staging.data();
+		return { base + bufferOffset, m_BufferID, bufferOffset, size };
+	}
+
+	void RingBuffer::Commit() {
+		if (m_Mapped || m_CommittedOffset == m_Offset) {
+			return;
+		}
+
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		Window::ActivateGLFWWindow(m_Window);
+
+		// Only this region is written, which no draw still in flight reads
+		std::size_t bufferOffset = m_Frame * m_FrameSize + m_CommittedOffset;
+		GLStateCache::Current().BindBuffer(GL_COPY_WRITE_BUFFER, m_BufferID);
+		glBufferSubData(GL_COPY_WRITE_BUFFER, bufferOffset, m_Offset - m_CommittedOffset, m_Staging.data() + bufferOffset);
+		m_CommittedOffset = m_Offset;
+
+		Window::ActivateGLFWWindow(oldContext);
+	}
+
+	void RingBuffer::NextFrame() {
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		Window::ActivateGLFWWindow(m_Window);
+
+		Commit();
+		m_Fences[m_Frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		m_Frame = (m_Frame + 1) % m_Fences.size();
+		m_Offset = 0;
+		m_CommittedOffset = 0;
+
+		if (GLsync fence = std::exchange(m_Fences[m_Frame], nullptr)) {
+			// Only flush once we know we'll have to wait, the fence must reach the GPU for the wait to end
+			if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+				++m_WaitCount;
+				while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000) == GL_TIMEOUT_EXPIRED) {}
+			}
+			glDeleteSync(fence);
+		}
+
+		Window::ActivateGLFWWindow(oldContext);
+	}
+
+	bool RingBuffer::IsPersistent() const {
+		return m_Mapped != nullptr;
+	}
+
+	std::size_t RingBuffer::GetUniformAlignment() const {
+		return m_UniformAlignment;
+	}
+
+	std::size_t RingBuffer::GetFrameSize() const {
+		return m_FrameSize;
+	}
+
+	std::size_t RingBuffer::GetWaitCount() const {
+		return m_WaitCount;
+	}
+
+	unsigned int RingBuffer::GetBufferID() const {
+		return m_BufferID;
+	}
+
+	GLFWwindow* RingBuffer::GetGLFWWindow() const {
+		return m_Window;
+	}
+
+} // OORenderer
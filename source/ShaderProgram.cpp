@@ -3,12 +3,34 @@
 
 #include <iostream>
 #include <fstream>
+#include <iterator>
+#include <utility>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <LoggingAD/LoggingAD.h>
 
+#include "OORenderer/FrameUniforms.h"
+#include "OORenderer/CameraUniforms.h"
+#include "OORenderer/ShareGroup.h"
+#include "OORenderer/Profiler.h"
+#include "OORenderer/GLStateCache.h"
+#include "ProgramBinaryCache.h"
+
 namespace OORenderer {
 
+	// Expects to be called on the program's context, after a successful link
+	static std::optional<ProgramBinaryCache::Binary> RetrieveProgramBinary(GLuint programID) {
+		GLint length = 0;
+		glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0) {
+			return std::nullopt;
+		}
+
+		ProgramBinaryCache::Binary binary{ .Data = std::vector<char>(length) };
+		glGetProgramBinary(programID, length, NULL, &binary.Format, binary.Data.data());
+		return binary;
+	}
+
 	ShaderProgram::ShaderProgram(const Window& window)
 		: m_Window(window.GetGLFWWindow())
 	{
@@ -38,10 +60,28 @@ namespace OORenderer {
 
 	bool ShaderProgram::RegisterShader(const char* shaderSource, int shaderType) {
 
+		// Keep the source, it keys the program binary cache
+		m_ShaderSources[shaderType] = shaderSource;
+
+		// Compilation waits for LinkProgram if a cached binary or a program shared from another window may make it unnecessary
+		ShareGroup* shareGroup = ShareGroup::Of(m_Window);
+		if (ProgramBinaryCache::IsEnabled() || (shareGroup && shareGroup->GetWindows().size() > 1)) {
+			return true;
+		}
+
 		// Ensure we're on the correct context
 		GLFWwindow* oldContext = glfwGetCurrentContext();
 		Window::ActivateGLFWWindow(m_Window);
 
+		bool success = CompileShader(shaderSource, shaderType);
+
+		// Revert context
+		Window::ActivateGLFWWindow(oldContext);
+		return success;
+	}
+
+	bool ShaderProgram::CompileShader(const char* shaderSource, int shaderType) {
+		// Expects to be called on the correct context
 		unsigned int shaderID = glCreateShader(shaderType);
 		glShaderSource(shaderID, 1, &shaderSource, NULL);
 		glCompileShader(shaderID);
@@ -55,16 +95,12 @@ namespace OORenderer {
 			glGetShaderInfoLog(shaderID, 512, NULL, infoLog);
 			LoggingAD::Error("[OORenderer::ShaderProgram::Compilation] Compilation failed of shader of type {}. With log: {}", shaderType, std::string(infoLog));
 			LoggingAD::Info("[OORenderer::ShaderProgram::Compilation] Compilation failed of shader with source: {}", std::string(shaderSource));
-			// Revert context
-			Window::ActivateGLFWWindow(oldContext);
+			glDeleteShader(shaderID);
 			return false;
 		}
 
 		glAttachShader(m_ProgramID, shaderID);
 		m_RegisteredShaders[shaderType] = shaderID;
-
-		// Revert context
-		Window::ActivateGLFWWindow(oldContext);
 		return true;
 	}
 
@@ -82,11 +118,50 @@ namespace OORenderer {
 	}
 
 	void ShaderProgram::LinkProgram() {
+		OORENDERER_PROFILE_SCOPE("ShaderProgram::LinkProgram");
 
 		// Ensure we're on the correct context
 		GLFWwindow* oldContext = glfwGetCurrentContext();
 		Window::ActivateGLFWWindow(m_Window);
 
+		// Programs are compiled once per share group, link ours from the binary of one built from the same sources if there is one
+		ShareGroup* shareGroup = ShareGroup::Of(m_Window);
+		std::uint64_t sourceKey = HashShaderSources();
+		bool shareBinary = shareGroup && !m_ShaderSources.empty() && ProgramBinaryCache::IsSupportedOnCurrentContext();
+		if (shareBinary) {
+			if (const ShareGroup::ProgramBinary* sharedBinary = shareGroup->FindProgramBinary(sourceKey)) {
+				if (LinkFromBinary(sharedBinary->Format, sharedBinary->Data)) {
+					LoggingAD::Trace("[OORenderer::ShaderProgram::Linking] Linked program {} from the binary of a program in its share group.", m_ProgramID);
+					Window::ActivateGLFWWindow(oldContext);
+					return;
+				}
+			}
+		}
+
+		// Try the binary cache next, falling back to compiling from source if the binary is missing or stale
+		std::optional<std::uint64_t> cacheKey;
+		if (!m_ShaderSources.empty() && ProgramBinaryCache::IsUsableOnCurrentContext()) {
+			cacheKey = ProgramBinaryCache::BuildKey(m_ShaderSources);
+			if (LinkFromBinaryCache(*cacheKey)) {
+				if (shareBinary) {
+					ShareBinary(sourceKey, std::nullopt);
+				}
+				Window::ActivateGLFWWindow(oldContext);
+				return;
+			}
+		}
+
+		// Compile anything RegisterShader left for us
+		for (const auto& [type, source] : m_ShaderSources) {
+			if (!m_RegisteredShaders.contains(type)) {
+				CompileShader(source.c_str(), type);
+			}
+		}
+
+		if (cacheKey || shareBinary) {
+			glProgramParameteri(m_ProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		}
+
 		for (auto [type, id] : m_RegisteredShaders) {
 			glAttachShader(m_ProgramID, id);
 			LoggingAD::Trace("[OORenderer::ShaderProgram::Linking] Attaching shader of type: {} with ID: {} to window: {:#010x}", type, id, reinterpret_cast<std::uintptr_t>(m_Window));
@@ -101,23 +176,127 @@ namespace OORenderer {
 			glGetProgramInfoLog(m_ProgramID, 512, NULL, infoLog);
 			LoggingAD::Error("[OORenderer::ShaderProgram::Linking] Linking shader program with id {} to window {:#010x} failed. With log: {}", m_ProgramID, reinterpret_cast<std::uintptr_t>(m_Window), std::string(infoLog));
 		}
+		else {
+			FinishLink();
+
+			if (shareBinary) {
+				ShareBinary(sourceKey, cacheKey);
+			}
+			else if (cacheKey) {
+				StoreInBinaryCache(*cacheKey);
+			}
+		}
 
 		// Shaders have been used no need to hold onto them
 		for (auto& [type, id] : m_RegisteredShaders) {
 			glDeleteShader(id);
 		}
+		m_RegisteredShaders.clear();
 
 		// Revert context
 		Window::ActivateGLFWWindow(oldContext);
 	}
 
+	bool ShaderProgram::LinkFromBinary(GLenum format, const std::vector<char>& data) {
+		// Expects to be called on the correct context
+		glProgramBinary(m_ProgramID, format, data.data(), static_cast<GLsizei>(data.size()));
+
+		// The driver may reject binaries it made itself, e.g. after a settings change, so check before trusting it
+		int success;
+		glGetProgramiv(m_ProgramID, GL_LINK_STATUS, &success);
+		if (!success) {
+			return false;
+		}
+
+		// Anything compiled eagerly is no longer needed
+		for (auto& [type, id] : m_RegisteredShaders) {
+			glDeleteShader(id);
+		}
+		m_RegisteredShaders.clear();
+
+		FinishLink();
+		return true;
+	}
+
+	bool ShaderProgram::LinkFromBinaryCache(std::uint64_t cacheKey) {
+		// Expects to be called on the correct context
+		std::optional<ProgramBinaryCache::Binary> binary = ProgramBinaryCache::Load(cacheKey);
+		if (!binary) {
+			return false;
+		}
+
+		if (!LinkFromBinary(binary->Format, binary->Data)) {
+			LoggingAD::Trace("[OORenderer::ShaderProgram::BinaryCache] Cached binary for program {} rejected by the driver, compiling from source.", m_ProgramID);
+			return false;
+		}
+
+		LoggingAD::Trace("[OORenderer::ShaderProgram::BinaryCache] Loaded program {} from cached binary.", m_ProgramID);
+		return true;
+	}
+
+	void ShaderProgram::StoreInBinaryCache(std::uint64_t cacheKey) {
+		if (std::optional<ProgramBinaryCache::Binary> binary = RetrieveProgramBinary(m_ProgramID)) {
+			ProgramBinaryCache::Store(cacheKey, *binary);
+		}
+	}
+
+	void ShaderProgram::ShareBinary(std::uint64_t sourceKey, std::optional<std::uint64_t> cacheKey) {
+		// Retrieved once for both the share group and the on disk cache
+		std::optional<ProgramBinaryCache::Binary> binary = RetrieveProgramBinary(m_ProgramID);
+		if (!binary) {
+			return;
+		}
+
+		if (cacheKey) {
+			ProgramBinaryCache::Store(*cacheKey, *binary);
+		}
+		ShareGroup::Of(m_Window)->AddProgramBinary(sourceKey, ShareGroup::ProgramBinary{ .Format = binary->Format, .Data = std::move(binary->Data) });
+	}
+
+	std::uint64_t ShaderProgram::HashShaderSources() const {
+		std::uint64_t hash = FNV1a64OffsetBasis;
+		for (const auto& [type, source] : m_ShaderSources) {
+			hash = HashFNV1a64(std::to_string(type), hash);
+			hash = HashFNV1a64(source, hash);
+		}
+		return hash;
+	}
+
+	void ShaderProgram::FinishLink() {
+		ReflectUniforms();
+
+		// Programs using the shared per frame block all read it from the same binding point
+		if (auto frameBlockIt = m_UniformBlocks.find(FrameUniforms::BlockID); frameBlockIt != m_UniformBlocks.end()) {
+			glUniformBlockBinding(m_ProgramID, frameBlockIt->second.Index, FrameUniforms::BlockBinding);
+			frameBlockIt->second.Binding = FrameUniforms::BlockBinding;
+		}
+		if (auto camerasBlockIt = m_UniformBlocks.find(CameraUniforms::BlockID); camerasBlockIt != m_UniformBlocks.end()) {
+			glUniformBlockBinding(m_ProgramID, camerasBlockIt->second.Index, CameraUniforms::BlockBinding);
+			camerasBlockIt->second.Binding = CameraUniforms::BlockBinding;
+		}
+
+		GLint instanceMatrixLocation = glGetAttribLocation(m_ProgramID, "instanceModelMatrix");
+		m_Instanced = instanceMatrixLocation == static_cast<GLint>(InstanceMatrixLocation);
+		if (instanceMatrixLocation != -1 && !m_Instanced) {
+			LoggingAD::Warning("[OORenderer::ShaderProgram::FinishLink] Program {} has instanceModelMatrix at location {} rather than {}, it won't be drawn instanced.", m_ProgramID, instanceMatrixLocation, InstanceMatrixLocation);
+		}
+	}
+
+	void ShaderProgram::EnableBinaryCache(std::filesystem::path directory) {
+		ProgramBinaryCache::Enable(directory);
+	}
+
+	void ShaderProgram::DisableBinaryCache() {
+		ProgramBinaryCache::Disable();
+	}
+
 	void ShaderProgram::UseProgram() {
 		// We permit enabling a shader program for a different context than the active context
 		// Ensure we're on the correct context
 		GLFWwindow* oldContext = glfwGetCurrentContext();
 		Window::ActivateGLFWWindow(m_Window);
 
-		glUseProgram(m_ProgramID);
+		GLStateCache::Current().UseProgram(m_ProgramID);
 
 		// Revert context
 		Window::ActivateGLFWWindow(oldContext);
@@ -127,4 +306,160 @@ namespace OORenderer {
 		return m_Window;
 	}
 
+	bool ShaderProgram::IsInstanced() const {
+		return m_Instanced;
+	}
+
+	ShaderProgram::Uniform ShaderProgram::GetUniform(UniformID uniformID) const {
+		auto uniformIt = m_Uniforms.find(uniformID);
+		if (uniformIt == m_Uniforms.end()) {
+			return {};
+		}
+		return uniformIt->second;
+	}
+
+	ShaderProgram::Uniform ShaderProgram::GetUniform(const GLchar* uniformName) const {
+		return GetUniform(HashUniformName(uniformName));
+	}
+
+	const ShaderProgram::UniformBlock* ShaderProgram::GetUniformBlock(UniformID blockID) const {
+		auto blockIt = m_UniformBlocks.find(blockID);
+		if (blockIt == m_UniformBlocks.end()) {
+			return nullptr;
+		}
+		return &blockIt->second;
+	}
+
+	const std::unordered_map<ShaderProgram::UniformID, ShaderProgram::UniformBlock>& ShaderProgram::GetUniformBlocks() const {
+		return m_UniformBlocks;
+	}
+
+	bool ShaderProgram::SetUniformBlockBinding(UniformID blockID, GLuint binding) {
+		auto blockIt = m_UniformBlocks.find(blockID);
+		if (blockIt == m_UniformBlocks.end()) {
+			return false;
+		}
+
+		// Ensure we're on the correct context
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		Window::ActivateGLFWWindow(m_Window);
+
+		glUniformBlockBinding(m_ProgramID, blockIt->second.Index, binding);
+		blockIt->second.Binding = binding;
+
+		// Revert context
+		Window::ActivateGLFWWindow(oldContext);
+		return true;
+	}
+
+	void ShaderProgram::ReflectUniforms() {
+		// Expects to be called on the correct context, from LinkProgram
+		m_Uniforms.clear();
+		m_UniformBlocks.clear();
+
+		if (GLAD_GL_VERSION_4_3) {
+			// Program interface queries, everything we need in one call per resource
+			GLint numUniforms = 0;
+			glGetProgramInterfaceiv(m_ProgramID, GL_UNIFORM, GL_ACTIVE_RESOURCES, &numUniforms);
+
+			const GLenum uniformProperties[] = { GL_TYPE, GL_ARRAY_SIZE, GL_LOCATION, GL_BLOCK_INDEX, GL_NAME_LENGTH };
+			for (GLint i = 0; i < numUniforms; ++i) {
+				GLint values[std::size(uniformProperties)];
+				glGetProgramResourceiv(m_ProgramID, GL_UNIFORM, i, std::size(uniformProperties), uniformProperties, std::size(values), NULL, values);
+
+				// Block members have no location, they're set through their block's buffer
+				if (values[3] != -1) {
+					continue;
+				}
+
+				std::string name(values[4], '\0');
+				glGetProgramResourceName(m_ProgramID, GL_UNIFORM, i, values[4], NULL, name.data());
+				name.resize(values[4] - 1); // Drop the null terminator
+
+				AddReflectedUniform(name, { .Location = values[2], .Type = static_cast<GLenum>(values[0]), .ArraySize = values[1] });
+			}
+
+			GLint numBlocks = 0;
+			glGetProgramInterfaceiv(m_ProgramID, GL_UNIFORM_BLOCK, GL_ACTIVE_RESOURCES, &numBlocks);
+
+			const GLenum blockProperties[] = { GL_BUFFER_DATA_SIZE, GL_BUFFER_BINDING, GL_NAME_LENGTH };
+			for (GLint i = 0; i < numBlocks; ++i) {
+				GLint values[std::size(blockProperties)];
+				glGetProgramResourceiv(m_ProgramID, GL_UNIFORM_BLOCK, i, std::size(blockProperties), blockProperties, std::size(values), NULL, values);
+
+				std::string name(values[2], '\0');
+				glGetProgramResourceName(m_ProgramID, GL_UNIFORM_BLOCK, i, values[2], NULL, name.data());
+				name.resize(values[2] - 1);
+
+				AddReflectedUniformBlock(name, { .Index = static_cast<GLuint>(i), .DataSize = values[0], .Binding = values[1] });
+			}
+		}
+		else {
+			// Pre 4.3 we have to query piece by piece, this only happens once per link so it's fine
+			GLint numUniforms = 0;
+			GLint maxNameLength = 0;
+			glGetProgramiv(m_ProgramID, GL_ACTIVE_UNIFORMS, &numUniforms);
+			glGetProgramiv(m_ProgramID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+			std::string name(maxNameLength, '\0');
+			for (GLint i = 0; i < numUniforms; ++i) {
+				GLsizei nameLength = 0;
+				GLint arraySize = 0;
+				GLenum type = GL_NONE;
+				glGetActiveUniform(m_ProgramID, i, maxNameLength, &nameLength, &arraySize, &type, name.data());
+
+				std::string uniformName = name.substr(0, nameLength);
+				GLint location = glGetUniformLocation(m_ProgramID, uniformName.c_str());
+				if (location == -1) {
+					continue;
+				}
+
+				AddReflectedUniform(uniformName, { .Location = location, .Type = type, .ArraySize = arraySize });
+			}
+
+			GLint numBlocks = 0;
+			GLint maxBlockNameLength = 0;
+			glGetProgramiv(m_ProgramID, GL_ACTIVE_UNIFORM_BLOCKS, &numBlocks);
+			glGetProgramiv(m_ProgramID, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxBlockNameLength);
+
+			std::string blockName(maxBlockNameLength, '\0');
+			for (GLint i = 0; i < numBlocks; ++i) {
+				GLsizei nameLength = 0;
+				glGetActiveUniformBlockName(m_ProgramID, i, maxBlockNameLength, &nameLength, blockName.data());
+
+				UniformBlock block{ .Index = static_cast<GLuint>(i) };
+				glGetActiveUniformBlockiv(m_ProgramID, i, GL_UNIFORM_BLOCK_DATA_SIZE, &block.DataSize);
+				glGetActiveUniformBlockiv(m_ProgramID, i, GL_UNIFORM_BLOCK_BINDING, &block.Binding);
+
+				AddReflectedUniformBlock(blockName.substr(0, nameLength), block);
+			}
+		}
+
+		LoggingAD::Trace("[OORenderer::ShaderProgram::Reflection] Program {} has {} active uniforms and {} active uniform blocks", m_ProgramID, m_Uniforms.size(), m_UniformBlocks.size());
+	}
+
+	void ShaderProgram::AddReflectedUniform(std::string name, const Uniform& uniform) {
+		UniformID uniformID = HashUniformName(name);
+		if (m_Uniforms.contains(uniformID)) {
+			LoggingAD::Warning("[OORenderer::ShaderProgram::Reflection] Uniform name hash collision on {} in program {}, the uniform will not be settable.", name, m_ProgramID);
+			return;
+		}
+		m_Uniforms[uniformID] = uniform;
+
+		// Arrays are reported as "name[0]", allow "name" too as glGetUniformLocation does
+		if (name.ends_with("[0]")) {
+			name.resize(name.size() - 3);
+			m_Uniforms.try_emplace(HashUniformName(name), uniform);
+		}
+	}
+
+	void ShaderProgram::AddReflectedUniformBlock(const std::string& name, const UniformBlock& block) {
+		UniformID blockID = HashUniformName(name);
+		if (m_UniformBlocks.contains(blockID)) {
+			LoggingAD::Warning("[OORenderer::ShaderProgram::Reflection] Uniform block name hash collision on {} in program {}, the block will not be bindable.", name, m_ProgramID);
+			return;
+		}
+		m_UniformBlocks[blockID] = block;
+	}
+
 } // OOrenderer
\ No newline at end of file
@@ -1,153 +1,163 @@
 
 #include "OORenderer/ShaderProgram.h"
 
+#include "OORenderer/GLStateCache.h"
+
 namespace OORenderer {
 
 	template<typename... TArgs>
-	void ShaderProgram::SetUniformHelper(const GLchar* uniformName, void (*oglUniformFunction)(GLint, TArgs...), TArgs... args) {
+	void ShaderProgram::SetUniformHelper(const Uniform& uniform, void (*oglProgramUniformFunction)(GLuint, GLint, TArgs...), void (*oglUniformFunction)(GLint, TArgs...), std::type_identity_t<TArgs>... args) {
+		if (!uniform.IsValid()) {
+			return;
+		}
+
 		// We permit setting a uniform for a shader program in a different context than the active context
 		// Ensure we're on the correct context
 		GLFWwindow* oldContext = glfwGetCurrentContext();
 		Window::ActivateGLFWWindow(m_Window);
 
-		GLint uniformLocation = glGetUniformLocation(m_ProgramID, uniformName);
-		glUseProgram(m_ProgramID);
-		oglUniformFunction(uniformLocation, args...);
+		if (GLAD_GL_VERSION_4_1) {
+			oglProgramUniformFunction(m_ProgramID, uniform.Location, args...);
+		}
+		else {
+			GLStateCache::Current().UseProgram(m_ProgramID);
+			oglUniformFunction(uniform.Location, args...);
+		}
 
 		// Revert context
 		Window::ActivateGLFWWindow(oldContext);
 	}
 
 	void ShaderProgram::SetUniform1f(const GLchar* uniformName, const float v0) {
-		SetUniformHelper(uniformName, glUniform1f, v0);
+		SetUniform1f(GetUniform(uniformName), v0);
 	}
 
 	void ShaderProgram::SetUniform2f(const GLchar* uniformName, const float v0, const float v1) {
-		SetUniformHelper(uniformName, glUniform2f, v0, v1);
+		SetUniform2f(GetUniform(uniformName), v0, v1);
 	}
 
 	void ShaderProgram::SetUniform3f(const GLchar* uniformName, const float v0, const float v1, const float v2) {
-		SetUniformHelper(uniformName, glUniform3f, v0, v1, v2);
+		SetUniform3f(GetUniform(uniformName), v0, v1, v2);
 	}
 
 	void ShaderProgram::SetUniform4f(const GLchar* uniformName, const float v0, const float v1, const float v2, const float v3) {
-		SetUniformHelper(uniformName, glUniform4f, v0, v1, v2, v3);
+		SetUniform4f(GetUniform(uniformName), v0, v1, v2, v3);
 	}
 
 	void ShaderProgram::SetUniform1i(const GLchar* uniformName, const int v0) {
-		SetUniformHelper(uniformName, glUniform1i, v0);
+		SetUniform1i(GetUniform(uniformName), v0);
 	}
 
 	void ShaderProgram::SetUniform2i(const GLchar* uniformName, const int v0, const int v1) {
-		SetUniformHelper(uniformName, glUniform2i, v0, v1);
+		SetUniform2i(GetUniform(uniformName), v0, v1);
 	}
 
 	void ShaderProgram::SetUniform3i(const GLchar* uniformName, const int v0, const int v1, const int v2) {
-		SetUniformHelper(uniformName, glUniform3i, v0, v1, v2);
+		SetUniform3i(GetUniform(uniformName), v0, v1, v2);
 	}
 
 	void ShaderProgram::SetUniform4i(const GLchar* uniformName, const int v0, const int v1, const int v2, const int v3) {
-		SetUniformHelper(uniformName, glUniform4i, v0, v1, v2, v3);
+		SetUniform4i(GetUniform(uniformName), v0, v1, v2, v3);
 	}
 
 	void ShaderProgram::SetUniform1ui(const GLchar* uniformName, const unsigned int v0) {
-		SetUniformHelper(uniformName, glUniform1ui, v0);
+		SetUniform1ui(GetUniform(uniformName), v0);
 	}
 
 	void ShaderProgram::SetUniform2ui(const GLchar* uniformName, const unsigned int v0, const unsigned int v1) {
-		SetUniformHelper(uniformName, glUniform2ui, v0, v1);
+		SetUniform2ui(GetUniform(uniformName), v0, v1);
 	}
 
 	void ShaderProgram::SetUniform3ui(const GLchar* uniformName, const unsigned int v0, const unsigned int v1, const unsigned int v2) {
-		SetUniformHelper(uniformName, glUniform3ui, v0, v1, v2);
+		SetUniform3ui(GetUniform(uniformName), v0, v1, v2);
 	}
 
 	void ShaderProgram::SetUniform4ui(const GLchar* uniformName, const unsigned int v0, const unsigned int v1, const unsigned int v2, const unsigned int v3) {
-		SetUniformHelper(uniformName, glUniform4ui, v0, v1, v2, v3);
+		SetUniform4ui(GetUniform(uniformName), v0, v1, v2, v3);
 	}
 
 	void ShaderProgram::SetUniform1fv(const GLchar* uniformName, const float* value) {
-		SetUniformHelper(uniformName, glUniform1fv, 1, value);
+		SetUniform1fv(GetUniform(uniformName), value);
 	}
 
 	void ShaderProgram::SetUniform2fv(const GLchar* uniformName, const float* value) {
-		SetUniformHelper(uniformName, glUniform2fv, 2, value);
+		SetUniform2fv(GetUniform(uniformName), value);
 	}
 
 	void ShaderProgram::SetUniform3fv(const GLchar* uniformName, const float* value) {
-		SetUniformHelper(uniformName, glUniform3fv, 3, value);
+		SetUniform3fv(GetUniform(uniformName), value);
 	}
 
 	void ShaderProgram::SetUniform4fv(const GLchar* uniformName, const float* value) {
-		SetUniformHelper(uniformName, glUniform4fv, 4, value);
+		SetUniform4fv(GetUniform(uniformName), value);
 	}
 
 	void ShaderProgram::SetUniform1iv(const GLchar* uniformName, const int* value) {
-		SetUniformHelper(uniformName, glUniform1iv, 1, value);
+		SetUniform1iv(GetUniform(uniformName), value);
 	}
 
 	void ShaderProgram::SetUniform2iv(const GLchar* uniformName, const int* value) {
-		SetUniformHelper(uniformName, glUniform2iv, 2, value);
+		SetUniform2iv(GetUniform(uniformName), value);
 	}
 
 	void ShaderProgram::SetUniform3iv(const GLchar* uniformName, const int* value) {
-		SetUniformHelper(uniformName, glUniform3iv, 3, value);
+		SetUniform3iv(GetUniform(uniformName), value);
 	}
 
 	void ShaderProgram::SetUniform4iv(const GLchar* uniformName, const int* value) {
-		SetUniformHelper(uniformName, glUniform4iv, 4, value);
+		SetUniform4iv(GetUniform(uniformName), value);
 	}
 
 	void ShaderProgram::SetUniform1iuv(const GLchar* uniformName, const unsigned int* value) {
-		SetUniformHelper(uniformName, glUniform1uiv, 1, value);
+		SetUniform1iuv(GetUniform(uniformName), value);
 	}
 
 	void ShaderProgram::SetUniform2iuv(const GLchar* uniformName, const unsigned int* value) {
-		SetUniformHelper(uniformName, glUniform2uiv, 2, value);
+		SetUniform2iuv(GetUniform(uniformName), value);
 	}
 
 	void ShaderProgram::SetUniform3iuv(const GLchar* uniformName, const unsigned int* value) {
-		SetUniformHelper(uniformName, glUniform3uiv, 3, value);
+		SetUniform3iuv(GetUniform(uniformName), value);
 	}
 
 	void ShaderProgram::SetUniform4iuv(const GLchar* uniformName, const unsigned int* value) {
-		SetUniformHelper(uniformName, glUniform4uiv, 4, value);
+		SetUniform4iuv(GetUniform(uniformName), value);
 	}
 
 	void ShaderProgram::SetUniformMatrix2fv(const GLchar* uniformName, const float* value, const bool transpose) {
-		SetUniformHelper(uniformName, glUniformMatrix2fv, (GLint)1, (GLboolean)transpose, value);
+		SetUniformMatrix2fv(GetUniform(uniformName), value, transpose);
 	}
 
 	void ShaderProgram::SetUniformMatrix3fv(const GLchar* uniformName, const float* value, const bool transpose) {
-		SetUniformHelper(uniformName, glUniformMatrix3fv, (GLint)1, (GLboolean)transpose, value);
+		SetUniformMatrix3fv(GetUniform(uniformName), value, transpose);
 	}
 
 	void ShaderProgram::SetUniformMatrix4fv(const GLchar* uniformName, const float* value, const bool transpose) {
-		SetUniformHelper(uniformName, glUniformMatrix4fv, (GLint)1, (GLboolean)transpose, value);
+		SetUniformMatrix4fv(GetUniform(uniformName), value, transpose);
 	}
 
 	void ShaderProgram::SetUniformMatrix2x3fv(const GLchar* uniformName, const float* value, const bool transpose) {
-		SetUniformHelper(uniformName, glUniformMatrix2x3fv, (GLint)1, (GLboolean)transpose, value);
+		SetUniformMatrix2x3fv(GetUniform(uniformName), value, transpose);
 	}
 
 	void ShaderProgram::SetUniformMatrix3x2fv(const GLchar* uniformName, const float* value, const bool transpose) {
-		SetUniformHelper(uniformName, glUniformMatrix3x2fv, (GLint)1, (GLboolean)transpose, value);
+		SetUniformMatrix3x2fv(GetUniform(uniformName), value, transpose);
 	}
 
 	void ShaderProgram::SetUniformMatrix2x4fv(const GLchar* uniformName, const float* value, const bool transpose) {
-		SetUniformHelper(uniformName, glUniformMatrix2x4fv, (GLint)1, (GLboolean)transpose, value);
+		SetUniformMatrix2x4fv(GetUniform(uniformName), value, transpose);
 	}
 
 	void ShaderProgram::SetUniformMatrix4x2fv(const GLchar* uniformName, const float* value, const bool transpose) {
-		SetUniformHelper(uniformName, glUniformMatrix4x2fv, (GLint)1, (GLboolean)transpose, value);
+		SetUniformMatrix4x2fv(GetUniform(uniformName), value, transpose);
 	}
 
 	void ShaderProgram::SetUniformMatrix3x4fv(const GLchar* uniformName, const float* value, const bool transpose) {
-		SetUniformHelper(uniformName, glUniformMatrix3x4fv, (GLint)1, (GLboolean)transpose, value);
+		SetUniformMatrix3x4fv(GetUniform(uniformName), value, transpose);
 	}
 
 	void ShaderProgram::SetUniformMatrix4x3fv(const GLchar* uniformName, const float* value, const bool transpose) {
-		SetUniformHelper(uniformName, glUniformMatrix4x3fv, (GLint)1, (GLboolean)transpose, value);
+		SetUniformMatrix4x3fv(GetUniform(uniformName), value, transpose);
 	}
 
 	void ShaderProgram::SetUniform2fv(const GLchar* uniformName, const glm::vec2& value) {
@@ -174,4 +184,160 @@ namespace OORenderer {
 		SetUniformMatrix4fv(uniformName, &value[0][0], transpose);
 	}
 
+	void ShaderProgram::SetUniform1f(const Uniform& uniform, const float v0) {
+		SetUniformHelper(uniform, glProgramUniform1f, glUniform1f, v0);
+	}
+
+	void ShaderProgram::SetUniform2f(const Uniform& uniform, const float v0, const float v1) {
+		SetUniformHelper(uniform, glProgramUniform2f, glUniform2f, v0, v1);
+	}
+
+	void ShaderProgram::SetUniform3f(const Uniform& uniform, const float v0, const float v1, const float v2) {
+		SetUniformHelper(uniform, glProgramUniform3f, glUniform3f, v0, v1, v2);
+	}
+
+	void ShaderProgram::SetUniform4f(const Uniform& uniform, const float v0, const float v1, const float v2, const float v3) {
+		SetUniformHelper(uniform, glProgramUniform4f, glUniform4f, v0, v1, v2, v3);
+	}
+
+	void ShaderProgram::SetUniform1i(const Uniform& uniform, const int v0) {
+		SetUniformHelper(uniform, glProgramUniform1i, glUniform1i, v0);
+	}
+
+	void ShaderProgram::SetUniform2i(const Uniform& uniform, const int v0, const int v1) {
+		SetUniformHelper(uniform, glProgramUniform2i, glUniform2i, v0, v1);
+	}
+
+	void ShaderProgram::SetUniform3i(const Uniform& uniform, const int v0, const int v1, const int v2) {
+		SetUniformHelper(uniform, glProgramUniform3i, glUniform3i, v0, v1, v2);
+	}
+
+	void ShaderProgram::SetUniform4i(const Uniform& uniform, const int v0, const int v1, const int v2, const int v3) {
+		SetUniformHelper(uniform, glProgramUniform4i, glUniform4i, v0, v1, v2, v3);
+	}
+
+	void ShaderProgram::SetUniform1ui(const Uniform& uniform, const unsigned int v0) {
+		SetUniformHelper(uniform, glProgramUniform1ui, glUniform1ui, v0);
+	}
+
+	void ShaderProgram::SetUniform2ui(const Uniform& uniform, const unsigned int v0, const unsigned int v1) {
+		SetUniformHelper(uniform, glProgramUniform2ui, glUniform2ui, v0, v1);
+	}
+
+	void ShaderProgram::SetUniform3ui(const Uniform& uniform, const unsigned int v0, const unsigned int v1, const unsigned int v2) {
+		SetUniformHelper(uniform, glProgramUniform3ui, glUniform3ui, v0, v1, v2);
+	}
+
+	void ShaderProgram::SetUniform4ui(const Uniform& uniform, const unsigned int v0, const unsigned int v1, const unsigned int v2, const unsigned int v3) {
+		SetUniformHelper(uniform, glProgramUniform4ui, glUniform4ui, v0, v1, v2, v3);
+	}
+
+	void ShaderProgram::SetUniform1fv(const Uniform& uniform, const float* value) {
+		SetUniformHelper(uniform, glProgramUniform1fv, glUniform1fv, 1, value);
+	}
+
+	void ShaderProgram::SetUniform2fv(const Uniform& uniform, const float* value) {
+		SetUniformHelper(uniform, glProgramUniform2fv, glUniform2fv, 1, value);
+	}
+
+	void ShaderProgram::SetUniform3fv(const Uniform& uniform, const float* value) {
+		SetUniformHelper(uniform, glProgramUniform3fv, glUniform3fv, 1, value);
+	}
+
+	void ShaderProgram::SetUniform4fv(const Uniform& uniform, const float* value) {
+		SetUniformHelper(uniform, glProgramUniform4fv, glUniform4fv, 1, value);
+	}
+
+	void ShaderProgram::SetUniform1iv(const Uniform& uniform, const int* value) {
+		SetUniformHelper(uniform, glProgramUniform1iv, glUniform1iv, 1, value);
+	}
+
+	void ShaderProgram::SetUniform2iv(const Uniform& uniform, const int* value) {
+		SetUniformHelper(uniform, glProgramUniform2iv, glUniform2iv, 1, value);
+	}
+
+	void ShaderProgram::SetUniform3iv(const Uniform& uniform, const int* value) {
+		SetUniformHelper(uniform, glProgramUniform3iv, glUniform3iv, 1, value);
+	}
+
+	void ShaderProgram::SetUniform4iv(const Uniform& uniform, const int* value) {
+		SetUniformHelper(uniform, glProgramUniform4iv, glUniform4iv, 1, value);
+	}
+
+	void ShaderProgram::SetUniform1iuv(const Uniform& uniform, const unsigned int* value) {
+		SetUniformHelper(uniform, glProgramUniform1uiv, glUniform1uiv, 1, value);
+	}
+
+	void ShaderProgram::SetUniform2iuv(const Uniform& uniform, const unsigned int* value) {
+		SetUniformHelper(uniform, glProgramUniform2uiv, glUniform2uiv, 1, value);
+	}
+
+	void ShaderProgram::SetUniform3iuv(const Uniform& uniform, const unsigned int* value) {
+		SetUniformHelper(uniform, glProgramUniform3uiv, glUniform3uiv, 1, value);
+	}
+
+	void ShaderProgram::SetUniform4iuv(const Uniform& uniform, const unsigned int* value) {
+		SetUniformHelper(uniform, glProgramUniform4uiv, glUniform4uiv, 1, value);
+	}
+
+	void ShaderProgram::SetUniformMatrix2fv(const Uniform& uniform, const float* value, const bool transpose) {
+		SetUniformHelper(uniform, glProgramUniformMatrix2fv, glUniformMatrix2fv, (GLint)1, (GLboolean)transpose, value);
+	}
+
+	void ShaderProgram::SetUniformMatrix3fv(const Uniform& uniform, const float* value, const bool transpose) {
+		SetUniformHelper(uniform, glProgramUniformMatrix3fv, glUniformMatrix3fv, (GLint)1, (GLboolean)transpose, value);
+	}
+
+	void ShaderProgram::SetUniformMatrix4fv(const Uniform& uniform, const float* value, const bool transpose) {
+		SetUniformHelper(uniform, glProgramUniformMatrix4fv, glUniformMatrix4fv, (GLint)1, (GLboolean)transpose, value);
+	}
+
+	void ShaderProgram::SetUniformMatrix2x3fv(const Uniform& uniform, const float* value, const bool transpose) {
+		SetUniformHelper(uniform, glProgramUniformMatrix2x3fv, glUniformMatrix2x3fv, (GLint)1, (GLboolean)transpose, value);
+	}
+
+	void ShaderProgram::SetUniformMatrix3x2fv(const Uniform& uniform, const float* value, const bool transpose) {
+		SetUniformHelper(uniform, glProgramUniformMatrix3x2fv, glUniformMatrix3x2fv, (GLint)1, (GLboolean)transpose, value);
+	}
+
+	void ShaderProgram::SetUniformMatrix2x4fv(const Uniform& uniform, const float* value, const bool transpose) {
+		SetUniformHelper(uniform, glProgramUniformMatrix2x4fv, glUniformMatrix2x4fv, (GLint)1, (GLboolean)transpose, value);
+	}
+
+	void ShaderProgram::SetUniformMatrix4x2fv(const Uniform& uniform, const float* value, const bool transpose) {
+		SetUniformHelper(uniform, glProgramUniformMatrix4x2fv, glUniformMatrix4x2fv, (GLint)1, (GLboolean)transpose, value);
+	}
+
+	void ShaderProgram::SetUniformMatrix3x4fv(const Uniform& uniform, const float* value, const bool transpose) {
+		SetUniformHelper(uniform, glProgramUniformMatrix3x4fv, glUniformMatrix3x4fv, (GLint)1, (GLboolean)transpose, value);
+	}
+
+	void ShaderProgram::SetUniformMatrix4x3fv(const Uniform& uniform, const float* value, const bool transpose) {
+		SetUniformHelper(uniform, glProgramUniformMatrix4x3fv, glUniformMatrix4x3fv, (GLint)1, (GLboolean)transpose, value);
+	}
+
+	void ShaderProgram::SetUniform2fv(const Uniform& uniform, const glm::vec2& value) {
+		SetUniform2fv(uniform, &value[0]);
+	}
+
+	void ShaderProgram::SetUniform3fv(const Uniform& uniform, const glm::vec3& value) {
+		SetUniform3fv(uniform, &value[0]);
+	}
+
+	void ShaderProgram::SetUniform4fv(const Uniform& uniform, const glm::vec4& value) {
+		SetUniform4fv(uniform, &value[0]);
+	}
+
+	void ShaderProgram::SetUniformMatrix2fv(const Uniform& uniform, const glm::mat2& value, const bool transpose) {
+		SetUniformMatrix2fv(uniform, &value[0][0], transpose);
+	}
+
+	void ShaderProgram::SetUniformMatrix3fv(const Uniform& uniform, const glm::mat3& value, const bool transpose) {
+		SetUniformMatrix3fv(uniform, &value[0][0], transpose);
+	}
+
+	void ShaderProgram::SetUniformMatrix4fv(const Uniform& uniform, const glm::mat4& value, const bool transpose) {
+		SetUniformMatrix4fv(uniform, &value[0][0], transpose);
+	}
+
 } // OORenderer
@@ -0,0 +1,72 @@
+#include "OORenderer/ShareGroup.h"
+
+#include <algorithm>
+#include <utility>
+#include <LoggingAD/LoggingAD.h>
+
+#include "OORenderer/Window.h"
+#include "OORenderer/GeometryPool.h"
+#include "OORenderer/TextureArrayPool.h"
+
+namespace OORenderer {
+
+	ShareGroup* ShareGroup::Of(GLFWwindow* window) {
+		if (!window) {
+			return nullptr;
+		}
+
+		Window* user = static_cast<Window*>(glfwGetWindowUserPointer(window));
+		if (!user) {
+			LoggingAD::Error("[OORenderer::ShareGroup] GLFW window {:#010x} was not created by a Window so has no share group.", reinterpret_cast<std::uintptr_t>(window));
+			return nullptr;
+		}
+		return user->GetShareGroup();
+	}
+
+	ShareGroup::~ShareGroup() {
+		// Our last window has closed, taking every object shared in the group with it
+		GeometryPool::ReleaseShareGroup(m_ID);
+		TextureArrayPool::ReleaseShareGroup(m_ID);
+	}
+
+	ShareGroup::ID ShareGroup::GetID() const {
+		return m_ID;
+	}
+
+	bool ShareGroup::Contains(GLFWwindow* window) const {
+		return std::ranges::find(m_Windows, window) != m_Windows.end();
+	}
+
+	GLFWwindow* ShareGroup::GetAnyContext() const {
+		GLFWwindow* currentContext = glfwGetCurrentContext();
+		if (Contains(currentContext)) {
+			return currentContext;
+		}
+		return m_Windows.empty() ? nullptr : m_Windows.front();
+	}
+
+	const std::vector<GLFWwindow*>& ShareGroup::GetWindows() const {
+		return m_Windows;
+	}
+
+	const ShareGroup::ProgramBinary* ShareGroup::FindProgramBinary(std::uint64_t sourceKey) const {
+		auto binaryIt = m_ProgramBinaries.find(sourceKey);
+		return binaryIt == m_ProgramBinaries.end() ? nullptr : &binaryIt->second;
+	}
+
+	void ShareGroup::AddProgramBinary(std::uint64_t sourceKey, ProgramBinary binary) {
+		m_ProgramBinaries.try_emplace(sourceKey, std::move(binary));
+	}
+
+	void ShareGroup::AddWindow(GLFWwindow* window) {
+		m_Windows.push_back(window);
+	}
+
+	void ShareGroup::RemoveWindow(GLFWwindow* window) {
+		std::erase(m_Windows, window);
+
+		// Containers are per window, so go with its context rather than the group
+		GeometryPool::ForgetWindow(m_ID, window);
+	}
+
+} // OORenderer
@@ -0,0 +1,412 @@
+#include "OORenderer/SpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <bit>
+#include <utility>
+#include <limits>
+
+namespace OORenderer {
+
+	// How many moves ahead a reinserted object's fat box reaches
+	static constexpr float s_DisplacementMultiplier = 4.0f;
+
+	static float SurfaceArea(const AABB& box) {
+		glm::vec3 size = box.Max - box.Min;
+		return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
+	static bool Contains(const AABB& outer, const AABB& inner) {
+		return glm::all(glm::lessThanEqual(outer.Min, inner.Min)) && glm::all(glm::greaterThanEqual(outer.Max, inner.Max));
+	}
+
+	static bool Overlaps(const AABB& box, const BoundingSphere& sphere) {
+		glm::vec3 closest = glm::clamp(sphere.Center, box.Min, box.Max);
+		glm::vec3 offset = sphere.Center - closest;
+		return glm::dot(offset, offset) <= sphere.Radius * sphere.Radius;
+	}
+
+	// Slab test, distance is where the ray enters the box, or its origin if inside
+	static bool RayHitsBox(const glm::vec3& origin, const glm::vec3& inverseDirection, const AABB& box, float maxDistance, float& distance) {
+		float enter = 0.0f;
+		float exit = maxDistance;
+		for (int axis = 0; axis < 3; ++axis) {
+			// Parallel to this axis' planes, so between them throughout or never. Dividing would give 0 * inf = NaN for an origin on one
+			if (std::isinf(inverseDirection[axis])) {
+				if (origin[axis] < box.Min[axis] || origin[axis] > box.Max[axis]) {
+					return false;
+				}
+				continue;
+			}
+
+			float t0 = (box.Min[axis] - origin[axis]) * inverseDirection[axis];
+			float t1 = (box.Max[axis] - origin[axis]) * inverseDirection[axis];
+			enter = std::max(enter, std::min(t0, t1));
+			exit = std::min(exit, std::max(t0, t1));
+		}
+		distance = enter;
+		return enter <= exit;
+	}
+
+	SpatialIndex::SpatialIndex(float fatMargin)
+		: m_FatMargin(fatMargin)
+	{}
+
+	SpatialIndex::ProxyID SpatialIndex::Insert(const AABB& box, RenderObject* object) {
+		ProxyID proxy = AllocateNode();
+		Node& node = m_Nodes[proxy];
+		node.Box = box;
+		node.FatBox = Fatten(box);
+		node.Object = object;
+		node.Height = 0;
+
+		InsertLeaf(proxy);
+		++m_ProxyCount;
+		return proxy;
+	}
+
+	void SpatialIndex::Remove(ProxyID proxy) {
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		--m_ProxyCount;
+	}
+
+	bool SpatialIndex::Update(ProxyID proxy, const AABB& box) {
+		Node& node = m_Nodes[proxy];
+		glm::vec3 displacement = box.GetCenter() - node.Box.GetCenter();
+		node.Box = box;
+		if (Contains(node.FatBox, box)) {
+			return false;
+		}
+
+		// Objects tend to keep moving the way they were, so the fat box reaches further that way
+		AABB fatBox = Fatten(box);
+		displacement *= s_DisplacementMultiplier;
+		fatBox.Min += glm::min(displacement, glm::vec3{ 0.0f });
+		fatBox.Max += glm::max(displacement, glm::vec3{ 0.0f });
+
+		RemoveLeaf(proxy);
+		m_Nodes[proxy].FatBox = fatBox;
+		InsertLeaf(proxy);
+		return true;
+	}
+
+	void SpatialIndex::SetObject(ProxyID proxy, RenderObject* object) {
+		m_Nodes[proxy].Object = object;
+	}
+
+	void SpatialIndex::Query(const Frustum& frustum, std::vector<RenderObject*>& results) const {
+		if (m_Root == NullProxy) {
+			return;
+		}
+
+		// Each node carries the planes its parent still straddled, a box wholly inside a plane has no need to test it again below
+		constexpr unsigned int allPlanes = (1u << 6) - 1;
+		const std::array<glm::vec4, 6>& planes = frustum.GetPlanes();
+
+		std::vector<std::pair<ProxyID, unsigned int>> stack;
+		stack.reserve(64);
+		stack.emplace_back(m_Root, allPlanes);
+		while (!stack.empty()) {
+			auto [index, planeMask] = stack.back();
+			stack.pop_back();
+			const Node& node = m_Nodes[index];
+
+			glm::vec3 center = node.FatBox.GetCenter();
+			glm::vec3 extents = node.FatBox.GetExtents();
+			bool outside = false;
+			for (unsigned int mask = planeMask; mask; mask &= mask - 1) {
+				int plane = std::countr_zero(mask);
+				glm::vec3 normal{ planes[plane] };
+				float distance = glm::dot(normal, center) + planes[plane].w;
+				float reach = glm::dot(glm::abs(normal), extents);
+				if (distance + reach < 0.0f) {
+					outside = true;
+					break;
+				}
+				if (distance - reach >= 0.0f) {
+					planeMask &= ~(1u << plane);
+				}
+			}
+			if (outside) {
+				continue;
+			}
+
+			// Everything below a node wholly in view is too
+			if (node.IsLeaf() || planeMask == 0) {
+				CollectLeaves(index, results);
+				continue;
+			}
+			stack.emplace_back(node.Child1, planeMask);
+			stack.emplace_back(node.Child2, planeMask);
+		}
+	}
+
+	void SpatialIndex::Query(const BoundingSphere& sphere, std::vector<RenderObject*>& results) const {
+		if (m_Root == NullProxy) {
+			return;
+		}
+
+		std::vector<ProxyID> stack;
+		stack.reserve(64);
+		stack.push_back(m_Root);
+		while (!stack.empty()) {
+			const Node& node = m_Nodes[stack.back()];
+			stack.pop_back();
+
+			if (!Overlaps(node.FatBox, sphere)) {
+				continue;
+			}
+			if (node.IsLeaf()) {
+				results.push_back(node.Object);
+				continue;
+			}
+			stack.push_back(node.Child1);
+			stack.push_back(node.Child2);
+		}
+	}
+
+	std::optional<SpatialIndex::RayHit> SpatialIndex::RayCast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) const {
+		if (m_Root == NullProxy) {
+			return std::nullopt;
+		}
+
+		glm::vec3 inverseDirection = 1.0f / direction;
+		std::optional<RayHit> closest;
+		float closestDistance = maxDistance;
+
+		std::vector<ProxyID> stack;
+		stack.reserve(64);
+		stack.push_back(m_Root);
+		while (!stack.empty()) {
+			const Node& node = m_Nodes[stack.back()];
+			stack.pop_back();
+
+			// Anything further than the closest hit so far is skipped
+			float distance;
+			if (!RayHitsBox(origin, inverseDirection, node.FatBox, closestDistance, distance)) {
+				continue;
+			}
+			if (node.IsLeaf()) {
+				if (RayHitsBox(origin, inverseDirection, node.Box, closestDistance, distance)) {
+					closest = RayHit{ node.Object, distance };
+					closestDistance = distance;
+				}
+				continue;
+			}
+			stack.push_back(node.Child1);
+			stack.push_back(node.Child2);
+		}
+
+		return closest;
+	}
+
+	std::size_t SpatialIndex::GetProxyCount() const {
+		return m_ProxyCount;
+	}
+
+	int SpatialIndex::GetHeight() const {
+		return m_Root == NullProxy ? 0 : m_Nodes[m_Root].Height;
+	}
+
+	SpatialIndex::ProxyID SpatialIndex::AllocateNode() {
+		if (m_FreeList == NullProxy) {
+			m_Nodes.emplace_back();
+			return static_cast<ProxyID>(m_Nodes.size() - 1);
+		}
+
+		ProxyID node = m_FreeList;
+		m_FreeList = m_Nodes[node].Parent;
+		m_Nodes[node] = Node{};
+		return node;
+	}
+
+	void SpatialIndex::FreeNode(ProxyID node) {
+		m_Nodes[node] = Node{};
+		m_Nodes[node].Parent = m_FreeList;
+		m_FreeList = node;
+	}
+
+	void SpatialIndex::InsertLeaf(ProxyID leaf) {
+		if (m_Root == NullProxy) {
+			m_Root = leaf;
+			m_Nodes[leaf].Parent = NullProxy;
+			return;
+		}
+
+		// Descend to the sibling giving the least total surface area, as in Box2D's dynamic tree
+		AABB leafBox = m_Nodes[leaf].FatBox;
+		ProxyID index = m_Root;
+		while (!m_Nodes[index].IsLeaf()) {
+			const Node& node = m_Nodes[index];
+			float area = SurfaceArea(node.FatBox);
+			float combinedArea = SurfaceArea(AABB::Merge(node.FatBox, leafBox));
+
+			// Pairing with this node, against pushing the leaf down into a child
+			float cost = 2.0f * combinedArea;
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			auto descendCost = [&](ProxyID child) {
+				const Node& childNode = m_Nodes[child];
+				float mergedArea = SurfaceArea(AABB::Merge(leafBox, childNode.FatBox));
+				return (childNode.IsLeaf() ? mergedArea : mergedArea - SurfaceArea(childNode.FatBox)) + inheritanceCost;
+			};
+			float cost1 = descendCost(node.Child1);
+			float cost2 = descendCost(node.Child2);
+
+			if (cost < cost1 && cost < cost2) {
+				break;
+			}
+			index = cost1 < cost2 ? node.Child1 : node.Child2;
+		}
+
+		ProxyID sibling = index;
+		ProxyID oldParent = m_Nodes[sibling].Parent;
+		ProxyID newParent = AllocateNode();
+		m_Nodes[newParent].Parent = oldParent;
+		m_Nodes[newParent].FatBox = AABB::Merge(leafBox, m_Nodes[sibling].FatBox);
+		m_Nodes[newParent].Height = m_Nodes[sibling].Height + 1;
+		m_Nodes[newParent].Child1 = sibling;
+		m_Nodes[newParent].Child2 = leaf;
+		m_Nodes[sibling].Parent = newParent;
+		m_Nodes[leaf].Parent = newParent;
+
+		if (oldParent == NullProxy) {
+			m_Root = newParent;
+		}
+		else if (m_Nodes[oldParent].Child1 == sibling) {
+			m_Nodes[oldParent].Child1 = newParent;
+		}
+		else {
+			m_Nodes[oldParent].Child2 = newParent;
+		}
+
+		// Refit and rebalance up to the root
+		index = newParent;
+		while (index != NullProxy) {
+			index = Balance(index);
+			Node& node = m_Nodes[index];
+			node.Height = 1 + std::max(m_Nodes[node.Child1].Height, m_Nodes[node.Child2].Height);
+			node.FatBox = AABB::Merge(m_Nodes[node.Child1].FatBox, m_Nodes[node.Child2].FatBox);
+			index = node.Parent;
+		}
+	}
+
+	void SpatialIndex::RemoveLeaf(ProxyID leaf) {
+		if (leaf == m_Root) {
+			m_Root = NullProxy;
+			return;
+		}
+
+		ProxyID parent = m_Nodes[leaf].Parent;
+		ProxyID grandParent = m_Nodes[parent].Parent;
+		ProxyID sibling = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+		// The sibling takes the parent's place
+		m_Nodes[sibling].Parent = grandParent;
+		FreeNode(parent);
+		if (grandParent == NullProxy) {
+			m_Root = sibling;
+			return;
+		}
+
+		if (m_Nodes[grandParent].Child1 == parent) {
+			m_Nodes[grandParent].Child1 = sibling;
+		}
+		else {
+			m_Nodes[grandParent].Child2 = sibling;
+		}
+
+		ProxyID index = grandParent;
+		while (index != NullProxy) {
+			index = Balance(index);
+			Node& node = m_Nodes[index];
+			node.Height = 1 + std::max(m_Nodes[node.Child1].Height, m_Nodes[node.Child2].Height);
+			node.FatBox = AABB::Merge(m_Nodes[node.Child1].FatBox, m_Nodes[node.Child2].FatBox);
+			index = node.Parent;
+		}
+	}
+
+	SpatialIndex::ProxyID SpatialIndex::Balance(ProxyID iA) {
+		Node& A = m_Nodes[iA];
+		if (A.IsLeaf() || A.Height < 2) {
+			return iA;
+		}
+
+		ProxyID iB = A.Child1;
+		ProxyID iC = A.Child2;
+		Node& B = m_Nodes[iB];
+		Node& C = m_Nodes[iC];
+		int balance = C.Height - B.Height;
+
+		// Rotate whichever child is too tall up to A's place, A takes the taller of its grandchildren
+		auto rotateUp = [&](ProxyID iUp, Node& up, Node& other, bool upIsChild2) {
+			ProxyID iF = up.Child1;
+			ProxyID iG = up.Child2;
+			Node& F = m_Nodes[iF];
+			Node& G = m_Nodes[iG];
+
+			up.Child1 = iA;
+			up.Parent = A.Parent;
+			A.Parent = iUp;
+
+			if (up.Parent == NullProxy) {
+				m_Root = iUp;
+			}
+			else if (m_Nodes[up.Parent].Child1 == iA) {
+				m_Nodes[up.Parent].Child1 = iUp;
+			}
+			else {
+				m_Nodes[up.Parent].Child2 = iUp;
+			}
+
+			// The taller grandchild stays with the rotated node, the shorter moves to A
+			bool keepF = F.Height > G.Height;
+			ProxyID iKept = keepF ? iF : iG;
+			ProxyID iMoved = keepF ? iG : iF;
+			Node& kept = m_Nodes[iKept];
+			Node& moved = m_Nodes[iMoved];
+
+			up.Child2 = iKept;
+			if (upIsChild2) {
+				A.Child2 = iMoved;
+			}
+			else {
+				A.Child1 = iMoved;
+			}
+			moved.Parent = iA;
+
+			A.FatBox = AABB::Merge(other.FatBox, moved.FatBox);
+			up.FatBox = AABB::Merge(A.FatBox, kept.FatBox);
+			A.Height = 1 + std::max(other.Height, moved.Height);
+			up.Height = 1 + std::max(A.Height, kept.Height);
+		};
+
+		if (balance > 1) {
+			rotateUp(iC, C, B, true);
+			return iC;
+		}
+		if (balance < -1) {
+			rotateUp(iB, B, C, false);
+			return iB;
+		}
+		return iA;
+	}
+
+	void SpatialIndex::CollectLeaves(ProxyID node, std::vector<RenderObject*>& results) const {
+		const Node& current = m_Nodes[node];
+		if (current.IsLeaf()) {
+			results.push_back(current.Object);
+			return;
+		}
+		CollectLeaves(current.Child1, results);
+		CollectLeaves(current.Child2, results);
+	}
+
+	AABB SpatialIndex::Fatten(const AABB& box) const {
+		glm::vec3 size = box.Max - box.Min;
+		glm::vec3 margin{ m_FatMargin * std::max({ size.x, size.y, size.z }) };
+		return { box.Min - margin, box.Max + margin };
+	}
+
+} // OORenderer
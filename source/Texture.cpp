@@ -1,14 +1,136 @@
 
 #include "OORenderer/Texture.h"
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <thread>
+#include <utility>
 #include <LoggingAD/LoggingAD.h>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
+#include "OORenderer/Hash.h"
+#include "OORenderer/Profiler.h"
+#include "OORenderer/GLStateCache.h"
+#include "OORenderer/ThreadPool.h"
+#include "BlockCompression.h"
+#include "KTX2File.h"
+
 namespace OORenderer {
 
+	// Upload formats of decoded images, by channel count
+	static constexpr GLenum s_Formats[] = { GL_RED, GL_RG, GL_RGB, GL_RGBA };
+	static constexpr GLenum s_InternalFormats[] = { GL_R8, GL_RG8, GL_RGB8, GL_RGBA8 };
+
+	struct StbiImageDeleter {
+		void operator()(unsigned char* data) const {
+			stbi_image_free(data);
+		}
+	};
+
+	struct Texture::LoadedImage {
+		// One of these is set on success
+		std::unique_ptr<unsigned char, StbiImageDeleter> Data;
+		std::shared_ptr<const CompressedImage> Compressed;
+
+		int Width = 0;
+		int Height = 0;
+		int NumChannels = 0;
+	};
+
+	struct Texture::PendingDecode {
+		std::filesystem::path TexturePath;
+		bool Flip = true;
+		Compression TextureCompression = Compression::None;
+		std::filesystem::path CompressedCacheDirectory;
+
+		// Written by the worker before Done is set
+		LoadedImage Image;
+
+		std::atomic<bool> Done = false;
+	};
+
+	static BlockFormat ChooseBlockFormat(int numChannels, Texture::Compression compression) {
+		switch (numChannels) {
+		case 1: return BlockFormat::BC4;
+		case 2: return BlockFormat::BC5;
+		case 3: return compression == Texture::Compression::HighQuality ? BlockFormat::BC7 : BlockFormat::BC1;
+		default: return compression == Texture::Compression::HighQuality ? BlockFormat::BC7 : BlockFormat::BC3;
+		}
+	}
+
+	static std::filesystem::path GetCompressedCachePath(const std::filesystem::path& texturePath, bool flip, BlockFormat format, const std::filesystem::path& cacheDirectory) {
+		// Any change to the source file or how it's encoded gives a new name, stale files are simply never read again
+		std::error_code error;
+		std::uint64_t hash = HashFNV1a64(std::filesystem::weakly_canonical(texturePath, error).generic_string());
+		std::uint64_t stamp[] = {
+			std::filesystem::file_size(texturePath, error),
+			static_cast<std::uint64_t>(std::filesystem::last_write_time(texturePath, error).time_since_epoch().count()),
+			flip,
+			static_cast<std::uint64_t>(format)
+		};
+		hash = HashFNV1a64(stamp, sizeof(stamp), hash);
+
+		std::ostringstream fileName;
+		fileName << texturePath.stem().string() << "_" << std::hex << std::setw(16) << std::setfill('0') << hash << ".ktx2";
+		return cacheDirectory / fileName.str();
+	}
+
+	Texture::LoadedImage Texture::LoadImageFile(const std::filesystem::path& texturePath, bool flip, Compression compression, const std::filesystem::path& cacheDirectory) {
+		LoadedImage image;
+
+		BlockFormat format = BlockFormat::BC1;
+		std::filesystem::path cachePath;
+		if (compression != Compression::None
+			&& stbi_info(texturePath.string().c_str(), &image.Width, &image.Height, &image.NumChannels)) {
+			format = ChooseBlockFormat(image.NumChannels, compression);
+
+			// Decided here on the worker, so uploads never find they have to load the image again
+			if (BlockCompression::IsSupportedOnEveryContext(format)) {
+				cachePath = GetCompressedCachePath(texturePath, flip, format, cacheDirectory);
+				if (std::optional<CompressedImage> cached = KTX2File::Read(cachePath)) {
+					image.Compressed = std::make_shared<const CompressedImage>(std::move(*cached));
+					return image;
+				}
+			}
+			else {
+				LoggingAD::Trace("[OORenderer::Texture::Load] Compressed format unsupported by an open context, loading {} uncompressed", texturePath.string());
+			}
+		}
+
+		// Needs improvement, this method I think only works for jpg/jpeg formats
+		// TODO Investigate
+		stbi_set_flip_vertically_on_load_thread(flip);
+		image.Data.reset(stbi_load(texturePath.string().c_str(), &image.Width, &image.Height, &image.NumChannels, 0));
+
+		if (image.Data && !cachePath.empty()) {
+			CompressedImage compressed = BlockCompression::EncodeWithMips(format, image.Data.get(), image.Width, image.Height, image.NumChannels);
+			KTX2File::Write(cachePath, compressed);
+
+			image.Compressed = std::make_shared<const CompressedImage>(std::move(compressed));
+			image.Data.reset();
+		}
+		return image;
+	}
+
+	static unsigned int s_DecodeThreadCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+	static std::unique_ptr<ThreadPool> s_DecodePool;
+
+	static ThreadPool& GetDecodePool() {
+		if (!s_DecodePool) {
+			s_DecodePool = std::make_unique<ThreadPool>(s_DecodeThreadCount);
+		}
+		return *s_DecodePool;
+	}
+
+	Texture::Texture()
+	{ }
+
 	Texture::Texture(std::filesystem::path texturePath)
 	{
 		LoadTexture(texturePath);
@@ -49,36 +171,200 @@ namespace OORenderer {
 		if (m_RawData) {
 			stbi_image_free(m_RawData);
 		}
+
+		// Delete our texture object on each share group still open, those whose windows are all closed took it with them
+		// Contexts are only touched if a group is open, GLFW may have terminated before cached textures are destroyed
+		ForgetClosedShareGroups();
+		for (const auto& [shareGroupID, slot] : m_GroupArraySlots) {
+			TextureArrayPool::Release(slot);
+		}
+
+		std::optional<GLFWwindow*> oldContext;
+		for (const auto& [shareGroupID, textureID] : m_GroupTextureIDs) {
+			std::shared_ptr<const ShareGroup> liveGroup = m_GroupLifetimes[shareGroupID].lock();
+			GLFWwindow* context = liveGroup ? liveGroup->GetAnyContext() : nullptr;
+			if (!context) {
+				continue;
+			}
+
+			if (!oldContext) {
+				oldContext = glfwGetCurrentContext();
+			}
+			Window::ActivateGLFWWindow(context);
+			if (glfwGetCurrentContext() != context) {
+				LoggingAD::Warning("[OORenderer::Texture::Destroy] No context of share group {} available on this thread, texture {} is leaked.", shareGroupID, textureID);
+				continue;
+			}
+
+			GLStateCache::ForgetTexture(context, textureID);
+			glDeleteTextures(1, &textureID);
+		}
+		if (oldContext) {
+			Window::ActivateGLFWWindow(*oldContext);
+		}
+	}
+
+	unsigned int Texture::GetTextureID() const {
+		return GetTextureID(glfwGetCurrentContext());
+	}
+
+	unsigned int Texture::GetTextureID(GLFWwindow* window) const {
+		const ShareGroup* shareGroup = ShareGroup::Of(window);
+		if (!shareGroup) {
+			return 0;
+		}
+		auto textureIDIt = m_GroupTextureIDs.find(shareGroup->GetID());
+		if (textureIDIt == m_GroupTextureIDs.end()) {
+			return 0;
+		}
+		return textureIDIt->second;
 	}
 
-	unsigned int Texture::GetTextureID() {
-		return m_TextureID;
+	const TextureArrayPool::Slot* Texture::GetArraySlot(GLFWwindow* window) const {
+		if (m_GroupArraySlots.empty()) {
+			return nullptr;
+		}
+		const ShareGroup* shareGroup = ShareGroup::Of(window);
+		if (!shareGroup) {
+			return nullptr;
+		}
+		auto slotIt = m_GroupArraySlots.find(shareGroup->GetID());
+		if (slotIt == m_GroupArraySlots.end()) {
+			return nullptr;
+		}
+		return &slotIt->second;
 	}
 
 	void Texture::LoadTexture(std::filesystem::path texturePath, const bool flip) {
+		OORENDERER_PROFILE_SCOPE("Texture::LoadTexture");
 
 		LoggingAD::Trace("[OORenderer::Texture::Load] Loading texture from path: {}", texturePath.string());
 
-		// Needs improvement, this method I think only works for jpg/jpeg formats
-		// TODO Investigate
-		stbi_set_flip_vertically_on_load(flip);
-		m_RawData = stbi_load(texturePath.string().c_str(), &m_Width, &m_Height, &m_NumChannels, 0);
+		// Supersedes any decode still in flight
+		m_PendingDecode.reset();
 
-		if (!m_RawData) {
+		LoadedImage image = LoadImageFile(texturePath, flip, sm_Compression, sm_CompressedCacheDirectory);
+		if (!image.Data && !image.Compressed) {
 			LoggingAD::Error("[OORenderer::Texture::Load] Error loading texture from path: {}", texturePath.string());
 			return;
 		}
 
-		BindTexture();
+		m_Flip = flip;
+		m_LoadCompression = sm_Compression;
+		m_LoadCacheDirectory = sm_CompressedCacheDirectory;
+		SetImage(std::move(image));
+		m_TextureFilePath = texturePath;
+	}
+
+	void Texture::LoadTextureAsync(std::filesystem::path texturePath, const bool flip) {
+		LoggingAD::Trace("[OORenderer::Texture::Load] Queueing texture decode from path: {}", texturePath.string());
+
+		// Known by path straight away so duplicate loads can find us
+		m_TextureFilePath = texturePath;
+		m_Flip = flip;
+		m_LoadCompression = sm_Compression;
+		m_LoadCacheDirectory = sm_CompressedCacheDirectory;
+
+		// Workers get their own copy of the compression settings
+		m_PendingDecode = std::make_shared<PendingDecode>();
+		m_PendingDecode->TexturePath = texturePath;
+		m_PendingDecode->Flip = flip;
+		m_PendingDecode->TextureCompression = sm_Compression;
+		m_PendingDecode->CompressedCacheDirectory = sm_CompressedCacheDirectory;
+
+		GetDecodePool().Submit([pendingDecode = m_PendingDecode]() {
+			PendingDecode& decode = *pendingDecode;
+			decode.Image = LoadImageFile(decode.TexturePath, decode.Flip, decode.TextureCompression, decode.CompressedCacheDirectory);
+
+			decode.Done.store(true, std::memory_order_release);
+			decode.Done.notify_all();
+		});
+	}
+
+	bool Texture::UploadDecodedTexture() {
+		if (!m_PendingDecode) {
+			return true;
+		}
+		if (!m_PendingDecode->Done.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		std::shared_ptr<PendingDecode> decode = std::move(m_PendingDecode);
+		if (!decode->Image.Data && !decode->Image.Compressed) {
+			LoggingAD::Error("[OORenderer::Texture::Load] Error loading texture from path: {}", decode->TexturePath.string());
+			return true;
+		}
+
+		SetImage(std::move(decode->Image));
+		return true;
+	}
 
-		if (m_Window) {
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, m_Width, m_Height, 0, GL_RGB, GL_UNSIGNED_BYTE, m_RawData);
-			glGenerateMipmap(GL_TEXTURE_2D);
+	bool Texture::IsDecodePending() const {
+		return m_PendingDecode != nullptr;
+	}
+
+	void Texture::WaitForDecode() const {
+		if (m_PendingDecode) {
+			m_PendingDecode->Done.wait(false, std::memory_order_acquire);
 		}
+	}
 
-		UnbindTexture();
+	void Texture::SetDecodeThreadCount(unsigned int threadCount) {
+		s_DecodeThreadCount = std::max(threadCount, 1u);
 
-		m_TextureFilePath = texturePath;
+		// Rebuilt lazily at the new size, the old pool finishes its queue first
+		s_DecodePool.reset();
+	}
+
+	void Texture::EnableCompression(Compression compression, std::filesystem::path cacheDirectory) {
+		std::error_code error;
+		std::filesystem::create_directories(cacheDirectory, error);
+		if (error) {
+			LoggingAD::Error("[OORenderer::Texture::Compression] Failed to create cache directory {}: {}", cacheDirectory.string(), error.message());
+			return;
+		}
+
+		sm_Compression = compression;
+		sm_CompressedCacheDirectory = cacheDirectory;
+	}
+
+	void Texture::DisableCompression() {
+		sm_Compression = Compression::None;
+	}
+
+	void Texture::EnableArrayPooling() {
+		sm_PoolArrays = true;
+	}
+
+	void Texture::DisableArrayPooling() {
+		sm_PoolArrays = false;
+	}
+
+	void Texture::SetImage(LoadedImage image) {
+		if (m_RawData) {
+			stbi_image_free(m_RawData);
+		}
+		m_RawData = image.Data.release();
+		m_CompressedImage = std::move(image.Compressed);
+		m_Width = image.Width;
+		m_Height = image.Height;
+		m_NumChannels = image.NumChannels;
+		m_CPUTracking = Residency::Track(Residency::Asset::Texture, nullptr, GetCPUMemorySize());
+
+		// Push to every share group we're already bound to
+		ForgetClosedShareGroups();
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		for (const auto& [shareGroupID, textureID] : m_GroupTextureIDs) {
+			std::shared_ptr<const ShareGroup> shareGroup = m_GroupLifetimes[shareGroupID].lock();
+			Window::ActivateGLFWWindow(shareGroup->GetAnyContext());
+			GLStateCache::Current().BindTexture(GL_TEXTURE_2D, textureID);
+			UploadToBoundTexture(*shareGroup);
+		}
+		Window::ActivateGLFWWindow(oldContext);
+
+		if (!m_GroupTextureIDs.empty() && GetResidencyPolicy() != ResidencyPolicy::Keep) {
+			DropImageData();
+		}
 	}
 
 	void Texture::BindToWindow(const Window& window) {
@@ -86,13 +372,34 @@ namespace OORenderer {
 	}
 
 	void Texture::BindToWindow(GLFWwindow* window) {
-		m_Window = window;
+		const ShareGroup* shareGroup = ShareGroup::Of(window);
+		if (!shareGroup) {
+			LoggingAD::Error("[OORenderer::Texture::Bind] Textures may only be bound to windows created by a Window.");
+			return;
+		}
+
+		// Already available to every window of this group, nothing to upload
+		ForgetClosedShareGroups();
+		if (m_GroupTextureIDs.contains(shareGroup->GetID())) {
+			return;
+		}
+
+		// Loaded once already but dropped after upload
+		if (!IsDataResident() && m_Width > 0) {
+			if (GetResidencyPolicy() == ResidencyPolicy::ReloadOnDemand) {
+				ReloadImageData();
+			}
+			else {
+				LoggingAD::Error("[OORenderer::Texture::Bind] Texture {} was dropped after upload, it will be empty on this share group.", m_TextureFilePath.string());
+			}
+		}
 
-		m_OldContext = glfwGetCurrentContext();
-		Window::ActivateGLFWWindow(m_Window);
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		Window::ActivateGLFWWindow(window);
 
-		glGenTextures(1, &m_TextureID);
-		glBindTexture(GL_TEXTURE_2D, m_TextureID);
+		unsigned int textureID;
+		glGenTextures(1, &textureID);
+		GLStateCache::Current().BindTexture(GL_TEXTURE_2D, textureID);
 
 		// set the texture wrapping/filtering options (on the currently bound texture object)
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, m_TextureWrapS);
@@ -102,78 +409,239 @@ namespace OORenderer {
 		glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, m_BorderColour.data());
 
 		// If we have data already loaded, push to this context
-		if (m_RawData) {
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, m_Width, m_Height, 0, GL_RGB, GL_UNSIGNED_BYTE, m_RawData);
-			glGenerateMipmap(GL_TEXTURE_2D);
+		if (IsDataResident()) {
+			UploadToBoundTexture(*shareGroup);
 		}
 
-		glBindTexture(GL_TEXTURE_2D, NULL);
+		m_GroupTextureIDs[shareGroup->GetID()] = textureID;
+		m_GroupLifetimes[shareGroup->GetID()] = shareGroup->weak_from_this();
 
-		Window::ActivateGLFWWindow(m_OldContext);
+		Window::ActivateGLFWWindow(oldContext);
+
+		if (IsDataResident() && GetResidencyPolicy() != ResidencyPolicy::Keep) {
+			DropImageData();
+		}
 	}
 
 	void Texture::SetTextureWrapMode(GLint mode) {
-		SetTextureWrapModeS(mode);
-		SetTextureWrapModeT(mode);
+		m_TextureWrapS = mode;
+		m_TextureWrapT = mode;
+		ApplyTextureParameters();
 	}
 
 	void Texture::SetTextureWrapModeS(GLint mode) {
-		BindTexture();
-
 		m_TextureWrapS = mode;
+		ApplyTextureParameters();
+	}
 
-		if (m_Window) {
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, m_TextureWrapS);
-		}
+	void Texture::SetTextureWrapModeT(GLint mode) {
+		m_TextureWrapT = mode;
+		ApplyTextureParameters();
+	}
 
-		UnbindTexture();
+	void Texture::SetBorderColour(std::array<float, 4> colour) {
+		m_BorderColour = colour;
+		ApplyTextureParameters();
 	}
 
-	void Texture::SetTextureWrapModeT(GLint mode) {
-		BindTexture();
+	std::filesystem::path Texture::GetTexturePath() const {
+		return m_TextureFilePath;
+	}
 
-		m_TextureWrapT = mode;
+	std::size_t Texture::GetMemorySize() const {
+		return GetCPUMemorySize() + m_UploadedSize * m_GroupTracking.size();
+	}
 
-		if (m_Window) {
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, m_TextureWrapT);
+	void Texture::SetResidencyPolicy(ResidencyPolicy policy) {
+		m_ResidencyPolicy = policy;
+
+		// Already uploaded somewhere, nothing more to wait for
+		if (policy != ResidencyPolicy::Keep && !m_GroupTracking.empty()) {
+			DropImageData();
 		}
+	}
 
-		UnbindTexture();
+	ResidencyPolicy Texture::GetResidencyPolicy() const {
+		return m_ResidencyPolicy.value_or(Residency::GetDefaultPolicy());
 	}
 
-	void Texture::SetBorderColour(std::array<float, 4> colour) {
-		BindTexture();
+	bool Texture::IsDataResident() const {
+		return m_RawData || m_CompressedImage;
+	}
 
-		m_BorderColour = colour;
+	std::size_t Texture::GetCPUMemorySize() const {
+		if (m_CompressedImage) {
+			return m_CompressedImage->GetSize();
+		}
+		if (m_RawData) {
+			return static_cast<std::size_t>(m_Width) * m_Height * m_NumChannels;
+		}
+		return 0;
+	}
 
-		if (m_Window) {
-			glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, m_BorderColour.data());
+	void Texture::ReloadImageData() {
+		LoggingAD::Trace("[OORenderer::Texture::Load] Reloading texture from path: {}", m_TextureFilePath.string());
+
+		LoadedImage image = LoadImageFile(m_TextureFilePath, m_Flip, m_LoadCompression, m_LoadCacheDirectory);
+		if (!image.Data && !image.Compressed) {
+			LoggingAD::Error("[OORenderer::Texture::Load] Error reloading texture from path: {}", m_TextureFilePath.string());
+			return;
 		}
 
-		UnbindTexture();
+		m_RawData = image.Data.release();
+		m_CompressedImage = std::move(image.Compressed);
+		m_CPUTracking = Residency::Track(Residency::Asset::Texture, nullptr, GetCPUMemorySize());
 	}
 
-	std::filesystem::path Texture::GetTexturePath() const {
-		return m_TextureFilePath;
+	void Texture::DropImageData() {
+		if (m_RawData) {
+			stbi_image_free(m_RawData);
+			m_RawData = nullptr;
+		}
+		m_CompressedImage.reset();
+		m_CPUTracking.reset();
 	}
 
-	void Texture::BindTexture() {
-		if (!m_Window) {
+	void Texture::UploadToBoundTexture(const ShareGroup& shareGroup) {
+		// Only when this context was created after the image was decoded, decodes otherwise avoid formats any context lacks
+		if (m_CompressedImage && !BlockCompression::IsSupportedOnCurrentContext(m_CompressedImage->Format)) {
+			LoggingAD::Warning("[OORenderer::Texture::Upload] Compressed format unsupported on this context, reloading {} uncompressed", m_TextureFilePath.string());
+
+			LoadedImage image = LoadImageFile(m_TextureFilePath, m_Flip, Compression::None, {});
+			m_RawData = image.Data.release();
+			m_CompressedImage.reset();
+			m_CPUTracking = Residency::Track(Residency::Asset::Texture, nullptr, GetCPUMemorySize());
+		}
+
+		// Uploaded to a layer last time, replaced by whichever upload this is
+		auto slotIt = m_GroupArraySlots.find(shareGroup.GetID());
+		if (slotIt != m_GroupArraySlots.end()) {
+			TextureArrayPool::Release(slotIt->second);
+			m_GroupArraySlots.erase(slotIt);
+		}
+
+		if (sm_PoolArrays && IsDataResident()) {
+			UploadToArray(shareGroup);
 			return;
 		}
 
-		m_OldContext = glfwGetCurrentContext();
-		Window::ActivateGLFWWindow(m_Window);
-		glBindTexture(GL_TEXTURE_2D, m_TextureID);
-	}
+		if (m_CompressedImage) {
+			GLenum internalFormat = BlockCompression::GetGLInternalFormat(m_CompressedImage->Format);
+			for (std::size_t level = 0; level < m_CompressedImage->Levels.size(); ++level) {
+				std::span<const std::byte> levelData = m_CompressedImage->Levels[level];
+				glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), internalFormat,
+					std::max(m_Width >> level, 1), std::max(m_Height >> level, 1), 0, static_cast<GLsizei>(levelData.size()), levelData.data());
+			}
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(m_CompressedImage->Levels.size()) - 1);
+			m_UploadedSize = m_CompressedImage->GetSize();
+		}
+		else if (m_RawData) {
+			int formatIndex = std::clamp(m_NumChannels, 1, 4) - 1;
+
+			// Rows of 1 to 3 channel images needn't be 4 byte aligned
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+			glTexImage2D(GL_TEXTURE_2D, 0, s_InternalFormats[formatIndex], m_Width, m_Height, 0, s_Formats[formatIndex], GL_UNSIGNED_BYTE, m_RawData);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+			glGenerateMipmap(GL_TEXTURE_2D);
 
-	void Texture::UnbindTexture() {
-		if (!m_Window) {
+			// A full mip chain adds a third
+			m_UploadedSize = static_cast<std::size_t>(m_Width) * m_Height * m_NumChannels * 4 / 3;
+		}
+		else {
 			return;
 		}
 
-		glBindTexture(GL_TEXTURE_2D, NULL);
-		Window::ActivateGLFWWindow(m_OldContext);
+		m_GroupTracking[shareGroup.GetID()] = Residency::Track(Residency::Asset::Texture, &shareGroup, m_UploadedSize);
+
+		// Sample greyscale as grey rather than red, and greyscale with alpha as grey with alpha
+		if (m_NumChannels <= 2) {
+			GLint swizzle[] = { GL_RED, GL_RED, GL_RED, m_NumChannels == 2 ? GL_GREEN : GL_ONE };
+			glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+		}
+	}
+
+	void Texture::UploadToArray(const ShareGroup& shareGroup) {
+		TextureArrayPool::Format format{};
+		if (m_CompressedImage) {
+			format = { BlockCompression::GetGLInternalFormat(m_CompressedImage->Format), m_Width, m_Height,
+				static_cast<int>(m_CompressedImage->Levels.size()), m_NumChannels, BlockCompression::GetBlockSize(m_CompressedImage->Format) };
+		}
+		else {
+			int formatIndex = std::clamp(m_NumChannels, 1, 4) - 1;
+			int levels = std::bit_width(static_cast<unsigned int>(std::max(m_Width, m_Height)));
+			format = { s_InternalFormats[formatIndex], m_Width, m_Height, levels, formatIndex + 1 };
+		}
+
+		TextureArrayPool::Slot slot = TextureArrayPool::Allocate(&shareGroup, format);
+		GLStateCache::Current().BindTexture(GL_TEXTURE_2D_ARRAY, slot.PoolArray->TextureID);
+
+		if (m_CompressedImage) {
+			for (std::size_t level = 0; level < m_CompressedImage->Levels.size(); ++level) {
+				std::span<const std::byte> levelData = m_CompressedImage->Levels[level];
+				glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, static_cast<GLint>(level), 0, 0, slot.Layer, std::max(m_Width >> level, 1), std::max(m_Height >> level, 1), 1,
+					format.InternalFormat, static_cast<GLsizei>(levelData.size()), levelData.data());
+			}
+		}
+		else {
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+			glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, slot.Layer, m_Width, m_Height, 1, s_Formats[format.NumChannels - 1], GL_UNSIGNED_BYTE, m_RawData);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+			// Mips of every layer are generated at once, when the array is next sampled
+			slot.PoolArray->MipmapsDirty = true;
+		}
+
+		// The array's own parameters are shared by every layer, so we sample through a sampler of our settings
+		slot.Sampler = TextureArrayPool::GetSampler(&shareGroup, GetSampling());
+
+		m_GroupArraySlots[shareGroup.GetID()] = slot;
+		m_UploadedSize = format.GetLayerSize();
+
+		// Counts as uploaded, though the array accounts for the memory
+		m_GroupTracking[shareGroup.GetID()] = nullptr;
+	}
+
+	void Texture::ApplyTextureParameters() {
+		ForgetClosedShareGroups();
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+
+		for (const auto& [shareGroupID, textureID] : m_GroupTextureIDs) {
+			std::shared_ptr<const ShareGroup> shareGroup = m_GroupLifetimes[shareGroupID].lock();
+			Window::ActivateGLFWWindow(shareGroup->GetAnyContext());
+			GLStateCache::Current().BindTexture(GL_TEXTURE_2D, textureID);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, m_TextureWrapS);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, m_TextureWrapT);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_TextureFilteringMin);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_TextureFilteringMag);
+			glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, m_BorderColour.data());
+		}
+
+		// Layers sample through a sampler, so swap to the one matching our new settings
+		TextureArrayPool::Sampling sampling = GetSampling();
+		for (auto& [shareGroupID, slot] : m_GroupArraySlots) {
+			std::shared_ptr<const ShareGroup> shareGroup = m_GroupLifetimes[shareGroupID].lock();
+			Window::ActivateGLFWWindow(shareGroup->GetAnyContext());
+			slot.Sampler = TextureArrayPool::GetSampler(shareGroup.get(), sampling);
+		}
+
+		Window::ActivateGLFWWindow(oldContext);
+	}
+
+	void Texture::ForgetClosedShareGroups() {
+		std::erase_if(m_GroupLifetimes, [this](const auto& groupLifetime) {
+			const auto& [shareGroupID, lifetime] = groupLifetime;
+			if (!lifetime.expired()) {
+				return false;
+			}
+			m_GroupTextureIDs.erase(shareGroupID);
+			m_GroupArraySlots.erase(shareGroupID);
+			m_GroupTracking.erase(shareGroupID);
+			return true;
+		});
+	}
+
+	TextureArrayPool::Sampling Texture::GetSampling() const {
+		return { m_TextureWrapS, m_TextureWrapT, m_TextureFilteringMin, m_TextureFilteringMag, m_BorderColour };
 	}
 
 } // OORenderer
@@ -0,0 +1,144 @@
+#include "OORenderer/TextureArrayPool.h"
+
+#include <algorithm>
+#include <LoggingAD/LoggingAD.h>
+
+#include "OORenderer/Residency.h"
+#include "OORenderer/GLStateCache.h"
+
+namespace OORenderer {
+
+	// Pixel transfer format matching each uncompressed internal format, by channel count
+	static constexpr GLenum s_TransferFormats[] = { GL_RED, GL_RG, GL_RGB, GL_RGBA };
+
+	static std::size_t GetLevelSize(const TextureArrayPool::Format& format, int level) {
+		std::size_t width = std::max(format.Width >> level, 1);
+		std::size_t height = std::max(format.Height >> level, 1);
+		if (format.BlockSize) {
+			return ((width + 3) / 4) * ((height + 3) / 4) * format.BlockSize;
+		}
+		return width * height * format.NumChannels;
+	}
+
+	std::size_t TextureArrayPool::Format::GetLayerSize() const {
+		std::size_t layerSize = 0;
+		for (int level = 0; level < Levels; ++level) {
+			layerSize += GetLevelSize(*this, level);
+		}
+		return layerSize;
+	}
+
+	TextureArrayPool::Slot TextureArrayPool::Allocate(const ShareGroup* shareGroup, const Format& format) {
+		std::vector<std::unique_ptr<Array>>& arrays = sm_Arrays[shareGroup->GetID()];
+
+		auto hasRoom = [&](const std::unique_ptr<Array>& array) {
+			return array->ArrayFormat == format && (!array->FreeLayers.empty() || array->LayerCount < array->LayerCapacity);
+		};
+
+		auto arrayIt = std::ranges::find_if(arrays, hasRoom);
+		if (arrayIt == arrays.end()) {
+			GLint maxLayers = 256;
+			glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+
+			std::size_t layerSize = format.GetLayerSize();
+			auto array = std::make_unique<Array>();
+			array->ArrayFormat = format;
+			array->LayerCapacity = static_cast<int>(std::clamp<std::size_t>(sm_ArrayBudget / layerSize, 1, maxLayers));
+
+			// Storage for every level of every layer up front, layers are filled in as textures arrive
+			glGenTextures(1, &array->TextureID);
+			GLStateCache::Current().BindTexture(GL_TEXTURE_2D_ARRAY, array->TextureID);
+			for (int level = 0; level < format.Levels; ++level) {
+				GLsizei width = std::max(format.Width >> level, 1);
+				GLsizei height = std::max(format.Height >> level, 1);
+				if (format.BlockSize) {
+					glCompressedTexImage3D(GL_TEXTURE_2D_ARRAY, level, format.InternalFormat, width, height, array->LayerCapacity, 0,
+						static_cast<GLsizei>(GetLevelSize(format, level) * array->LayerCapacity), NULL);
+				}
+				else {
+					GLenum transferFormat = s_TransferFormats[std::clamp(format.NumChannels, 1, 4) - 1];
+					glTexImage3D(GL_TEXTURE_2D_ARRAY, level, format.InternalFormat, width, height, array->LayerCapacity, 0, transferFormat, GL_UNSIGNED_BYTE, NULL);
+				}
+			}
+
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, format.Levels - 1);
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+			// Sample greyscale as grey rather than red, and greyscale with alpha as grey with alpha
+			if (format.NumChannels <= 2) {
+				GLint swizzle[] = { GL_RED, GL_RED, GL_RED, format.NumChannels == 2 ? GL_GREEN : GL_ONE };
+				glTexParameteriv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+			}
+
+			array->Tracking = Residency::Track(Residency::Asset::Texture, shareGroup, layerSize * array->LayerCapacity);
+
+			LoggingAD::Trace("[OORenderer::TextureArrayPool::Allocate] Created array of {} {}x{} layers, {} arrays in share group {}",
+				array->LayerCapacity, format.Width, format.Height, arrays.size() + 1, shareGroup->GetID());
+
+			arrays.push_back(std::move(array));
+			arrayIt = std::prev(arrays.end());
+		}
+
+		Array& array = **arrayIt;
+		if (!array.FreeLayers.empty()) {
+			int layer = array.FreeLayers.back();
+			array.FreeLayers.pop_back();
+			return { &array, layer };
+		}
+		return { &array, array.LayerCount++ };
+	}
+
+	void TextureArrayPool::Release(const Slot& slot) {
+		if (slot.PoolArray) {
+			slot.PoolArray->FreeLayers.push_back(slot.Layer);
+		}
+	}
+
+	GLuint TextureArrayPool::GetSampler(const ShareGroup* shareGroup, const Sampling& sampling) {
+		std::map<Sampling, GLuint>& samplers = sm_Samplers[shareGroup->GetID()];
+		if (auto samplerIt = samplers.find(sampling); samplerIt != samplers.end()) {
+			return samplerIt->second;
+		}
+
+		GLuint sampler;
+		glGenSamplers(1, &sampler);
+		glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, sampling.WrapS);
+		glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, sampling.WrapT);
+		glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, sampling.MinFilter);
+		glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, sampling.MagFilter);
+		glSamplerParameterfv(sampler, GL_TEXTURE_BORDER_COLOR, sampling.BorderColour.data());
+
+		samplers.emplace(sampling, sampler);
+		return sampler;
+	}
+
+	void TextureArrayPool::PrepareForSampling(Array& array) {
+		if (array.MipmapsDirty) {
+			// Its unit may not be the active one, when the bind to it was skipped
+			GLStateCache::Current().BindTexture(GL_TEXTURE_2D_ARRAY, array.TextureID);
+			glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+			array.MipmapsDirty = false;
+		}
+	}
+
+	void TextureArrayPool::ReleaseShareGroup(ShareGroup::ID shareGroupID) {
+		sm_Arrays.erase(shareGroupID);
+		sm_Samplers.erase(shareGroupID);
+	}
+
+	void TextureArrayPool::SetArrayBudget(std::size_t bytes) {
+		sm_ArrayBudget = bytes;
+	}
+
+	std::size_t TextureArrayPool::GetArrayCount() {
+		std::size_t arrayCount = 0;
+		for (const auto& [shareGroupID, arrays] : sm_Arrays) {
+			arrayCount += arrays.size();
+		}
+		return arrayCount;
+	}
+
+} // OORenderer
@@ -0,0 +1,135 @@
+#include "OORenderer/TextureCache.h"
+
+#include <fstream>
+#include <vector>
+#include <LoggingAD/LoggingAD.h>
+
+#include "OORenderer/Hash.h"
+
+namespace OORenderer {
+
+	std::shared_ptr<Texture> TextureCache::Acquire(const std::filesystem::path& texturePath) {
+		if (!std::filesystem::exists(texturePath)) {
+			LoggingAD::Warning("[OORenderer::TextureCache::Acquire] Failure to load texture at path {}. File not found.", texturePath.string());
+			return nullptr;
+		}
+
+		std::string key = BuildKey(texturePath);
+
+		std::scoped_lock lock(sm_Mutex);
+		auto [entryIt, inserted] = sm_Entries.try_emplace(key);
+		Entry& entry = entryIt->second;
+
+		if (inserted) {
+			// Decode in the background, users can bind and render it before the image arrives
+			entry.Resident = std::make_shared<Texture>();
+			entry.Resident->LoadTextureAsync(texturePath);
+			return MakeHandle(key, entry);
+		}
+
+		if (std::shared_ptr<Texture> handle = entry.Handle.lock()) {
+			return handle;
+		}
+
+		// Revive a released texture
+		if (entry.Released) {
+			sm_Released.erase(entry.ReleasedIt);
+			sm_ReleasedBytes -= entry.ReleasedBytes;
+			entry.Released = false;
+		}
+		return MakeHandle(key, entry);
+	}
+
+	void TextureCache::SetKeyMode(KeyMode keyMode) {
+		std::scoped_lock lock(sm_Mutex);
+		sm_KeyMode = keyMode;
+	}
+
+	void TextureCache::SetMemoryBudget(std::size_t bytes) {
+		std::scoped_lock lock(sm_Mutex);
+		sm_MemoryBudget = bytes;
+		EvictOverBudget(sm_MemoryBudget);
+	}
+
+	std::size_t TextureCache::GetMemoryBudget() {
+		std::scoped_lock lock(sm_Mutex);
+		return sm_MemoryBudget;
+	}
+
+	std::size_t TextureCache::GetReleasedMemory() {
+		std::scoped_lock lock(sm_Mutex);
+		return sm_ReleasedBytes;
+	}
+
+	std::size_t TextureCache::GetTextureCount() {
+		std::scoped_lock lock(sm_Mutex);
+		return sm_Entries.size();
+	}
+
+	void TextureCache::EvictReleased() {
+		std::scoped_lock lock(sm_Mutex);
+		EvictOverBudget(0);
+	}
+
+	std::string TextureCache::BuildKey(const std::filesystem::path& texturePath) {
+		if (sm_KeyMode == KeyMode::ContentHash) {
+			std::ifstream file(texturePath, std::ios::in | std::ios::binary);
+			std::uint64_t hash = FNV1a64OffsetBasis;
+
+			std::vector<char> chunk(1 << 16);
+			while (file) {
+				file.read(chunk.data(), chunk.size());
+				hash = HashFNV1a64(chunk.data(), static_cast<std::size_t>(file.gcount()), hash);
+			}
+			return std::to_string(hash);
+		}
+
+		std::error_code error;
+		return std::filesystem::weakly_canonical(texturePath, error).generic_string();
+	}
+
+	std::shared_ptr<Texture> TextureCache::MakeHandle(const std::string& key, Entry& entry) {
+		// The deleter holds its own reference, so handles stay valid even if the entry is evicted under them
+		std::shared_ptr<Texture> handle(entry.Resident.get(), [key, resident = entry.Resident](Texture* texture) {
+			Release(key, texture);
+		});
+		entry.Handle = handle;
+		return handle;
+	}
+
+	void TextureCache::Release(const std::string& key, Texture* texture) {
+		std::scoped_lock lock(sm_Mutex);
+
+		// May have been evicted and replaced while in use
+		auto entryIt = sm_Entries.find(key);
+		if (entryIt == sm_Entries.end() || entryIt->second.Resident.get() != texture || !entryIt->second.Handle.expired()) {
+			return;
+		}
+
+		Entry& entry = entryIt->second;
+		entry.Released = true;
+		entry.ReleasedBytes = texture->GetMemorySize();
+		entry.ReleasedIt = sm_Released.insert(sm_Released.end(), key);
+		sm_ReleasedBytes += entry.ReleasedBytes;
+
+		EvictOverBudget(sm_MemoryBudget);
+	}
+
+	void TextureCache::EvictOverBudget(std::size_t budget) {
+		while (sm_ReleasedBytes > budget && !sm_Released.empty()) {
+			auto entryIt = sm_Entries.find(sm_Released.front());
+			sm_Released.pop_front();
+
+			LoggingAD::Trace("[OORenderer::TextureCache::Evict] Evicting texture {}", entryIt->second.Resident->GetTexturePath().string());
+			sm_ReleasedBytes -= entryIt->second.ReleasedBytes;
+			sm_Entries.erase(entryIt);
+		}
+
+		// Unsized entries (e.g. failed loads) cost nothing but are dropped once everything else has gone
+		if (budget == 0) {
+			std::erase_if(sm_Entries, [](const auto& keyEntry) { return keyEntry.second.Released; });
+			sm_Released.clear();
+		}
+	}
+
+} // OORenderer
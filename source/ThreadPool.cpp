@@ -0,0 +1,59 @@
+#include "OORenderer/ThreadPool.h"
+
+#include <algorithm>
+
+namespace OORenderer {
+
+	ThreadPool::ThreadPool(unsigned int threadCount) {
+		threadCount = std::max(threadCount, 1u);
+
+		m_Workers.reserve(threadCount);
+		for (unsigned int i = 0; i < threadCount; ++i) {
+			m_Workers.emplace_back(&ThreadPool::WorkerLoop, this);
+		}
+	}
+
+	ThreadPool::~ThreadPool() {
+		{
+			std::scoped_lock lock(m_Mutex);
+			m_Stopping = true;
+		}
+		m_JobAvailable.notify_all();
+
+		for (std::thread& worker : m_Workers) {
+			worker.join();
+		}
+	}
+
+	void ThreadPool::Submit(std::function<void()> job) {
+		{
+			std::scoped_lock lock(m_Mutex);
+			m_Jobs.push_back(std::move(job));
+		}
+		m_JobAvailable.notify_one();
+	}
+
+	unsigned int ThreadPool::GetThreadCount() const {
+		return static_cast<unsigned int>(m_Workers.size());
+	}
+
+	void ThreadPool::WorkerLoop() {
+		while (true) {
+			std::function<void()> job;
+			{
+				std::unique_lock lock(m_Mutex);
+				m_JobAvailable.wait(lock, [this]() { return m_Stopping || !m_Jobs.empty(); });
+
+				// Drain the queue before stopping so nothing submitted is lost
+				if (m_Jobs.empty()) {
+					return;
+				}
+				job = std::move(m_Jobs.front());
+				m_Jobs.pop_front();
+			}
+
+			job();
+		}
+	}
+
+} // OORenderer
@@ -0,0 +1,71 @@
+#include "OORenderer/UniformBuffer.h"
+
+#include <LoggingAD/LoggingAD.h>
+
+#include "OORenderer/GLStateCache.h"
+
+namespace OORenderer {
+
+	UniformBuffer::UniformBuffer(const Window& window, std::size_t size, GLenum usage)
+		: m_Window(window.GetGLFWWindow()), m_Size(size)
+	{
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		Window::ActivateGLFWWindow(m_Window);
+
+		glGenBuffers(1, &m_BufferID);
+		GLStateCache::Current().BindBuffer(GL_UNIFORM_BUFFER, m_BufferID);
+		glBufferData(GL_UNIFORM_BUFFER, m_Size, NULL, usage);
+
+		LoggingAD::Trace("[OORenderer::UniformBuffer] Created uniform buffer {} of {} bytes on window {:#010x}", m_BufferID, m_Size, reinterpret_cast<std::uintptr_t>(m_Window));
+
+		Window::ActivateGLFWWindow(oldContext);
+	}
+
+	UniformBuffer::~UniformBuffer() {
+		// Ensure we delete the correct buffer on the correct context
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		Window::ActivateGLFWWindow(m_Window);
+
+		GLStateCache::ForgetBuffer(m_Window, m_BufferID);
+		glDeleteBuffers(1, &m_BufferID);
+
+		Window::ActivateGLFWWindow(oldContext);
+	}
+
+	void UniformBuffer::SetData(std::size_t offset, std::size_t size, const void* data) {
+		if (offset + size > m_Size) {
+			LoggingAD::Error("[OORenderer::UniformBuffer::SetData] Write of {} bytes at offset {} overruns buffer {} of {} bytes.", size, offset, m_BufferID, m_Size);
+			return;
+		}
+
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		Window::ActivateGLFWWindow(m_Window);
+
+		GLStateCache::Current().BindBuffer(GL_UNIFORM_BUFFER, m_BufferID);
+		glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+
+		Window::ActivateGLFWWindow(oldContext);
+	}
+
+	void UniformBuffer::BindToPoint(GLuint binding) {
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		Window::ActivateGLFWWindow(m_Window);
+
+		GLStateCache::Current().BindBufferBase(GL_UNIFORM_BUFFER, binding, m_BufferID);
+
+		Window::ActivateGLFWWindow(oldContext);
+	}
+
+	unsigned int UniformBuffer::GetBufferID() const {
+		return m_BufferID;
+	}
+
+	std::size_t UniformBuffer::GetSize() const {
+		return m_Size;
+	}
+
+	GLFWwindow* UniformBuffer::GetGLFWWindow() const {
+		return m_Window;
+	}
+
+} // OORenderer
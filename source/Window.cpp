@@ -2,12 +2,47 @@
 #include "OORenderer/Window.h"
 
 #include <iostream>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
 #include <LoggingAD/LoggingAD.h>
 
+#include "OORenderer/ShareGroup.h"
+#include "OORenderer/Profiler.h"
+#include "OORenderer/GLStateCache.h"
+#include "GLFunctionTable.h"
+
 namespace OORenderer {
 
 	static unsigned int s_NumWindows = 0;
 
+	// Context version windows ask for, 3.3 unless raised to reach newer paths such as persistent RingBuffers
+	static int s_ContextVersionMajor = 3;
+	static int s_ContextVersionMinor = 3;
+
+	// Window whose render thread this is, if any
+	static thread_local Window* s_RenderThreadWindow = nullptr;
+
+	struct Window::RenderThread {
+		std::thread Thread;
+
+		std::mutex Mutex;
+		std::condition_variable FrameQueued;
+		std::condition_variable FrameDone;
+		std::deque<std::function<void()>> Frames;
+		unsigned int MaxQueuedFrames = 2;
+		unsigned int FramesInFlight = 0; // Waiting plus the one drawing
+		bool Stopping = false;
+
+		// Viewport size from the last resize, set on the thread handling events and applied before the next frame
+		bool ViewportDirty = false;
+		int ViewportWidth = 0;
+		int ViewportHeight = 0;
+	};
+
 	static Window* StaticGetUserOfGLFWWindow(GLFWwindow* window) {
 		Window* user = static_cast<Window*>(glfwGetWindowUserPointer(window));
 		if (user == nullptr) {
@@ -59,24 +94,69 @@ namespace OORenderer {
 		}
 
 		// What sort of window do we want
-		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, s_ContextVersionMajor);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, s_ContextVersionMinor);
 		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
 		m_GLFWWindow = glfwCreateWindow(width, height, title.c_str(), monitor, share);
 
+		// Newer paths all check what the context supports, so an older context still renders
+		if (!m_GLFWWindow && (s_ContextVersionMajor > 3 || s_ContextVersionMinor > 3)) {
+			LoggingAD::Warning("[OORenderer::Window::Init] No OpenGL {}.{} context available, falling back to 3.3.", s_ContextVersionMajor, s_ContextVersionMinor);
+			glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+			glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+			m_GLFWWindow = glfwCreateWindow(width, height, title.c_str(), monitor, share);
+		}
+		if (!m_GLFWWindow) {
+			LoggingAD::Error("[OORenderer::Window::Init] GLFW Failed to create a window! Aborting.");
+			throw "[OORenderer::Window::Init] GLFW Failed to create a window aborting!";
+		}
+
 		LoggingAD::Trace("Creating GLFW context for window with title: {}. GLFW Window: {:#010x}", title, reinterpret_cast<std::uintptr_t>(m_GLFWWindow));
 
 		// Keep members up to date
 		m_Width = width;
 		m_Height = height;
+		m_FramebufferWidth = width;
+		m_FramebufferHeight = height;
+		++m_ResizeCount;
 
 		// Register this as the user of the glfw window for use in callbacks etc.
 		glfwSetWindowUserPointer(m_GLFWWindow, this);
 
-		// Set this to be the active window
-		if (setToCurrent) {
-			ActivateWindow();
+		// Join the share group of the window we share with, or start our own
+		Window* sharedWith = share ? static_cast<Window*>(glfwGetWindowUserPointer(share)) : nullptr;
+		if (share && !sharedWith) {
+			LoggingAD::Warning("[OORenderer::Window::Init] Sharing with a GLFW window not created by a Window, objects will not be reused across the two.");
+		}
+		m_ShareGroup = sharedWith ? sharedWith->m_ShareGroup : std::make_shared<ShareGroup>();
+		m_ShareGroup->AddWindow(m_GLFWWindow);
+
+		// Resolve this context's OpenGL entry points once, activations after this only swap tables
+		GLFWwindow* oldContext = glfwGetCurrentContext();
+		glfwMakeContextCurrent(m_GLFWWindow);
+		m_StateCache = std::make_unique<GLStateCache>();
+		GLStateCache::SetCurrent(m_StateCache.get());
+
+		m_GLFunctionTable = GLFunctionTable::LoadForCurrentContext();
+		if (!m_GLFunctionTable) {
+			throw "GLAD Failed to load aborting!";
+		}
+
+		// What we were granted, which may be less than asked for, see SetContextVersion
+		m_ContextVersionMajor = GLVersion.major;
+		m_ContextVersionMinor = GLVersion.minor;
+
+		// Size the viewport appropriately, from here on the resize callback keeps it up to date
+		int widthPx, heightPx;
+		glfwGetFramebufferSize(m_GLFWWindow, &widthPx, &heightPx);
+		glViewport(0, 0, widthPx, heightPx);
+		m_FramebufferWidth = widthPx;
+		m_FramebufferHeight = heightPx;
+
+		// Set this to be the active window, or put back whatever was
+		if (!setToCurrent) {
+			ActivateGLFWWindow(oldContext);
 		}
 
 		glfwSetFramebufferSizeCallback(m_GLFWWindow, StaticFramebufferSizeCallback);
@@ -91,10 +171,18 @@ namespace OORenderer {
 
 		LoggingAD::Trace("Destroying window {:#010x}", reinterpret_cast<std::uintptr_t>(m_GLFWWindow));
 
+		// Finish anything still drawing, the context can't be destroyed while current on another thread
+		StopRenderThread();
+		OORENDERER_PROFILE_RELEASE_CONTEXT(m_GLFWWindow);
+
 		// Keep track of how many windows we have open
 		--s_NumWindows;
 
 		// Clean up
+		if (IsActiveWindow()) {
+			GLStateCache::SetCurrent(nullptr);
+		}
+		m_ShareGroup->RemoveWindow(m_GLFWWindow);
 		glfwDestroyWindow(m_GLFWWindow);
 
 		// If no windows open shut down
@@ -111,10 +199,25 @@ namespace OORenderer {
 		m_Width = width;
 		m_Height = height;
 
-		// Size the viewport appropriately
-		int widthPx, heightPx;
-		glfwGetFramebufferSize(m_GLFWWindow, &widthPx, &heightPx);
-		glViewport(0, 0, width, height);
+		// Size before count, so a reader seeing the new count sees the new size
+		m_FramebufferWidth.store(width, std::memory_order_relaxed);
+		m_FramebufferHeight.store(height, std::memory_order_relaxed);
+		m_ResizeCount.fetch_add(1, std::memory_order_release);
+
+		// Our context is current on the render thread, which sizes the viewport before its next frame
+		if (m_RenderThread) {
+			std::lock_guard lock(m_RenderThread->Mutex);
+			m_RenderThread->ViewportDirty = true;
+			m_RenderThread->ViewportWidth = width;
+			m_RenderThread->ViewportHeight = height;
+		}
+		else {
+			// Size the viewport appropriately, on our own context as the viewport is per context state
+			GLFWwindow* oldContext = glfwGetCurrentContext();
+			ActivateWindow();
+			glViewport(0, 0, width, height);
+			ActivateGLFWWindow(oldContext);
+		}
 
 		if (m_ExternFramebufferResizeCallback) {
 			std::invoke(m_ExternFramebufferResizeCallback, m_GLFWWindow, width, height);
@@ -124,7 +227,9 @@ namespace OORenderer {
 	void Window::FocusCallback(int focused) {
 		if (focused) {
 			LoggingAD::Trace("[OORenderer::Window] Window gained focus: {:#010x}", reinterpret_cast<std::uintptr_t>(m_GLFWWindow));
-			ActivateWindow();
+			if (!m_RenderThread) {
+				ActivateWindow();
+			}
 		}
 		else {
 			LoggingAD::Trace("[OORenderer::Window] Window lost focus: {:#010x}", reinterpret_cast<std::uintptr_t>(m_GLFWWindow));
@@ -165,24 +270,45 @@ namespace OORenderer {
 		}
 	}
 
+	void Window::SetContextVersion(int major, int minor) {
+		s_ContextVersionMajor = major;
+		s_ContextVersionMinor = minor;
+	}
+
 	void Window::ActivateGLFWWindow(GLFWwindow* window) {
 		// Already active?
 		if (window == glfwGetCurrentContext()) {
 			return;
 		}
 
-		// Activate this glfw context
+		OORENDERER_PROFILE_SCOPE("Window::ActivateGLFWWindow");
+
+		// A context current on a render thread can't be made current on any other
+		Window* user = window ? static_cast<Window*>(glfwGetWindowUserPointer(window)) : nullptr;
+		if (user && user->m_RenderThread && s_RenderThreadWindow != user) {
+			LoggingAD::Error("[OORenderer::Window::Activate] Window {:#010x} renders on its own thread, submit a frame rather than activating it.", reinterpret_cast<std::uintptr_t>(window));
+			return;
+		}
+
+		// Activate this glfw context, along with what we know it has bound
 		glfwMakeContextCurrent(window);
+		GLStateCache::SetCurrent(user ? user->m_StateCache.get() : nullptr);
+
+		if (!window) {
+			return;
+		}
 
-		// Bind glad to this glfw context
+		// Point glad at this context's entry points
+		if (user && user->m_GLFunctionTable) {
+			user->m_GLFunctionTable->Install();
+			return;
+		}
+
+		// Not one of ours, so we have no table and must resolve everything again
 		if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
 			throw "GLAD Failed to load aborting!";
 		}
-
-		// Size the viewport appropriately
-		int width, height;
-		glfwGetFramebufferSize(window, &width, &height);
-		glViewport(0, 0, width, height);
+		GLFunctionTable::InvalidateInstalled();
 	}
 	
 	void Window::ActivateWindow() {
@@ -201,10 +327,35 @@ namespace OORenderer {
 		return glfwGetWindowAttrib(m_GLFWWindow, GLFW_FOCUSED);
 	}
 
+	float Window::GetAspectRatio() const {
+		int width = m_FramebufferWidth.load(std::memory_order_relaxed);
+		int height = m_FramebufferHeight.load(std::memory_order_relaxed);
+		if (height == 0) {
+			return 0.0f;
+		}
+		return static_cast<float>(width) / static_cast<float>(height);
+	}
+
+	bool Window::HasContextVersion(int major, int minor) const {
+		return m_ContextVersionMajor > major || (m_ContextVersionMajor == major && m_ContextVersionMinor >= minor);
+	}
+
+	std::uint64_t Window::GetResizeCount() const {
+		return m_ResizeCount.load(std::memory_order_acquire);
+	}
+
 	GLFWwindow* Window::GetGLFWWindow() const {
 		return m_GLFWWindow;
 	}
 
+	ShareGroup* Window::GetShareGroup() const {
+		return m_ShareGroup.get();
+	}
+
+	GLStateCache& Window::GetStateCache() const {
+		return *m_StateCache;
+	}
+
 	bool Window::ShouldClose() const {
 		return glfwWindowShouldClose(m_GLFWWindow);
 	}
@@ -214,7 +365,137 @@ namespace OORenderer {
 	}
 
 	void Window::UpdateDisplay() {
+		OORENDERER_PROFILE_SCOPE("Window::UpdateDisplay");
 		glfwSwapBuffers(m_GLFWWindow);
+		m_StateCache->EndFrame();
+	}
+
+	bool Window::StartRenderThread(unsigned int maxQueuedFrames) {
+		if (m_RenderThread) {
+			return true;
+		}
+
+		// GLAD's entry points are globals, every thread must be able to call through the same ones
+		if (GLFunctionTable::GetLoadedCount() > 1) {
+			LoggingAD::Error("[OORenderer::Window::StartRenderThread] Contexts loaded differing OpenGL entry points, window {:#010x} keeps rendering on the calling thread.",
+				reinterpret_cast<std::uintptr_t>(m_GLFWWindow));
+			return false;
+		}
+
+		// A context may only be current on one thread
+		if (IsActiveWindow()) {
+			glfwMakeContextCurrent(NULL);
+			GLStateCache::SetCurrent(nullptr);
+		}
+
+		LoggingAD::Trace("[OORenderer::Window::StartRenderThread] Starting render thread for window {:#010x}", reinterpret_cast<std::uintptr_t>(m_GLFWWindow));
+
+		m_RenderThread = std::make_unique<RenderThread>();
+		m_RenderThread->MaxQueuedFrames = std::max(maxQueuedFrames, 1u);
+		m_RenderThread->Thread = std::thread(&Window::RenderThreadLoop, this);
+		return true;
+	}
+
+	void Window::StopRenderThread() {
+		if (!m_RenderThread) {
+			return;
+		}
+
+		{
+			std::lock_guard lock(m_RenderThread->Mutex);
+			m_RenderThread->Stopping = true;
+		}
+		m_RenderThread->FrameQueued.notify_one();
+		m_RenderThread->Thread.join();
+		m_RenderThread.reset();
+
+		LoggingAD::Trace("[OORenderer::Window::StopRenderThread] Stopped render thread for window {:#010x}", reinterpret_cast<std::uintptr_t>(m_GLFWWindow));
+	}
+
+	bool Window::HasRenderThread() const {
+		return m_RenderThread != nullptr;
+	}
+
+	void Window::SubmitFrame(std::function<void()> frame) {
+		if (!m_RenderThread) {
+			GLFWwindow* oldContext = glfwGetCurrentContext();
+			ActivateWindow();
+			std::invoke(frame);
+			UpdateDisplay();
+			ActivateGLFWWindow(oldContext);
+			return;
+		}
+
+		std::unique_lock lock(m_RenderThread->Mutex);
+		m_RenderThread->FrameDone.wait(lock, [this] { return m_RenderThread->FramesInFlight < m_RenderThread->MaxQueuedFrames; });
+		m_RenderThread->Frames.push_back(std::move(frame));
+		++m_RenderThread->FramesInFlight;
+		lock.unlock();
+		m_RenderThread->FrameQueued.notify_one();
+	}
+
+	void Window::WaitForFrames() {
+		if (!m_RenderThread) {
+			return;
+		}
+
+		std::unique_lock lock(m_RenderThread->Mutex);
+		m_RenderThread->FrameDone.wait(lock, [this] { return m_RenderThread->FramesInFlight == 0; });
+	}
+
+	void Window::RenderThreadLoop() {
+		RenderThread& renderThread = *m_RenderThread;
+
+		// Our context stays current here until we stop
+		s_RenderThreadWindow = this;
+		OORENDERER_PROFILE_THREAD_NAME("Render " + std::to_string(reinterpret_cast<std::uintptr_t>(m_GLFWWindow)));
+		ActivateWindow();
+
+		while (true) {
+			std::function<void()> frame;
+			bool resize;
+			int width, height;
+			{
+				std::unique_lock lock(renderThread.Mutex);
+				renderThread.FrameQueued.wait(lock, [&] { return renderThread.Stopping || !renderThread.Frames.empty(); });
+
+				// Only stop once every queued frame is drawn
+				if (renderThread.Frames.empty()) {
+					break;
+				}
+				frame = std::move(renderThread.Frames.front());
+				renderThread.Frames.pop_front();
+
+				resize = std::exchange(renderThread.ViewportDirty, false);
+				width = renderThread.ViewportWidth;
+				height = renderThread.ViewportHeight;
+			}
+
+			if (resize) {
+				glViewport(0, 0, width, height);
+			}
+
+			// Our cache stays current here, so objects deleted on other threads since the last frame are forgotten now
+			m_StateCache->ApplyForgottenNames();
+
+			{
+				OORENDERER_PROFILE_SCOPE("Window::Frame");
+				std::invoke(frame);
+			}
+
+			// Blocks on vsync, holding up only this window
+			UpdateDisplay();
+
+			{
+				std::lock_guard lock(renderThread.Mutex);
+				--renderThread.FramesInFlight;
+			}
+			renderThread.FrameDone.notify_all();
+		}
+
+		glfwMakeContextCurrent(NULL);
+		GLStateCache::SetCurrent(nullptr);
+		s_RenderThreadWindow = nullptr;
 	}
 
 	void Window::RequestAttention() {